@@ -22,6 +22,7 @@ let package = Package(
                     .target(name:"AnimationTiming"),
                     .target(name:"Buttons"),
                     .target(name:"Elevation"),
+                    .target(name:"Icons"),
                     .target(name:"Typography"),
                     .target(name:"Math"),
                     .target(name:"Palettes"),
@@ -162,6 +163,12 @@ let package = Package(
                     "src"
             ],
                 publicHeadersPath:"src"),
+        .target(name: "Icons",
+                path: "components/private/Icons/",
+                sources: [
+                    "src"
+            ],
+                publicHeadersPath:"src"),
         .target(name: "Palettes", 
                 path: "components/Palettes/",
                 sources: [
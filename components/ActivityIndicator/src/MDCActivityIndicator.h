@@ -75,6 +75,15 @@ IB_DESIGNABLE
  */
 @property(nonatomic, assign) IBInspectable BOOL trackEnabled;
 
+/**
+ Whether the indeterminate animation is added to the layers once, as a single repeating loop through
+ every cycle position and cycle color, rather than one cycle at a time. The loop runs in the render
+ server without waking the main thread between cycles, which makes a difference when many activity
+ indicators are animating at once. Changes that are applied at the end of a cycle, such as a new
+ mode or a stop transition, still are. Defaults to NO.
+ */
+@property(nonatomic, assign) BOOL precomputesIndeterminateLoop;
+
 /**
  The mode of the activity indicator. Default is MDCActivityIndicatorModeIndeterminate. If
  currently animating, it will animate the transition between the current mode to the new mode.
@@ -44,6 +44,9 @@ static const CGFloat kStrokeWidth = (CGFloat)2.5;
 // The Bundle for string resources.
 static NSString *const kBundle = @"MaterialActivityIndicator.bundle";
 
+// The key of the animations added to each layer when precomputesIndeterminateLoop is enabled.
+static NSString *const kIndeterminateLoopAnimationKey = @"mdc.indeterminateLoop";
+
 /**
  Total rotation (outer rotation + stroke rotation) per _cycleCount. One turn is 2.
  */
@@ -110,6 +113,17 @@ static const CGFloat kSingleCycleRotation =
   CGFloat _currentProgress;
   CGFloat _lastProgress;
 
+  // The state of the loop added by addIndeterminateLoop, from which the cycle that is on screen can
+  // be derived without a callback per cycle.
+  BOOL _indeterminateLoopAdded;
+  BOOL _indeterminateLoopFinishScheduled;
+  NSUInteger _indeterminateLoopGeneration;
+  CFTimeInterval _indeterminateLoopBeginTime;
+  NSTimeInterval _indeterminateLoopCycleDuration;
+  NSInteger _indeterminateLoopStartCycle;
+  NSUInteger _indeterminateLoopStartColorIndex;
+  NSUInteger _indeterminateLoopColorCount;
+
   MDMMotionAnimator *_animator;
 }
 
@@ -286,13 +300,9 @@ static const CGFloat kSingleCycleRotation =
     [CATransaction setCompletionBlock:^{
       self->_animationInProgress = NO;
 
-      [self actuallyStartAnimating];
-
-      self.cycleColorsIndex =
+      NSUInteger cycleColorsIndex =
           self.cycleColors.count > 0 ? cycleStartIndex % self.cycleColors.count : 0;
-      [self applyPropertiesWithoutAnimation:^{
-        [self updateStrokeColor];
-      }];
+      [self actuallyStartAnimatingFromCycleColorsIndex:cycleColorsIndex];
 
       if (startTransition.completion) {
         startTransition.completion();
@@ -339,6 +349,7 @@ static const CGFloat kSingleCycleRotation =
   _animatingOut = YES;
 
   self.stopTransition = stopTransition;
+  [self finishIndeterminateLoopAtEndOfCycle];
 }
 
 - (void)stopAnimatingImmediately {
@@ -355,12 +366,6 @@ static const CGFloat kSingleCycleRotation =
   }
 }
 
-- (void)resetStrokeColor {
-  _cycleColorsIndex = 0;
-
-  [self updateStrokeColor];
-}
-
 - (void)setStrokeColor:(UIColor *)strokeColor {
   _strokeLayer.strokeColor = strokeColor.CGColor;
   _trackLayer.strokeColor = [strokeColor colorWithAlphaComponent:(CGFloat)0.3].CGColor;
@@ -380,6 +385,8 @@ static const CGFloat kSingleCycleRotation =
         [self addTransitionToIndeterminateCycle];
         break;
     }
+  } else if (_indeterminateLoopAdded) {
+    [self finishIndeterminateLoopAtEndOfCycle];
   } else if (!_animating) {
     if ([_delegate respondsToSelector:@selector(activityIndicatorModeTransitionDidFinish:)]) {
       [_delegate activityIndicatorModeTransitionDidFinish:self];
@@ -432,6 +439,15 @@ static const CGFloat kSingleCycleRotation =
   _trackLayer.hidden = !_trackEnabled;
 }
 
+- (void)setPrecomputesIndeterminateLoop:(BOOL)precomputesIndeterminateLoop {
+  _precomputesIndeterminateLoop = precomputesIndeterminateLoop;
+
+  // A running cycle-by-cycle animation picks the change up when its cycle finishes.
+  if (!precomputesIndeterminateLoop) {
+    [self finishIndeterminateLoopAtEndOfCycle];
+  }
+}
+
 #pragma mark - Private methods
 
 /**
@@ -470,6 +486,10 @@ static const CGFloat kSingleCycleRotation =
 }
 
 - (void)actuallyStartAnimating {
+  [self actuallyStartAnimatingFromCycleColorsIndex:0];
+}
+
+- (void)actuallyStartAnimatingFromCycleColorsIndex:(NSUInteger)cycleColorsIndex {
   if (_animationsAdded) {
     return;
   }
@@ -482,7 +502,8 @@ static const CGFloat kSingleCycleRotation =
     self.strokeLayer.lineWidth = self.strokeWidth;
     self.trackLayer.lineWidth = self.strokeWidth;
 
-    [self resetStrokeColor];
+    self.cycleColorsIndex = cycleColorsIndex;
+    [self updateStrokeColor];
     [self updateStrokePath];
   }];
 
@@ -518,6 +539,8 @@ static const CGFloat kSingleCycleRotation =
   if (self.cycleColors.count) {
     [self setStrokeColor:self.cycleColors[0]];
   }
+
+  [self finishIndeterminateLoopAtEndOfCycle];
 }
 
 - (void)addStopAnimation {
@@ -569,7 +592,11 @@ static const CGFloat kSingleCycleRotation =
   _strokeLayer.path = strokePath.CGPath;
   _trackLayer.path = strokePath.CGPath;
 
-  _minStrokeDifference = _strokeLayer.lineWidth / ((CGFloat)M_PI * 2 * _radius);
+  CGFloat minStrokeDifference = _strokeLayer.lineWidth / ((CGFloat)M_PI * 2 * _radius);
+  if (minStrokeDifference != _minStrokeDifference) {
+    _minStrokeDifference = minStrokeDifference;
+    [self finishIndeterminateLoopAtEndOfCycle];
+  }
 }
 
 - (void)updateStrokeColor {
@@ -581,23 +608,33 @@ static const CGFloat kSingleCycleRotation =
   }
 }
 
+- (MDCActivityIndicatorMotionSpecIndeterminate)strokeRotationCycleTiming {
+  MDCActivityIndicatorMotionSpecIndeterminate timing =
+      MDCActivityIndicatorMotionSpec.loopIndeterminate;
+  // These values may be equal if we've never received a progress. In this case we don't want our
+  // duration to become zero.
+  if (fabs(_lastProgress - _currentProgress) > CGFLOAT_EPSILON) {
+    timing.strokeEnd.duration *= ABS(_lastProgress - _currentProgress);
+  }
+  return timing;
+}
+
 - (void)addStrokeRotationCycle {
   if (_animationInProgress) {
     return;
   }
 
+  if (self.precomputesIndeterminateLoop && !self.stopTransition) {
+    [self addIndeterminateLoop];
+    return;
+  }
+
   [CATransaction begin];
   [CATransaction setCompletionBlock:^{
     [self strokeRotationCycleFinishedFromState:MDCActivityIndicatorStateIndeterminate];
   }];
 
-  MDCActivityIndicatorMotionSpecIndeterminate timing =
-      MDCActivityIndicatorMotionSpec.loopIndeterminate;
-  // These values may be equal if we've never received a progress. In this case we don't want our
-  // duration to become zero.
-  if (fabs(_lastProgress - _currentProgress) > CGFLOAT_EPSILON) {
-    timing.strokeEnd.duration *= ABS(_lastProgress - _currentProgress);
-  }
+  MDCActivityIndicatorMotionSpecIndeterminate timing = [self strokeRotationCycleTiming];
 
   [_animator animateWithTiming:timing.outerRotation
                        toLayer:_outerRotationLayer
@@ -631,6 +668,255 @@ static const CGFloat kSingleCycleRotation =
   _animationInProgress = YES;
 }
 
+#pragma mark - Indeterminate loop
+
+/** The smallest number of cycles after which both the cycle position and color repeat. */
+static NSUInteger MDCActivityIndicatorLoopCycleCount(NSUInteger colorCount) {
+  NSUInteger a = (NSUInteger)kTotalDetentCount;
+  NSUInteger b = MAX(colorCount, 1U);
+  while (b != 0) {
+    NSUInteger remainder = a % b;
+    a = b;
+    b = remainder;
+  }
+  return (NSUInteger)kTotalDetentCount / a * MAX(colorCount, 1U);
+}
+
+static CAMediaTimingFunction *MDCActivityIndicatorTimingFunction(MDMMotionCurve curve) {
+  NSCAssert(curve.type == MDMMotionCurveTypeBezier, @"Only bezier curves can be precomputed.");
+  return [CAMediaTimingFunction functionWithControlPoints:(float)curve.data[0]
+                                                         :(float)curve.data[1]
+                                                         :(float)curve.data[2]
+                                                         :(float)curve.data[3]];
+}
+
+/**
+ A keyframe animation that plays @c timing once per cycle for @c cycleCount cycles, animating from
+ @c fromValue + cycle * @c cycleIncrement by @c delta and jumping back at the start of each cycle,
+ as consecutive cycles of addStrokeRotationCycle would.
+ */
+- (CAKeyframeAnimation *)indeterminateLoopAnimationWithKeyPath:(NSString *)keyPath
+                                                        timing:(MDMMotionTiming)timing
+                                                     fromValue:(CGFloat)fromValue
+                                                cycleIncrement:(CGFloat)cycleIncrement
+                                                         delta:(CGFloat)delta
+                                                    cycleCount:(NSUInteger)cycleCount {
+  NSTimeInterval cycleDuration = _indeterminateLoopCycleDuration;
+  NSTimeInterval loopDuration = cycleCount * cycleDuration;
+  CAMediaTimingFunction *linear =
+      [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+  CAMediaTimingFunction *curve = MDCActivityIndicatorTimingFunction(timing.curve);
+
+  NSMutableArray<NSNumber *> *values = [NSMutableArray array];
+  NSMutableArray<NSNumber *> *keyTimes = [NSMutableArray array];
+  NSMutableArray<CAMediaTimingFunction *> *timingFunctions = [NSMutableArray array];
+  for (NSUInteger i = 0; i < cycleCount; i++) {
+    NSInteger cycle = (_indeterminateLoopStartCycle + (NSInteger)i) % kTotalDetentCount;
+    CGFloat from = fromValue + cycle * cycleIncrement;
+    NSTimeInterval cycleBegin = i * cycleDuration;
+    NSTimeInterval curveBegin = cycleBegin + timing.delay;
+    NSTimeInterval curveEnd = MIN(curveBegin + timing.duration, cycleBegin + cycleDuration);
+
+    // Jump back to the start of the cycle.
+    if (values.count > 0) {
+      [timingFunctions addObject:linear];
+    }
+    [values addObject:@(from)];
+    [keyTimes addObject:@(cycleBegin / loopDuration)];
+    if (curveBegin > cycleBegin) {
+      [timingFunctions addObject:linear];
+      [values addObject:@(from)];
+      [keyTimes addObject:@(curveBegin / loopDuration)];
+    }
+    [timingFunctions addObject:curve];
+    [values addObject:@(from + delta)];
+    [keyTimes addObject:@(curveEnd / loopDuration)];
+    if (curveEnd < cycleBegin + cycleDuration) {
+      [timingFunctions addObject:linear];
+      [values addObject:@(from + delta)];
+      [keyTimes addObject:@((cycleBegin + cycleDuration) / loopDuration)];
+    }
+  }
+
+  CAKeyframeAnimation *animation = [CAKeyframeAnimation animationWithKeyPath:keyPath];
+  animation.duration = loopDuration;
+  animation.values = values;
+  animation.keyTimes = keyTimes;
+  animation.timingFunctions = timingFunctions;
+  return animation;
+}
+
+/** A discrete keyframe animation that shows the next cycle color at the start of each cycle. */
+- (CAKeyframeAnimation *)indeterminateLoopColorAnimationWithAlpha:(CGFloat)alpha
+                                                       cycleCount:(NSUInteger)cycleCount {
+  NSMutableArray *values = [NSMutableArray arrayWithCapacity:cycleCount];
+  NSMutableArray<NSNumber *> *keyTimes = [NSMutableArray arrayWithCapacity:cycleCount + 1];
+  for (NSUInteger i = 0; i < cycleCount; i++) {
+    UIColor *color =
+        self.cycleColors[(_indeterminateLoopStartColorIndex + i) % _indeterminateLoopColorCount];
+    if (alpha < 1) {
+      color = [color colorWithAlphaComponent:alpha];
+    }
+    [values addObject:(__bridge id)color.CGColor];
+    [keyTimes addObject:@((double)i / cycleCount)];
+  }
+  [keyTimes addObject:@1];
+
+  CAKeyframeAnimation *animation = [CAKeyframeAnimation animationWithKeyPath:@"strokeColor"];
+  animation.calculationMode = kCAAnimationDiscrete;
+  animation.duration = cycleCount * _indeterminateLoopCycleDuration;
+  animation.values = values;
+  animation.keyTimes = keyTimes;
+  return animation;
+}
+
+/**
+ Adds every cycle that addStrokeRotationCycle would add, up to the point where they repeat, as one
+ animation per layer that repeats until it is removed.
+ */
+- (void)addIndeterminateLoop {
+  if (_animationInProgress || self.cycleColors.count == 0) {
+    return;
+  }
+
+  MDCActivityIndicatorMotionSpecIndeterminate timing = [self strokeRotationCycleTiming];
+  _indeterminateLoopCycleDuration =
+      MAX(MAX(timing.outerRotation.delay + timing.outerRotation.duration,
+              timing.innerRotation.delay + timing.innerRotation.duration),
+          MAX(timing.strokeStart.delay + timing.strokeStart.duration,
+              timing.strokeEnd.delay + timing.strokeEnd.duration));
+  _indeterminateLoopStartCycle = _cycleCount;
+  _indeterminateLoopStartColorIndex = self.cycleColorsIndex;
+  _indeterminateLoopColorCount = self.cycleColors.count;
+  // Kept in the indicator layer's time so that the loop follows changes to its speed.
+  _indeterminateLoopBeginTime = [self.layer convertTime:CACurrentMediaTime() fromLayer:nil];
+
+  NSUInteger cycleCount = MDCActivityIndicatorLoopCycleCount(_indeterminateLoopColorCount);
+  NSTimeInterval loopDuration = cycleCount * _indeterminateLoopCycleDuration;
+
+  CAAnimation *outerRotation =
+      [self indeterminateLoopAnimationWithKeyPath:MDMKeyPathRotation
+                                           timing:timing.outerRotation
+                                        fromValue:0
+                                   cycleIncrement:kOuterRotationIncrement
+                                            delta:kOuterRotationIncrement
+                                       cycleCount:cycleCount];
+
+  CAAnimationGroup *stroke = [CAAnimationGroup animation];
+  stroke.animations = @[
+    [self indeterminateLoopAnimationWithKeyPath:MDMKeyPathRotation
+                                         timing:timing.innerRotation
+                                      fromValue:0
+                                 cycleIncrement:(CGFloat)M_PI
+                                          delta:kCycleRotation * (CGFloat)M_PI
+                                     cycleCount:cycleCount],
+    [self indeterminateLoopAnimationWithKeyPath:MDMKeyPathStrokeStart
+                                         timing:timing.strokeStart
+                                      fromValue:0
+                                 cycleIncrement:0
+                                          delta:kStrokeLength
+                                     cycleCount:cycleCount],
+    // Ensure the stroke never completely disappears on start by animating from non-zero start and
+    // to a value slightly larger than the strokeStart's final value.
+    [self indeterminateLoopAnimationWithKeyPath:MDMKeyPathStrokeEnd
+                                         timing:timing.strokeEnd
+                                      fromValue:_minStrokeDifference
+                                 cycleIncrement:0
+                                          delta:kStrokeLength
+                                     cycleCount:cycleCount],
+    [self indeterminateLoopColorAnimationWithAlpha:1 cycleCount:cycleCount],
+  ];
+
+  CAAnimation *track = [self indeterminateLoopColorAnimationWithAlpha:(CGFloat)0.3
+                                                           cycleCount:cycleCount];
+
+  NSArray<CALayer *> *layers = @[ _outerRotationLayer, _strokeLayer, _trackLayer ];
+  NSArray<CAAnimation *> *animations = @[ outerRotation, stroke, track ];
+  for (NSUInteger i = 0; i < layers.count; i++) {
+    CAAnimation *animation = animations[i];
+    animation.duration = loopDuration;
+    animation.repeatCount = HUGE_VALF;
+    animation.beginTime = [layers[i] convertTime:_indeterminateLoopBeginTime fromLayer:self.layer];
+    [layers[i] addAnimation:animation forKey:kIndeterminateLoopAnimationKey];
+  }
+
+  _indeterminateLoopAdded = YES;
+  _animationInProgress = YES;
+}
+
+- (void)removeIndeterminateLoop {
+  if (!_indeterminateLoopAdded) {
+    return;
+  }
+
+  _indeterminateLoopAdded = NO;
+  _indeterminateLoopFinishScheduled = NO;
+  // Invalidates any finish that has been scheduled for this loop.
+  _indeterminateLoopGeneration++;
+  // Unlike a cycle added by addStrokeRotationCycle, the loop has no completion block to clear this.
+  _animationInProgress = NO;
+
+  [_outerRotationLayer removeAnimationForKey:kIndeterminateLoopAnimationKey];
+  [_strokeLayer removeAnimationForKey:kIndeterminateLoopAnimationKey];
+  [_trackLayer removeAnimationForKey:kIndeterminateLoopAnimationKey];
+}
+
+/**
+ Replaces the loop with the state the current cycle ends in once it ends, and then carries on the
+ way addStrokeRotationCycle's completion block would. Does nothing if no loop is running.
+ */
+- (void)finishIndeterminateLoopAtEndOfCycle {
+  if (!_indeterminateLoopAdded || _indeterminateLoopFinishScheduled) {
+    return;
+  }
+  _indeterminateLoopFinishScheduled = YES;
+
+  NSTimeInterval cycleDuration = _indeterminateLoopCycleDuration;
+  CFTimeInterval now = CACurrentMediaTime();
+  CFTimeInterval elapsed =
+      MAX([self.layer convertTime:now fromLayer:nil] - _indeterminateLoopBeginTime, 0);
+  NSInteger finishedCycleCount = (NSInteger)floor(elapsed / cycleDuration) + 1;
+  // The cycle ends in the layer's time, which runs at the speed of the layer and its ancestors.
+  CFTimeInterval cycleEndTime = _indeterminateLoopBeginTime + finishedCycleCount * cycleDuration;
+  NSTimeInterval delay = [self.layer convertTime:cycleEndTime toLayer:nil] - now;
+  if (!isfinite(delay)) {
+    // A paused layer never reaches the end of the cycle, so finish it right away.
+    delay = 0;
+  }
+  NSUInteger generation = _indeterminateLoopGeneration;
+
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   if (self->_indeterminateLoopGeneration == generation) {
+                     [self indeterminateLoopDidFinishCycleCount:finishedCycleCount];
+                   }
+                 });
+}
+
+- (void)indeterminateLoopDidFinishCycleCount:(NSInteger)finishedCycleCount {
+  NSInteger lastCycle = _indeterminateLoopStartCycle + finishedCycleCount - 1;
+  NSUInteger lastColorIndex =
+      (_indeterminateLoopStartColorIndex + (NSUInteger)(finishedCycleCount - 1)) %
+      _indeterminateLoopColorCount;
+  [self removeIndeterminateLoop];
+
+  _cycleCount = lastCycle % kTotalDetentCount;
+  self.cycleColorsIndex = lastColorIndex % self.cycleColors.count;
+
+  // Leave the layers as the animator leaves them at the end of addStrokeRotationCycle.
+  [self applyPropertiesWithoutAnimation:^{
+    [self.outerRotationLayer setValue:@(kOuterRotationIncrement * (self.cycleCount + 1))
+                           forKeyPath:MDMKeyPathRotation];
+    [self.strokeLayer setValue:@(self.cycleCount * (CGFloat)M_PI + kCycleRotation * (CGFloat)M_PI)
+                    forKeyPath:MDMKeyPathRotation];
+    self.strokeLayer.strokeStart = kStrokeLength;
+    self.strokeLayer.strokeEnd = kStrokeLength + self.minStrokeDifference;
+    [self updateStrokeColor];
+  }];
+
+  [self strokeRotationCycleFinishedFromState:MDCActivityIndicatorStateIndeterminate];
+}
+
 - (void)addTransitionToIndeterminateCycle {
   if (_animationInProgress) {
     return;
@@ -910,6 +1196,7 @@ static const CGFloat kSingleCycleRotation =
   _animationsAdded = NO;
   _animatingOut = NO;
   self.stopTransition = nil;
+  [self removeIndeterminateLoop];
   [_strokeLayer removeAllAnimations];
   [_outerRotationLayer removeAllAnimations];
 
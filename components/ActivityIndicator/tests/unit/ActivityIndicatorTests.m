@@ -21,6 +21,7 @@ static CGFloat randomNumber() {
 
 @interface MDCActivityIndicator (Private)
 
+@property(nonatomic, strong, readonly, nullable) CALayer *outerRotationLayer;
 @property(nonatomic, strong, readonly, nullable) CAShapeLayer *strokeLayer;
 
 @end
@@ -183,6 +184,46 @@ static CGFloat randomNumber() {
   XCTAssertTrue(self.indicator.trackEnabled);
 }
 
+- (void)testPrecomputesIndeterminateLoopDefaultsToNo {
+  // Then
+  XCTAssertFalse(self.indicator.precomputesIndeterminateLoop);
+}
+
+- (void)testPrecomputedIndeterminateLoopRepeatsIndefinitely {
+  // Given
+  UIWindow *window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  [window addSubview:self.indicator];
+  self.indicator.precomputesIndeterminateLoop = YES;
+
+  // When
+  [self.indicator startAnimating];
+
+  // Then
+  for (CALayer *layer in @[ self.indicator.outerRotationLayer, self.indicator.strokeLayer ]) {
+    XCTAssertEqual(layer.animationKeys.count, 1U);
+    CAAnimation *animation = [layer animationForKey:layer.animationKeys.firstObject];
+    XCTAssertEqual(animation.repeatCount, HUGE_VALF);
+    // Five cycle positions times four default colors.
+    XCTAssertEqualWithAccuracy(animation.duration, 20 * 4.0 / 3.0, 0.001);
+  }
+}
+
+- (void)testStoppingRemovesPrecomputedIndeterminateLoop {
+  // Given
+  UIWindow *window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  [window addSubview:self.indicator];
+  self.indicator.precomputesIndeterminateLoop = YES;
+  [self.indicator startAnimating];
+
+  // When
+  [self.indicator removeFromSuperview];
+
+  // Then
+  XCTAssertEqual(self.indicator.outerRotationLayer.animationKeys.count, 0U);
+  XCTAssertEqual(self.indicator.strokeLayer.animationKeys.count, 0U);
+  XCTAssertTrue(self.indicator.animating);
+}
+
 - (void)testDefaultStrokeWidth {
   // Then
   XCTAssertEqualWithAccuracy(self.indicator.strokeWidth, 2.5, 0.001);
@@ -36,9 +36,7 @@
 #import "MDCFontTextStyle.h"
 #import "UIFont+MaterialTypography.h"
 #import "MDCMath.h"
-
-// KVO context
-static char *const kKVOContextMDCBottomNavigationBar = "kKVOContextMDCBottomNavigationBar";
+#import "MDCTabBarItemObserver.h"
 
 static const CGFloat kMinItemWidth = 80;
 static const CGFloat kPreferredItemWidth = 120;
@@ -68,6 +66,7 @@ static const CGFloat kDefaultActiveIndicatorWidth = 60;
 @property(nonatomic, strong) NSMutableArray *inkControllers;
 @property(nonatomic, strong) UILayoutGuide *barItemsLayoutGuide NS_AVAILABLE_IOS(9_0);
 @property(nonatomic, assign) BOOL enableRippleBehavior;
+@property(nonatomic, strong) MDCTabBarItemObserver *itemObserver;
 
 // Selection indicator
 @property(nonatomic, assign) BOOL showsSelectionIndicator;
@@ -378,120 +377,111 @@ static BOOL gEnablePerformantShadow = NO;
   }
 }
 
-- (void)dealloc {
-  [self removeObserversFromTabBarItems];
+/**
+ Returns the view of the item at @c itemIndex, or nil if the item views are out of sync with the
+ items.
+ */
+static MDCBottomNavigationItemView *_Nullable MDCBottomNavigationBarItemViewAtIndex(
+    MDCBottomNavigationBar *bottomNavigationBar, NSUInteger itemIndex) {
+  NSArray<MDCBottomNavigationItemView *> *itemViews = bottomNavigationBar.itemViews;
+  return itemIndex < itemViews.count ? itemViews[itemIndex] : nil;
 }
 
-- (NSArray<NSString *> *)kvoKeyPaths {
-  static NSArray<NSString *> *keyPaths;
+/** Maps each observed UITabBarItem key path to the item view property it updates. */
++ (NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *)itemPropertyHandlers {
+  static NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *handlers;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    keyPaths = @[
-      NSStringFromSelector(@selector(badgeColor)),
-      NSStringFromSelector(@selector(badgeValue)),
-      NSStringFromSelector(@selector(title)),
-      NSStringFromSelector(@selector(image)),
-      NSStringFromSelector(@selector(selectedImage)),
-      NSStringFromSelector(@selector(accessibilityValue)),
-      NSStringFromSelector(@selector(accessibilityLabel)),
-      NSStringFromSelector(@selector(accessibilityHint)),
-      NSStringFromSelector(@selector(accessibilityIdentifier)),
-      NSStringFromSelector(@selector(isAccessibilityElement)),
-      NSStringFromSelector(@selector(titlePositionAdjustment)),
-      NSStringFromSelector(@selector(largeContentSizeImage)),
-      NSStringFromSelector(@selector(largeContentSizeImageInsets)),
-      NSStringFromSelector(@selector(tag)),
-    ];
+    NSMutableDictionary<NSString *, MDCTabBarItemPropertyHandler> *mutableHandlers =
+        [NSMutableDictionary dictionary];
+    mutableHandlers[NSStringFromSelector(@selector(badgeColor))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).badgeColor = item.badgeColor;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(badgeValue))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).badgeText = item.badgeValue;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(title))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).title = item.title;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(image))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).image = item.image;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(selectedImage))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).selectedImage =
+              item.selectedImage;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityValue))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).accessibilityValue =
+              item.accessibilityValue;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityLabel))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).accessibilityLabel =
+              item.accessibilityLabel;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityHint))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).accessibilityHint =
+              item.accessibilityHint;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityIdentifier))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).accessibilityElementIdentifier =
+              item.accessibilityIdentifier;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(isAccessibilityElement))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).isAccessibilityElement =
+              item.isAccessibilityElement;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(titlePositionAdjustment))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).titlePositionAdjustment =
+              item.titlePositionAdjustment;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(largeContentSizeImage))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          if (@available(iOS 13.0, *)) {
+            MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).largeContentImage =
+                item.largeContentSizeImage;
+          }
+        };
+    mutableHandlers[NSStringFromSelector(@selector(largeContentSizeImageInsets))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+          if (@available(iOS 13.0, *)) {
+            MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).largeContentImageInsets =
+                item.largeContentSizeImageInsets;
+          }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+        };
+    mutableHandlers[NSStringFromSelector(@selector(tag))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCBottomNavigationBarItemViewAtIndex(owner, itemIndex).tag = item.tag;
+        };
+    handlers = [mutableHandlers copy];
   });
-  return keyPaths;
-}
-
-- (void)addObserversToTabBarItems {
-  NSArray<NSString *> *keyPaths = [self kvoKeyPaths];
-  for (UITabBarItem *item in self.items) {
-    for (NSString *keyPath in keyPaths) {
-      [item addObserver:self
-             forKeyPath:keyPath
-                options:NSKeyValueObservingOptionNew
-                context:kKVOContextMDCBottomNavigationBar];
-    }
-  }
-}
-
-- (void)removeObserversFromTabBarItems {
-  NSArray<NSString *> *keyPaths = [self kvoKeyPaths];
-  for (UITabBarItem *item in self.items) {
-    for (NSString *keyPath in keyPaths) {
-      @try {
-        [item removeObserver:self forKeyPath:keyPath context:kKVOContextMDCBottomNavigationBar];
-      } @catch (NSException *exception) {
-        if (exception) {
-          // No need to do anything if there are no observers.
-        }
-      }
-    }
-  }
+  return handlers;
 }
 
-- (void)observeValueForKeyPath:(NSString *)keyPath
-                      ofObject:(id)object
-                        change:(NSDictionary<NSKeyValueChangeKey, id> *)change
-                       context:(void *)context {
-  if (context == kKVOContextMDCBottomNavigationBar) {
-    if (!object) {
-      return;
-    }
-    NSUInteger itemIndex = [self.items indexOfObject:object];
-    if (itemIndex == NSNotFound || itemIndex >= _itemViews.count) {
-      return;
-    }
-    id newValue = [object valueForKey:keyPath];
-    if (newValue == [NSNull null]) {
-      newValue = nil;
-    }
-
-    MDCBottomNavigationItemView *itemView = _itemViews[itemIndex];
-    if ([keyPath isEqualToString:NSStringFromSelector(@selector(badgeColor))]) {
-      itemView.badgeColor = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(accessibilityValue))]) {
-      itemView.accessibilityValue = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(badgeValue))]) {
-      itemView.badgeText = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(image))]) {
-      itemView.image = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(selectedImage))]) {
-      itemView.selectedImage = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(title))]) {
-      itemView.title = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(accessibilityIdentifier))]) {
-      itemView.accessibilityElementIdentifier = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(accessibilityLabel))]) {
-      itemView.accessibilityLabel = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(accessibilityHint))]) {
-      itemView.accessibilityHint = newValue;
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(isAccessibilityElement))]) {
-      itemView.isAccessibilityElement = [newValue boolValue];
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(titlePositionAdjustment))]) {
-      itemView.titlePositionAdjustment = [newValue UIOffsetValue];
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(largeContentSizeImage))]) {
-      if (@available(iOS 13.0, *)) {
-        itemView.largeContentImage = newValue;
-      }
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(tag))]) {
-      itemView.tag = [newValue integerValue];
-    }
-#if MDC_AVAILABLE_SDK_IOS(13_0)
-    else if ([keyPath
-                 isEqualToString:NSStringFromSelector(@selector(largeContentSizeImageInsets))]) {
-      if (@available(iOS 13.0, *)) {
-        itemView.largeContentImageInsets = [newValue UIEdgeInsetsValue];
-      }
-    }
-#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
-  } else {
-    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+- (MDCTabBarItemObserver *)itemObserver {
+  if (!_itemObserver) {
+    // Item changes are applied to the item views as they happen, and the bar lays out once at the
+    // end of the run loop turn however many items changed.
+    _itemObserver = [[MDCTabBarItemObserver alloc]
+           initWithOwner:self
+        propertyHandlers:[MDCBottomNavigationBar itemPropertyHandlers]
+            flushHandler:^(id owner) {
+              [(MDCBottomNavigationBar *)owner layoutIfNeeded];
+            }];
   }
-  [self layoutIfNeeded];
+  return _itemObserver;
 }
 
 - (UIEdgeInsets)mdc_safeAreaInsets {
@@ -499,7 +489,7 @@ static BOOL gEnablePerformantShadow = NO;
 }
 
 - (UIView *)viewForItem:(UITabBarItem *)item {
-  NSUInteger itemIndex = [_items indexOfObject:item];
+  NSUInteger itemIndex = [self.itemObserver indexOfItem:item];
   if (itemIndex == NSNotFound) {
     return nil;
   }
@@ -587,9 +577,9 @@ static BOOL gEnablePerformantShadow = NO;
   if (!self.inkControllers) {
     _inkControllers = [@[] mutableCopy];
   }
-  [self removeObserversFromTabBarItems];
 
   _items = [items copy];
+  self.itemObserver.items = _items;
 
   for (NSUInteger i = 0; i < items.count; i++) {
     UITabBarItem *item = items[i];
@@ -678,7 +668,6 @@ static BOOL gEnablePerformantShadow = NO;
     [self.itemsLayoutView addSubview:itemView];
   }
   self.selectedItem = nil;
-  [self addObserversToTabBarItems];
   [self invalidateIntrinsicContentSize];
   [self setNeedsLayout];
 }
@@ -122,6 +122,12 @@ static NSAttributedString *UppercaseAttributedString(NSAttributedString *string)
 
   MDCShapeMediator *_shapedLayer;
   CGFloat _currentElevation;
+
+  // The last shadow path built by updateBoundingShadowPath and the inputs it was built from.
+  UIBezierPath *_boundingShadowPath;
+  CGRect _boundingShadowPathBounds;
+  CGFloat _boundingShadowPathCornerRadius;
+  CACornerMask _boundingShadowPathMaskedCorners;
 }
 @property(nonatomic, strong, readonly, nonnull) MDCStatefulRippleView *rippleView;
 #pragma clang diagnostic push
@@ -348,7 +354,7 @@ static BOOL gEnablePerformantShadow = NO;
     [self updateShadow];
   } else {
     if (!self.layer.shapeGenerator) {
-      self.layer.shadowPath = [self boundingPath].CGPath;
+      [self updateBoundingShadowPath];
     }
   }
 
@@ -1048,6 +1054,25 @@ static BOOL gEnablePerformantShadow = NO;
   [_inkView startTouchEndedAnimationAtPoint:toPoint completion:nil];
 }
 
+// Setting shadowPath, even to an equal path, invalidates the layer's shadow, so the bounding path
+// is only rebuilt and set when its inputs change or the layer's shadowPath was replaced.
+- (void)updateBoundingShadowPath {
+  CGRect bounds = self.bounds;
+  CGFloat cornerRadius = self.layer.cornerRadius;
+  CACornerMask maskedCorners = self.layer.maskedCorners;
+  if (_boundingShadowPath && self.layer.shadowPath == _boundingShadowPath.CGPath &&
+      CGRectEqualToRect(_boundingShadowPathBounds, bounds) &&
+      _boundingShadowPathCornerRadius == cornerRadius &&
+      _boundingShadowPathMaskedCorners == maskedCorners) {
+    return;
+  }
+  _boundingShadowPath = [self boundingPath];
+  _boundingShadowPathBounds = bounds;
+  _boundingShadowPathCornerRadius = cornerRadius;
+  _boundingShadowPathMaskedCorners = maskedCorners;
+  self.layer.shadowPath = _boundingShadowPath.CGPath;
+}
+
 - (UIBezierPath *)boundingPath {
   CGSize cornerRadii = CGSizeMake(self.layer.cornerRadius, self.layer.cornerRadius);
   return [UIBezierPath bezierPathWithRoundedRect:self.bounds
@@ -16,8 +16,11 @@
 
 #import "MDCChipViewDeleteButton.h"
 
+#import "MaterialIcons.h"
+
 static const CGFloat MDCChipFieldClearButtonSquareWidthHeight = 24.0f;
 static const CGFloat MDCChipFieldClearImageSquareWidthHeight = 18.0f;
+static NSString *const kClearIconName = @"MDCChipViewDeleteButtonClear";
 
 @implementation MDCChipViewDeleteButton
 
@@ -67,18 +70,19 @@ static const CGFloat MDCChipFieldClearImageSquareWidthHeight = 18.0f;
 }
 
 - (UIImage *)drawClearButton {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    [MDCIcons registerProceduralIconNamed:kClearIconName
+                             pathProvider:^UIBezierPath *(CGRect frame) {
+                               return MDCPathForClearButtonImageFrame(frame);
+                             }];
+  });
   CGSize clearButtonSize =
       CGSizeMake(MDCChipFieldClearImageSquareWidthHeight, MDCChipFieldClearImageSquareWidthHeight);
-
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  return [MDCIcons templateImageForProceduralIconNamed:kClearIconName
+                                                  size:clearButtonSize
+                                               opacity:1
+                                                 scale:0];
 }
 
 static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
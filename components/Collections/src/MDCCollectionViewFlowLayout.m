@@ -30,6 +30,33 @@ NSString *const kCollectionGridDecorationView = @"MDCCollectionGridDecorationVie
 
 static const NSInteger kSupplementaryViewZIndex = 99;
 
+/** The most styled attributes kept per element kind before the cache is emptied. */
+static const NSUInteger kMaxStyledAttributesCount = 2048;
+
+/**
+ The styler and editor state that styled layout attributes are derived from. Styled attributes
+ cached under one state are discarded when the layout is queried under a different one.
+ */
+@interface MDCCollectionViewStyleState : NSObject
+
+- (instancetype)initWithStyler:(id<MDCCollectionViewStyling>)styler
+                        editor:(id<MDCCollectionViewEditing>)editor;
+
+- (BOOL)matchesStyler:(id<MDCCollectionViewStyling>)styler
+               editor:(id<MDCCollectionViewEditing>)editor;
+
+@end
+
+/** Styled layout attributes along with the inputs they were styled from. */
+@interface MDCCollectionViewStyledAttributes : NSObject
+
+@property(nonatomic, strong) MDCCollectionViewLayoutAttributes *attributes;
+@property(nonatomic, assign) CGRect baseFrame;
+@property(nonatomic, assign) BOOL hasSectionHeader;
+@property(nonatomic, assign) BOOL hasSectionFooter;
+
+@end
+
 @implementation MDCCollectionViewFlowLayout {
   NSMutableArray<NSIndexPath *> *_deletedIndexPaths;
   NSMutableArray<NSIndexPath *> *_insertedIndexPaths;
@@ -38,6 +65,14 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   NSMutableIndexSet *_headerSections;
   NSMutableIndexSet *_footerSections;
   NSMutableDictionary *_decorationViewAttributeCache;
+
+  // Styled attributes for cells, section headers and section footers, keyed by index path. Entries
+  // are reused across queries until the layout is invalidated, the style state changes, or the
+  // attributes from super no longer match the ones they were styled from.
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *_styledItemAttributes;
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *_styledHeaderAttributes;
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *_styledFooterAttributes;
+  MDCCollectionViewStyleState *_styledAttributesState;
 }
 
 - (instancetype)init {
@@ -66,6 +101,9 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
   // Register decoration view for grid background.
   _decorationViewAttributeCache = [NSMutableDictionary dictionary];
+  _styledItemAttributes = [NSMutableDictionary dictionary];
+  _styledHeaderAttributes = [NSMutableDictionary dictionary];
+  _styledFooterAttributes = [NSMutableDictionary dictionary];
   [self registerClass:[MDCCollectionGridBackgroundView class]
       forDecorationViewOfKind:kCollectionGridDecorationView];
 }
@@ -95,16 +133,18 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   // If performing appearance animation, increase bounds height in order to retrieve additional
   // offscreen attributes needed during animation.
   rect = [self boundsForAppearanceAnimationWithInitialBounds:rect];
-  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes =
-      [[NSMutableArray alloc] initWithArray:[super layoutAttributesForElementsInRect:rect]
-                                  copyItems:YES];
+  NSArray<__kindof UICollectionViewLayoutAttributes *> *baseAttributes =
+      [super layoutAttributesForElementsInRect:rect];
 
   // Store index path sections of any headers/footers within these attributes.
-  [self storeSupplementaryViewsWithAttributes:attributes];
+  [self storeSupplementaryViewsWithAttributes:baseAttributes];
 
-  // Set layout attributes.
-  for (MDCCollectionViewLayoutAttributes *attr in attributes) {
-    [self updateAttribute:attr];
+  // Set layout attributes, reusing previously styled attributes where possible.
+  [self validateStyledAttributes];
+  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes =
+      [[NSMutableArray alloc] initWithCapacity:baseAttributes.count];
+  for (UICollectionViewLayoutAttributes *baseAttr in baseAttributes) {
+    [attributes addObject:[self styledAttributeForAttribute:baseAttr]];
   }
 
   // Add info bar header/footer supplementary view if necessary.
@@ -138,6 +178,31 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   [_decorationViewAttributeCache removeAllObjects];
 }
 
+- (void)invalidateLayoutWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+  [super invalidateLayoutWithContext:context];
+
+  BOOL invalidatesFlowLayout = NO;
+  if ([context isKindOfClass:[UICollectionViewFlowLayoutInvalidationContext class]]) {
+    UICollectionViewFlowLayoutInvalidationContext *flowContext =
+        (UICollectionViewFlowLayoutInvalidationContext *)context;
+    invalidatesFlowLayout = flowContext.invalidateFlowLayoutAttributes ||
+                            flowContext.invalidateFlowLayoutDelegateMetrics;
+  }
+  if (context.invalidateEverything || context.invalidateDataSourceCounts || invalidatesFlowLayout) {
+    [self removeAllStyledAttributes];
+    return;
+  }
+
+  // Only drop the styled attributes of the elements named by the context.
+  [_styledItemAttributes removeObjectsForKeys:context.invalidatedItemIndexPaths ?: @[]];
+  NSDictionary<NSString *, NSArray<NSIndexPath *> *> *supplementaryIndexPaths =
+      context.invalidatedSupplementaryIndexPaths;
+  [_styledHeaderAttributes
+      removeObjectsForKeys:supplementaryIndexPaths[UICollectionElementKindSectionHeader] ?: @[]];
+  [_styledFooterAttributes
+      removeObjectsForKeys:supplementaryIndexPaths[UICollectionElementKindSectionFooter] ?: @[]];
+}
+
 #pragma mark - UICollectionViewLayout (UISubclassingHooks)
 
 + (Class)layoutAttributesClass {
@@ -145,9 +210,12 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 }
 
 - (UICollectionViewLayoutAttributes *)layoutAttributesForItemAtIndexPath:(NSIndexPath *)indexPath {
-  UICollectionViewLayoutAttributes *attr =
-      [[super layoutAttributesForItemAtIndexPath:indexPath] copy];
-  return [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
+  UICollectionViewLayoutAttributes *baseAttr = [super layoutAttributesForItemAtIndexPath:indexPath];
+  if (!baseAttr) {
+    return nil;
+  }
+  [self validateStyledAttributes];
+  return [self styledAttributeForAttribute:baseAttr];
 }
 
 - (UICollectionViewLayoutAttributes *)layoutAttributesForSupplementaryViewOfKind:(NSString *)kind
@@ -158,13 +226,17 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   if ([kind isEqualToString:UICollectionElementKindSectionHeader] ||
       [kind isEqualToString:UICollectionElementKindSectionFooter]) {
     // Update section headers/Footers attributes.
-    attr = [[super layoutAttributesForSupplementaryViewOfKind:kind atIndexPath:indexPath] copy];
-    if (!attr) {
+    UICollectionViewLayoutAttributes *baseAttr =
+        [super layoutAttributesForSupplementaryViewOfKind:kind atIndexPath:indexPath];
+    if (baseAttr) {
+      [self validateStyledAttributes];
+      attr = [self styledAttributeForAttribute:baseAttr];
+    } else {
       attr =
           [MDCCollectionViewLayoutAttributes layoutAttributesForSupplementaryViewOfKind:kind
                                                                           withIndexPath:indexPath];
+      [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
     }
-    [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
 
   } else {
     // Update editing info bar attributes.
@@ -236,6 +308,9 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
 - (void)prepareForCollectionViewUpdates:(NSArray<UICollectionViewUpdateItem *> *)updateItems {
   [super prepareForCollectionViewUpdates:updateItems];
+  // Inserted, deleted and moved elements shift the index paths and ordinal positions of their
+  // neighbors.
+  [self removeAllStyledAttributes];
   _deletedIndexPaths = [NSMutableArray array];
   _insertedIndexPaths = [NSMutableArray array];
   _deletedSections = [NSMutableIndexSet indexSet];
@@ -337,8 +412,13 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
 - (void)storeSupplementaryViewsWithAttributes:
     (NSArray<__kindof UICollectionViewLayoutAttributes *> *)attributes {
-  _headerSections = [NSMutableIndexSet indexSet];
-  _footerSections = [NSMutableIndexSet indexSet];
+  if (_headerSections) {
+    [_headerSections removeAllIndexes];
+    [_footerSections removeAllIndexes];
+  } else {
+    _headerSections = [NSMutableIndexSet indexSet];
+    _footerSections = [NSMutableIndexSet indexSet];
+  }
 
   // Store index path sections for headers/footers.
   for (MDCCollectionViewLayoutAttributes *attr in attributes) {
@@ -350,6 +430,85 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   }
 }
 
+#pragma mark - Styled Attribute Caching
+
+- (void)removeAllStyledAttributes {
+  [_styledItemAttributes removeAllObjects];
+  [_styledHeaderAttributes removeAllObjects];
+  [_styledFooterAttributes removeAllObjects];
+}
+
+/** Discards all styled attributes if the styler or editor state changed since they were made. */
+- (void)validateStyledAttributes {
+  id<MDCCollectionViewStyling> styler = self.styler;
+  id<MDCCollectionViewEditing> editor = self.editor;
+  if (_styledAttributesState && [_styledAttributesState matchesStyler:styler editor:editor]) {
+    return;
+  }
+  [self removeAllStyledAttributes];
+  _styledAttributesState = [[MDCCollectionViewStyleState alloc] initWithStyler:styler
+                                                                        editor:editor];
+}
+
+- (NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *)
+    styledAttributesForElementWithAttribute:(UICollectionViewLayoutAttributes *)attr {
+  // Appearance animations offset and delay attributes after they are styled, so they can't be
+  // shared between queries.
+  if (self.styler.shouldAnimateCellsOnAppearance) {
+    return nil;
+  }
+  if (attr.representedElementCategory == UICollectionElementCategoryCell) {
+    return _styledItemAttributes;
+  }
+  if (attr.representedElementCategory == UICollectionElementCategorySupplementaryView) {
+    NSString *kind = attr.representedElementKind;
+    if ([kind isEqualToString:UICollectionElementKindSectionHeader]) {
+      return _styledHeaderAttributes;
+    } else if ([kind isEqualToString:UICollectionElementKindSectionFooter]) {
+      return _styledFooterAttributes;
+    }
+  }
+  return nil;
+}
+
+/**
+ Returns a styled copy of the given attributes from super, reusing the cached copy when it was
+ styled from the same frame and section header/footer state.
+ */
+- (MDCCollectionViewLayoutAttributes *)styledAttributeForAttribute:
+    (UICollectionViewLayoutAttributes *)baseAttr {
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *styledAttributes =
+      [self styledAttributesForElementWithAttribute:baseAttr];
+  if (!styledAttributes) {
+    return [self updateAttribute:(MDCCollectionViewLayoutAttributes *)[baseAttr copy]];
+  }
+
+  NSIndexPath *indexPath = baseAttr.indexPath;
+  BOOL hasSectionHeader = [_headerSections containsIndex:indexPath.section];
+  BOOL hasSectionFooter = [_footerSections containsIndex:indexPath.section];
+  MDCCollectionViewStyledAttributes *entry = styledAttributes[indexPath];
+  if (entry && entry.hasSectionHeader == hasSectionHeader &&
+      entry.hasSectionFooter == hasSectionFooter &&
+      CGRectEqualToRect(entry.baseFrame, baseAttr.frame)) {
+    return entry.attributes;
+  }
+
+  MDCCollectionViewLayoutAttributes *attr =
+      [self updateAttribute:(MDCCollectionViewLayoutAttributes *)[baseAttr copy]];
+  if (!entry) {
+    if (styledAttributes.count >= kMaxStyledAttributesCount) {
+      [styledAttributes removeAllObjects];
+    }
+    entry = [[MDCCollectionViewStyledAttributes alloc] init];
+    styledAttributes[indexPath] = entry;
+  }
+  entry.attributes = attr;
+  entry.baseFrame = baseAttr.frame;
+  entry.hasSectionHeader = hasSectionHeader;
+  entry.hasSectionFooter = hasSectionFooter;
+  return attr;
+}
+
 #pragma mark - Private
 
 - (MDCCollectionViewLayoutAttributes *)updateAttribute:(MDCCollectionViewLayoutAttributes *)attr {
@@ -807,3 +966,71 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 }
 
 @end
+
+@implementation MDCCollectionViewStyleState {
+  __weak id<MDCCollectionViewStyling> _styler;
+  __weak id<MDCCollectionViewEditing> _editor;
+  MDCCollectionViewCellLayoutType _cellLayoutType;
+  MDCCollectionViewCellStyle _cellStyle;
+  NSInteger _gridColumnCount;
+  CGFloat _gridPadding;
+  UIColor *_cellBackgroundColor;
+  CGFloat _cardBorderRadius;
+  UIColor *_separatorColor;
+  UIEdgeInsets _separatorInset;
+  CGFloat _separatorLineHeight;
+  BOOL _shouldHideSeparators;
+  BOOL _editing;
+  NSInteger _dismissingSection;
+  NSIndexPath *_dismissingCellIndexPath;
+  NSIndexPath *_reorderingCellIndexPath;
+}
+
+- (instancetype)initWithStyler:(id<MDCCollectionViewStyling>)styler
+                        editor:(id<MDCCollectionViewEditing>)editor {
+  self = [super init];
+  if (self) {
+    _styler = styler;
+    _editor = editor;
+    _cellLayoutType = styler.cellLayoutType;
+    _cellStyle = styler.cellStyle;
+    _gridColumnCount = styler.gridColumnCount;
+    _gridPadding = styler.gridPadding;
+    _cellBackgroundColor = styler.cellBackgroundColor;
+    _cardBorderRadius = styler.cardBorderRadius;
+    _separatorColor = styler.separatorColor;
+    _separatorInset = styler.separatorInset;
+    _separatorLineHeight = styler.separatorLineHeight;
+    _shouldHideSeparators = styler.shouldHideSeparators;
+    _editing = editor.isEditing;
+    _dismissingSection = editor.dismissingSection;
+    _dismissingCellIndexPath = editor.dismissingCellIndexPath;
+    _reorderingCellIndexPath = editor.reorderingCellIndexPath;
+  }
+  return self;
+}
+
+- (BOOL)matchesStyler:(id<MDCCollectionViewStyling>)styler
+               editor:(id<MDCCollectionViewEditing>)editor {
+  return _styler == styler && _editor == editor && _cellLayoutType == styler.cellLayoutType &&
+         _cellStyle == styler.cellStyle && _gridColumnCount == styler.gridColumnCount &&
+         _gridPadding == styler.gridPadding &&
+         (_cellBackgroundColor == styler.cellBackgroundColor ||
+          [_cellBackgroundColor isEqual:styler.cellBackgroundColor]) &&
+         _cardBorderRadius == styler.cardBorderRadius &&
+         (_separatorColor == styler.separatorColor ||
+          [_separatorColor isEqual:styler.separatorColor]) &&
+         UIEdgeInsetsEqualToEdgeInsets(_separatorInset, styler.separatorInset) &&
+         _separatorLineHeight == styler.separatorLineHeight &&
+         _shouldHideSeparators == styler.shouldHideSeparators && _editing == editor.isEditing &&
+         _dismissingSection == editor.dismissingSection &&
+         (_dismissingCellIndexPath == editor.dismissingCellIndexPath ||
+          [_dismissingCellIndexPath isEqual:editor.dismissingCellIndexPath]) &&
+         (_reorderingCellIndexPath == editor.reorderingCellIndexPath ||
+          [_reorderingCellIndexPath isEqual:editor.reorderingCellIndexPath]);
+}
+
+@end
+
+@implementation MDCCollectionViewStyledAttributes
+@end
@@ -0,0 +1,69 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/** The shape of a drawn cell background. */
+typedef NS_OPTIONS(NSUInteger, MDCCollectionViewCellBackgroundOptions) {
+  MDCCollectionViewCellBackgroundOptionsFlat = 0,
+  MDCCollectionViewCellBackgroundOptionsTop = 1 << 0,
+  MDCCollectionViewCellBackgroundOptionsBottom = 1 << 1,
+  MDCCollectionViewCellBackgroundOptionsCard = 1 << 2,
+  MDCCollectionViewCellBackgroundOptionsGrouped = 1 << 3,
+  MDCCollectionViewCellBackgroundOptionsHighlighted = 1 << 4,
+};
+
+/** The width of the shadow drawn around card and grouped cell backgrounds. */
+FOUNDATION_EXTERN const CGFloat MDCCollectionViewCellBackgroundShadowWidth;
+
+/**
+ Returns the resizable cell background image for the given options, background color, card border
+ radius and scale.
+
+ Images are shared by every styler in the process. An image is only drawn the first time its
+ inputs are requested; the other top/bottom variants of the same style are then drawn on a
+ background queue so that neighboring cells find them ready.
+
+ @param options The shape of the background.
+ @param backgroundColor The fill color. Dynamic colors must already be resolved.
+ @param borderRadius The corner radius of card backgrounds. Ignored for other styles.
+ @param scale The scale to draw the image at, usually the main screen's scale.
+ */
+FOUNDATION_EXTERN UIImage *_Nonnull MDCCollectionViewCellBackgroundImage(
+    MDCCollectionViewCellBackgroundOptions options,
+    UIColor *_Nonnull backgroundColor,
+    CGFloat borderRadius,
+    CGFloat scale);
+
+/**
+ The number of @c MDCCollectionViewCellBackgroundImage calls served from the shared cache since
+ launch or the last call to @c MDCCollectionViewCellBackgroundImageResetCounts.
+ */
+FOUNDATION_EXTERN NSUInteger MDCCollectionViewCellBackgroundImageHitCount(void);
+
+/**
+ The number of @c MDCCollectionViewCellBackgroundImage calls that had to draw their image, since
+ launch or the last call to @c MDCCollectionViewCellBackgroundImageResetCounts.
+ */
+FOUNDATION_EXTERN NSUInteger MDCCollectionViewCellBackgroundImageMissCount(void);
+
+/**
+ Resets the cell background image hit and miss counters to zero.
+ */
+FOUNDATION_EXTERN void MDCCollectionViewCellBackgroundImageResetCounts(void);
+
+/**
+ Empties the shared cell background image cache.
+ */
+FOUNDATION_EXTERN void MDCCollectionViewCellBackgroundImageRemoveAllImages(void);
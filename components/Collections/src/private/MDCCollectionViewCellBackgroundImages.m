@@ -0,0 +1,378 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCCollectionViewCellBackgroundImages.h"
+
+#include <tgmath.h>
+
+const CGFloat MDCCollectionViewCellBackgroundShadowWidth = 1;
+
+/** The drawn cell background */
+static const CGSize kCellImageSize = {44, 44};
+static const CGFloat kCollectionViewCellDefaultBorderWidth = 1;
+static inline UIColor *kCollectionViewCellDefaultBorderColor() {
+  return [UIColor colorWithWhite:0 alpha:(CGFloat)0.05];
+}
+
+/** Cell shadowing */
+static inline CGSize kCollectionViewCellDefaultShadowOffset() {
+  return CGSizeMake(0, 1);
+}
+static inline UIColor *kCollectionViewCellDefaultShadowColor() {
+  return [UIColor colorWithWhite:0 alpha:(CGFloat)0.1];
+}
+
+/** The most background images kept alive by the shared cache. */
+static const NSUInteger kMaxCachedBackgroundImages = 256;
+
+/** Modifies only the right and bottom edges of a CGRect. */
+NS_INLINE CGRect RectContract(CGRect rect, CGFloat dx, CGFloat dy) {
+  return CGRectMake(rect.origin.x, rect.origin.y, rect.size.width - dx, rect.size.height - dy);
+}
+
+/** Modifies only the top and left edges of a CGRect. */
+NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
+  return CGRectOffset(RectContract(rect, dx, dy), dx, dy);
+}
+
+/**
+ Every input that affects a drawn cell background. The border and shadow colors and metrics are
+ constants of this file, so they are not part of the key.
+ */
+@interface MDCCollectionViewCellBackgroundKey : NSObject <NSCopying>
+
+@property(nonatomic, readonly) MDCCollectionViewCellBackgroundOptions options;
+@property(nonatomic, readonly) UIColor *backgroundColor;
+@property(nonatomic, readonly) CGFloat borderRadius;
+@property(nonatomic, readonly) CGFloat scale;
+
+- (instancetype)initWithOptions:(MDCCollectionViewCellBackgroundOptions)options
+                backgroundColor:(UIColor *)backgroundColor
+                   borderRadius:(CGFloat)borderRadius
+                          scale:(CGFloat)scale;
+
+@end
+
+@implementation MDCCollectionViewCellBackgroundKey
+
+- (instancetype)initWithOptions:(MDCCollectionViewCellBackgroundOptions)options
+                backgroundColor:(UIColor *)backgroundColor
+                   borderRadius:(CGFloat)borderRadius
+                          scale:(CGFloat)scale {
+  self = [super init];
+  if (self) {
+    _options = options;
+    _backgroundColor = backgroundColor;
+    // Only card backgrounds have rounded corners.
+    _borderRadius = (options & MDCCollectionViewCellBackgroundOptionsCard) ? borderRadius : 0;
+    _scale = scale;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCCollectionViewCellBackgroundKey class]]) {
+    return NO;
+  }
+  MDCCollectionViewCellBackgroundKey *other = (MDCCollectionViewCellBackgroundKey *)object;
+  return _options == other->_options && _borderRadius == other->_borderRadius &&
+         _scale == other->_scale && [_backgroundColor isEqual:other->_backgroundColor];
+}
+
+- (NSUInteger)hash {
+  return _options ^ (_backgroundColor.hash << 5) ^ (NSUInteger)(_borderRadius * 1000) ^
+         ((NSUInteger)_scale << 8);
+}
+
+@end
+
+#pragma mark - Drawing
+
+static void ApplyBackgroundPathToContext(CGContextRef c,
+                                         CGRect rect,
+                                         BOOL isTop,
+                                         BOOL isBottom,
+                                         BOOL isCard,
+                                         CGFloat borderRadius,
+                                         CGFloat scale) {
+  // Draw background paths for cell.
+  CGFloat minPixelOffset = (isCard) ? 1 / scale : 0;
+  CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
+  CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
+  CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
+  CGFloat minY = CGRectGetMinY(rect) - minPixelOffset;
+  CGFloat midY = CGRectGetMidY(rect) - minPixelOffset;
+  CGFloat maxY = CGRectGetMaxY(rect) + minPixelOffset;
+
+  CGContextBeginPath(c);
+
+  CGContextMoveToPoint(c, minX, midY);
+  if (isTop && isCard) {
+    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
+    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
+  } else {
+    CGContextAddLineToPoint(c, minX, minY);
+    CGContextAddLineToPoint(c, maxX, minY);
+  }
+
+  CGContextAddLineToPoint(c, maxX, midY);
+
+  if (isBottom & isCard) {
+    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
+    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
+  } else {
+    CGContextAddLineToPoint(c, maxX, maxY);
+    CGContextAddLineToPoint(c, minX, maxY);
+  }
+  CGContextAddLineToPoint(c, minX, midY);
+
+  CGContextClosePath(c);
+}
+
+static void ApplyBorderPathToContext(CGContextRef c,
+                                     CGRect rect,
+                                     BOOL isTop,
+                                     BOOL isBottom,
+                                     BOOL isCard,
+                                     CGFloat borderRadius,
+                                     CGFloat scale) {
+  // Draw border paths for cell.
+  CGFloat minPixelOffset = (isCard) ? 1 / scale : 0;
+  CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
+  CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
+  CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
+  CGFloat minY = CGRectGetMinY(rect) - minPixelOffset;
+  CGFloat midY = CGRectGetMidY(rect) - minPixelOffset;
+  CGFloat maxY = CGRectGetMaxY(rect) + minPixelOffset;
+
+  CGContextBeginPath(c);
+
+  if (isTop && isBottom) {
+    CGContextMoveToPoint(c, minX, midY);
+    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
+    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
+    CGContextAddLineToPoint(c, maxX, midY);
+    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
+    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
+    CGContextAddLineToPoint(c, minX, midY);
+  } else if (isTop) {
+    CGContextMoveToPoint(c, minX, maxY);
+    CGContextAddLineToPoint(c, minX, midY);
+    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
+    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
+    CGContextAddLineToPoint(c, maxX, maxY);
+  } else if (isBottom) {
+    CGContextMoveToPoint(c, maxX, minY);
+    CGContextAddLineToPoint(c, maxX, midY);
+    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
+    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
+    CGContextAddLineToPoint(c, minX, minY);
+  } else {
+    CGContextMoveToPoint(c, minX, minY);
+    CGContextAddLineToPoint(c, minX, maxY);
+    CGContextMoveToPoint(c, maxX, minY);
+    CGContextAddLineToPoint(c, maxX, maxY);
+  }
+
+  CGContextClosePath(c);
+}
+
+/** Draws the background described by @c key. Safe to call from any thread. */
+static UIImage *DrawBackgroundImage(MDCCollectionViewCellBackgroundKey *key) {
+  MDCCollectionViewCellBackgroundOptions options = key.options;
+  BOOL isTop = (options & MDCCollectionViewCellBackgroundOptionsTop) != 0;
+  BOOL isBottom = (options & MDCCollectionViewCellBackgroundOptionsBottom) != 0;
+  BOOL isCardStyle = (options & MDCCollectionViewCellBackgroundOptionsCard) != 0;
+  BOOL isGroupedStyle = (options & MDCCollectionViewCellBackgroundOptionsGrouped) != 0;
+  BOOL isHighlighted = (options & MDCCollectionViewCellBackgroundOptionsHighlighted) != 0;
+  CGFloat borderRadius = key.borderRadius;
+  CGFloat scale = key.scale;
+
+  CGRect imageRect = CGRectMake(0, 0, kCellImageSize.width, kCellImageSize.height);
+  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, scale);
+
+  CGContextRef cx = UIGraphicsGetCurrentContext();
+
+  // Create a transparent background.
+  CGContextClearRect(cx, imageRect);
+
+  // Inner background color
+  CGContextSetFillColorWithColor(cx, key.backgroundColor.CGColor);
+
+  CGRect contentFrame = imageRect;
+
+  // Draw the shadow.
+  if ((isCardStyle || isGroupedStyle) && MDCCollectionViewCellBackgroundShadowWidth > 0 &&
+      !isHighlighted) {
+    if (isCardStyle) {
+      contentFrame = CGRectInset(imageRect, MDCCollectionViewCellBackgroundShadowWidth, 0);
+    }
+    if (isTop) {
+      contentFrame = RectShift(contentFrame, 0, MDCCollectionViewCellBackgroundShadowWidth);
+    }
+    if (isBottom) {
+      contentFrame = RectContract(contentFrame, 0, MDCCollectionViewCellBackgroundShadowWidth);
+    }
+
+    CGContextSaveGState(cx);
+    CGRect shadowFrame = contentFrame;
+
+    // We want the shadow to clip to the top and bottom edges of the image so that when two cells
+    // are next to each other their shadows line up perfectly.
+    if (!isTop) {
+      shadowFrame = RectShift(shadowFrame, 0, -MDCCollectionViewCellBackgroundShadowWidth);
+    }
+    if (!isBottom) {
+      shadowFrame = RectContract(shadowFrame, 0, -MDCCollectionViewCellBackgroundShadowWidth);
+    }
+
+    ApplyBackgroundPathToContext(cx, shadowFrame, isTop, isBottom, (isCardStyle || isGroupedStyle),
+                                 borderRadius, scale);
+    CGContextSetShadowWithColor(cx, kCollectionViewCellDefaultShadowOffset(),
+                                MDCCollectionViewCellBackgroundShadowWidth,
+                                kCollectionViewCellDefaultShadowColor().CGColor);
+    CGContextDrawPath(cx, kCGPathFill);
+    CGContextRestoreGState(cx);
+  } else {
+    // Draw a flat cell background.
+    CGContextSaveGState(cx);
+    ApplyBackgroundPathToContext(cx, contentFrame, isTop, isBottom, (isCardStyle || isGroupedStyle),
+                                 borderRadius, scale);
+    CGContextFillPath(cx);
+    CGContextRestoreGState(cx);
+  }
+  // Draw border paths for cells. We want the cell border to overlap the shadow and the content.
+  if ((isCardStyle || isGroupedStyle) && !isHighlighted) {
+    // We want to draw the borders and shadows on single retina-pixel boundaries if possible, but
+    // we need to avoid doing this on non-retina devices because it'll look blurry.
+    CGFloat minPixelOffset = 1 / scale;
+    CGRect borderFrame = CGRectInset(contentFrame, -minPixelOffset, -minPixelOffset);
+    CGContextSaveGState(cx);
+    CGContextSetLineWidth(cx, kCollectionViewCellDefaultBorderWidth);
+    CGContextSetStrokeColorWithColor(cx, kCollectionViewCellDefaultBorderColor().CGColor);
+    ApplyBorderPathToContext(cx, borderFrame, isTop, isBottom, isCardStyle, borderRadius, scale);
+    CGContextStrokePath(cx);
+    CGContextRestoreGState(cx);
+  }
+
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+
+  // Returns a resizable version of this image with cap insets equal to center point.
+  CGFloat capWidth = (CGFloat)floor(image.size.width / 2);
+  CGFloat capHeight = (CGFloat)floor(image.size.height / 2);
+  UIEdgeInsets capInsets = UIEdgeInsetsMake(capHeight, capWidth, capHeight, capWidth);
+  return [image resizableImageWithCapInsets:capInsets];
+}
+
+#pragma mark - Cache
+
+static NSUInteger gBackgroundImageHitCount = 0;
+static NSUInteger gBackgroundImageMissCount = 0;
+
+NSUInteger MDCCollectionViewCellBackgroundImageHitCount(void) {
+  return gBackgroundImageHitCount;
+}
+
+NSUInteger MDCCollectionViewCellBackgroundImageMissCount(void) {
+  return gBackgroundImageMissCount;
+}
+
+void MDCCollectionViewCellBackgroundImageResetCounts(void) {
+  gBackgroundImageHitCount = 0;
+  gBackgroundImageMissCount = 0;
+}
+
+static NSCache<MDCCollectionViewCellBackgroundKey *, UIImage *> *BackgroundImageCache(void) {
+  static NSCache<MDCCollectionViewCellBackgroundKey *, UIImage *> *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [[NSCache alloc] init];
+    cache.countLimit = kMaxCachedBackgroundImages;
+  });
+  return cache;
+}
+
+static dispatch_queue_t BackgroundImageRenderQueue(void) {
+  static dispatch_queue_t queue;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    dispatch_queue_attr_t attributes =
+        dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0);
+    queue = dispatch_queue_create("com.google.material.collections.cellbackgrounds", attributes);
+  });
+  return queue;
+}
+
+void MDCCollectionViewCellBackgroundImageRemoveAllImages(void) {
+  // Wait for any pending pre-renders so that they don't repopulate the cache afterwards.
+  dispatch_sync(BackgroundImageRenderQueue(), ^{
+    [BackgroundImageCache() removeAllObjects];
+  });
+}
+
+/** Draws the other top/bottom variants of @c key's card or grouped style on a background queue. */
+static void PrerenderSiblingBackgroundImages(MDCCollectionViewCellBackgroundKey *key) {
+  MDCCollectionViewCellBackgroundOptions positionOptions =
+      MDCCollectionViewCellBackgroundOptionsTop | MDCCollectionViewCellBackgroundOptionsBottom;
+  if ((key.options & (MDCCollectionViewCellBackgroundOptionsCard |
+                      MDCCollectionViewCellBackgroundOptionsGrouped)) == 0) {
+    // Flat backgrounds have a single variant.
+    return;
+  }
+  dispatch_async(BackgroundImageRenderQueue(), ^{
+    NSCache<MDCCollectionViewCellBackgroundKey *, UIImage *> *cache = BackgroundImageCache();
+    for (MDCCollectionViewCellBackgroundOptions position = 0; position <= positionOptions;
+         position++) {
+      MDCCollectionViewCellBackgroundKey *siblingKey = [[MDCCollectionViewCellBackgroundKey alloc]
+          initWithOptions:(key.options & ~positionOptions) | position
+          backgroundColor:key.backgroundColor
+             borderRadius:key.borderRadius
+                    scale:key.scale];
+      if (![cache objectForKey:siblingKey]) {
+        [cache setObject:DrawBackgroundImage(siblingKey) forKey:siblingKey];
+      }
+    }
+  });
+}
+
+UIImage *MDCCollectionViewCellBackgroundImage(MDCCollectionViewCellBackgroundOptions options,
+                                              UIColor *backgroundColor,
+                                              CGFloat borderRadius,
+                                              CGFloat scale) {
+  MDCCollectionViewCellBackgroundKey *key =
+      [[MDCCollectionViewCellBackgroundKey alloc] initWithOptions:options
+                                                  backgroundColor:backgroundColor
+                                                     borderRadius:borderRadius
+                                                            scale:scale];
+  NSCache<MDCCollectionViewCellBackgroundKey *, UIImage *> *cache = BackgroundImageCache();
+  UIImage *image = [cache objectForKey:key];
+  if (image) {
+    gBackgroundImageHitCount += 1;
+    return image;
+  }
+
+  gBackgroundImageMissCount += 1;
+  image = DrawBackgroundImage(key);
+  [cache setObject:image forKey:key];
+  PrerenderSiblingBackgroundImages(key);
+  return image;
+}
@@ -14,6 +14,7 @@
 
 #import "MDCCollectionViewStyler.h"
 
+#import "MDCCollectionViewCellBackgroundImages.h"
 #import "MaterialCollectionLayoutAttributes.h"
 #import "MDCCollectionViewStylingDelegate.h"
 #import "MaterialPalettes.h"
@@ -21,16 +22,6 @@
 
 #include <tgmath.h>
 
-typedef NS_OPTIONS(NSUInteger, BackgroundCacheKey) {
-  BackgroundCacheKeyFlat = 0,
-  BackgroundCacheKeyTop = 1 << 0,
-  BackgroundCacheKeyBottom = 1 << 1,
-  BackgroundCacheKeyCard = 1 << 2,
-  BackgroundCacheKeyGrouped = 1 << 3,
-  BackgroundCacheKeyHighlighted = 1 << 4,
-  BackgroundCacheKeyMax = 1 << 5,
-};
-
 const CGFloat MDCCollectionViewCellStyleCardSectionInset = 8;
 
 /** Cell content view insets for card-style cells */
@@ -48,46 +39,15 @@ static const NSInteger kCollectionViewGridDefaultColumnCount = 2;
 static const CGFloat kCollectionViewGridDefaultPadding = 4;
 
 /** The drawn cell background */
-static const CGSize kCellImageSize = {44, 44};
-static const CGFloat kCollectionViewCellDefaultBorderWidth = 1;
 static const CGFloat kCollectionViewCellDefaultBorderRadius = (CGFloat)1.5;
-static inline UIColor *kCollectionViewCellDefaultBorderColor() {
-  return [UIColor colorWithWhite:0 alpha:(CGFloat)0.05];
-}
-
-/** Cell shadowing */
-static const CGFloat kCollectionViewCellDefaultShadowWidth = 1;
-static inline CGSize kCollectionViewCellDefaultShadowOffset() {
-  return CGSizeMake(0, 1);
-}
-static inline UIColor *kCollectionViewCellDefaultShadowColor() {
-  return [UIColor colorWithWhite:0 alpha:(CGFloat)0.1];
-}
 
 /** Animate cell on appearance settings */
 static const CGFloat kCollectionViewAnimatedAppearancePadding = 20;
 static const NSTimeInterval kCollectionViewAnimatedAppearanceDelay = 0.1;
 static const NSTimeInterval kCollectionViewAnimatedAppearanceDuration = 0.3;
 
-/** Modifies only the right and bottom edges of a CGRect. */
-NS_INLINE CGRect RectContract(CGRect rect, CGFloat dx, CGFloat dy) {
-  return CGRectMake(rect.origin.x, rect.origin.y, rect.size.width - dx, rect.size.height - dy);
-}
-
-/** Modifies only the top and left edges of a CGRect. */
-NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
-  return CGRectOffset(RectContract(rect, dx, dy), dx, dy);
-}
-
 @interface MDCCollectionViewStyler ()
 
-/**
- A dictionary of NSPointerArray caches, keyed by UIColor, for cached cell background images
- using that background color. Index into the NSPointerArray using the results of
- backgroundCacheKeyForCardStyle:isGroupedStyle:isTop:isBottom:isHighlighted:
- */
-@property(nonatomic, readonly) NSMutableDictionary *cellBackgroundCaches;
-
 /** An set of index paths for items that are inlaid. */
 @property(nonatomic, strong) NSMutableSet *inlaidIndexPathSet;
 
@@ -143,9 +103,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
     // Animate cell on appearance settings.
     _animateCellsOnAppearancePadding = kCollectionViewAnimatedAppearancePadding;
     _animateCellsOnAppearanceDuration = kCollectionViewAnimatedAppearanceDuration;
-
-    // Caching.
-    _cellBackgroundCaches = [NSMutableDictionary dictionary];
   }
   return self;
 }
@@ -180,29 +137,24 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
 #pragma mark - Caching
 
-- (BackgroundCacheKey)backgroundCacheKeyForCardStyle:(BOOL)isCardStyle
-                                      isGroupedStyle:(BOOL)isGroupedStyle
-                                               isTop:(BOOL)isTop
-                                            isBottom:(BOOL)isBottom
-                                       isHighlighted:(BOOL)isHighlighted {
+- (MDCCollectionViewCellBackgroundOptions)backgroundOptionsForCardStyle:(BOOL)isCardStyle
+                                                         isGroupedStyle:(BOOL)isGroupedStyle
+                                                                  isTop:(BOOL)isTop
+                                                               isBottom:(BOOL)isBottom
+                                                          isHighlighted:(BOOL)isHighlighted {
   if (!isCardStyle && !isGroupedStyle) {
-    return BackgroundCacheKeyFlat;
+    return MDCCollectionViewCellBackgroundOptionsFlat;
   }
-  BackgroundCacheKey options = isTop ? BackgroundCacheKeyTop : 0;
-  options |= isBottom ? BackgroundCacheKeyBottom : 0;
-  options |= isCardStyle ? BackgroundCacheKeyCard : 0;
-  options |= isGroupedStyle ? BackgroundCacheKeyGrouped : 0;
-  options |= isHighlighted ? BackgroundCacheKeyHighlighted : 0;
+  MDCCollectionViewCellBackgroundOptions options =
+      isTop ? MDCCollectionViewCellBackgroundOptionsTop : 0;
+  options |= isBottom ? MDCCollectionViewCellBackgroundOptionsBottom : 0;
+  options |= isCardStyle ? MDCCollectionViewCellBackgroundOptionsCard : 0;
+  options |= isGroupedStyle ? MDCCollectionViewCellBackgroundOptionsGrouped : 0;
+  options |= isHighlighted ? MDCCollectionViewCellBackgroundOptionsHighlighted : 0;
   NSAssert(isCardStyle != isGroupedStyle, @"Cannot be both card and grouped style");
   return options;
 }
 
-- (NSPointerArray *)cellBackgroundCache {
-  NSPointerArray *cache = [NSPointerArray strongObjectsPointerArray];
-  cache.count = BackgroundCacheKeyMax;
-  return cache;
-}
-
 #pragma mark - Separators
 
 - (void)setSeparatorColor:(UIColor *)separatorColor {
@@ -241,7 +193,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   if (_cellStyle == cellStyle) {
     return;
   }
-  [_cellBackgroundCaches removeAllObjects];
   [self invalidateLayoutForStyleChange];
   _cellStyle = cellStyle;
 }
@@ -481,7 +432,7 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 - (BOOL)drawShadowForCellWithIsCardStye:(BOOL)isCardStyle
                            isGroupStyle:(BOOL)isGroupStyle
                           isHighlighted:(BOOL)isHighlighted {
-  return (isCardStyle || isGroupStyle) && kCollectionViewCellDefaultShadowWidth > 0 &&
+  return (isCardStyle || isGroupStyle) && MDCCollectionViewCellBackgroundShadowWidth > 0 &&
          !isHighlighted;
 }
 
@@ -551,224 +502,28 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
   BOOL isHighlighted = NO;
 
-  BackgroundCacheKey backgroundCacheKey = [self backgroundCacheKeyForCardStyle:isCardStyle
-                                                                isGroupedStyle:isGroupedStyle
-                                                                         isTop:isTop
-                                                                      isBottom:isBottom
-                                                                 isHighlighted:isHighlighted];
+  MDCCollectionViewCellBackgroundOptions options =
+      [self backgroundOptionsForCardStyle:isCardStyle
+                           isGroupedStyle:isGroupedStyle
+                                    isTop:isTop
+                                 isBottom:isBottom
+                            isHighlighted:isHighlighted];
 
-  if (backgroundCacheKey > BackgroundCacheKeyMax) {
-    NSAssert(NO, @"Invalid styler cell background cache key");
-    return nil;
-  }
-
-  // Get cell color.
+  // Get cell color. Colors are resolved here so that the shared image cache, which may draw on a
+  // background queue, never has to resolve a dynamic color itself.
   UIColor *backgroundColor = _cellBackgroundColor;
   if ([_delegate respondsToSelector:@selector(collectionView:cellBackgroundColorAtIndexPath:)]) {
     UIColor *customBackgroundColor = [_delegate collectionView:_collectionView
                                 cellBackgroundColorAtIndexPath:attr.indexPath];
     if (customBackgroundColor) {
-      backgroundColor = [customBackgroundColor
-          mdc_resolvedColorWithTraitCollection:self.collectionView.traitCollection];
-    }
-  }
-
-  NSPointerArray *cellBackgroundCache = _cellBackgroundCaches[backgroundColor];
-  if (!cellBackgroundCache) {
-    cellBackgroundCache = [self cellBackgroundCache];
-    _cellBackgroundCaches[backgroundColor] = cellBackgroundCache;
-  } else if ([cellBackgroundCache pointerAtIndex:backgroundCacheKey]) {
-    return (__bridge UIImage *)[cellBackgroundCache pointerAtIndex:backgroundCacheKey];
-  }
-
-  CGRect imageRect = CGRectMake(0, 0, kCellImageSize.width, kCellImageSize.height);
-  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, 0);
-
-  CGContextRef cx = UIGraphicsGetCurrentContext();
-
-  // Create a transparent background.
-  CGContextClearRect(cx, imageRect);
-
-  // Inner background color
-  CGContextSetFillColorWithColor(cx, backgroundColor.CGColor);
-
-  CGRect contentFrame = imageRect;
-
-  // Draw the shadow.
-  if ([self drawShadowForCellWithIsCardStye:isCardStyle
-                               isGroupStyle:isGroupedStyle
-                              isHighlighted:isHighlighted]) {
-    if (isCardStyle) {
-      contentFrame = CGRectInset(imageRect, kCollectionViewCellDefaultShadowWidth, 0);
+      backgroundColor = customBackgroundColor;
     }
-    if (isTop) {
-      contentFrame = RectShift(contentFrame, 0, kCollectionViewCellDefaultShadowWidth);
-    }
-    if (isBottom) {
-      contentFrame = RectContract(contentFrame, 0, kCollectionViewCellDefaultShadowWidth);
-    }
-
-    CGContextSaveGState(cx);
-    CGRect shadowFrame = contentFrame;
-
-    // We want the shadow to clip to the top and bottom edges of the image so that when two cells
-    // are next to each other their shadows line up perfectly.
-    if (!isTop) {
-      shadowFrame = RectShift(shadowFrame, 0, -kCollectionViewCellDefaultShadowWidth);
-    }
-    if (!isBottom) {
-      shadowFrame = RectContract(shadowFrame, 0, -kCollectionViewCellDefaultShadowWidth);
-    }
-
-    [self applyBackgroundPathToContext:cx
-                                  rect:shadowFrame
-                                 isTop:isTop
-                              isBottom:isBottom
-                                isCard:(isCardStyle || isGroupedStyle)
-                          borderRadius:borderRadius];
-    CGContextSetShadowWithColor(cx, kCollectionViewCellDefaultShadowOffset(),
-                                kCollectionViewCellDefaultShadowWidth,
-                                kCollectionViewCellDefaultShadowColor().CGColor);
-    CGContextDrawPath(cx, kCGPathFill);
-    CGContextRestoreGState(cx);
-  } else {
-    // Draw a flat cell background.
-    CGContextSaveGState(cx);
-    [self applyBackgroundPathToContext:cx
-                                  rect:contentFrame
-                                 isTop:isTop
-                              isBottom:isBottom
-                                isCard:(isCardStyle || isGroupedStyle)
-                          borderRadius:borderRadius];
-    CGContextFillPath(cx);
-    CGContextRestoreGState(cx);
-  }
-  // Draw border paths for cells. We want the cell border to overlap the shadow and the content.
-  if ((isCardStyle || isGroupedStyle) && !isHighlighted) {
-    CGFloat minPixelOffset = [self minPixelOffset];
-    CGRect borderFrame = CGRectInset(contentFrame, -minPixelOffset, -minPixelOffset);
-    CGContextSaveGState(cx);
-    CGContextSetLineWidth(cx, kCollectionViewCellDefaultBorderWidth);
-    CGContextSetStrokeColorWithColor(cx, kCollectionViewCellDefaultBorderColor().CGColor);
-    [self applyBorderPathToContext:cx
-                              rect:borderFrame
-                             isTop:isTop
-                          isBottom:isBottom
-                            isCard:isCardStyle
-                      borderRadius:borderRadius];
-    CGContextStrokePath(cx);
-    CGContextRestoreGState(cx);
-  }
-
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-  UIImage *resizableImage = [self resizableImage:image];
-  [cellBackgroundCache replacePointerAtIndex:backgroundCacheKey
-                                 withPointer:(__bridge void *)(resizableImage)];
-  return resizableImage;
-}
-
-#pragma mark - Private Context Paths
-
-// We want to draw the borders and shadows on single retina-pixel boundaries if possible, but
-// we need to avoid doing this on non-retina devices because it'll look blurry.
-- (CGFloat)minPixelOffset {
-  return 1 / [[UIScreen mainScreen] scale];
-}
-
-- (UIImage *)resizableImage:(UIImage *)image {
-  // Returns a resizable version of this image with cap insets equal to center point.
-  CGFloat capWidth = (CGFloat)floor(image.size.width / 2);
-  CGFloat capHeight = (CGFloat)floor(image.size.height / 2);
-  UIEdgeInsets capInsets = UIEdgeInsetsMake(capHeight, capWidth, capHeight, capWidth);
-  return [image resizableImageWithCapInsets:capInsets];
-}
-
-- (void)applyBackgroundPathToContext:(CGContextRef)c
-                                rect:(CGRect)rect
-                               isTop:(BOOL)isTop
-                            isBottom:(BOOL)isBottom
-                              isCard:(BOOL)isCard
-                        borderRadius:(CGFloat)borderRadius {
-  // Draw background paths for cell.
-  CGFloat minPixelOffset = (isCard) ? [self minPixelOffset] : 0;
-  CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
-  CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
-  CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
-  CGFloat minY = CGRectGetMinY(rect) - minPixelOffset;
-  CGFloat midY = CGRectGetMidY(rect) - minPixelOffset;
-  CGFloat maxY = CGRectGetMaxY(rect) + minPixelOffset;
-
-  CGContextBeginPath(c);
-
-  CGContextMoveToPoint(c, minX, midY);
-  if (isTop && isCard) {
-    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
-    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
-  } else {
-    CGContextAddLineToPoint(c, minX, minY);
-    CGContextAddLineToPoint(c, maxX, minY);
-  }
-
-  CGContextAddLineToPoint(c, maxX, midY);
-
-  if (isBottom & isCard) {
-    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
-    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
-  } else {
-    CGContextAddLineToPoint(c, maxX, maxY);
-    CGContextAddLineToPoint(c, minX, maxY);
-  }
-  CGContextAddLineToPoint(c, minX, midY);
-
-  CGContextClosePath(c);
-}
-
-- (void)applyBorderPathToContext:(CGContextRef)c
-                            rect:(CGRect)rect
-                           isTop:(BOOL)isTop
-                        isBottom:(BOOL)isBottom
-                          isCard:(BOOL)isCard
-                    borderRadius:(CGFloat)borderRadius {
-  // Draw border paths for cell.
-  CGFloat minPixelOffset = (isCard) ? [self minPixelOffset] : 0;
-  CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
-  CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
-  CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
-  CGFloat minY = CGRectGetMinY(rect) - minPixelOffset;
-  CGFloat midY = CGRectGetMidY(rect) - minPixelOffset;
-  CGFloat maxY = CGRectGetMaxY(rect) + minPixelOffset;
-
-  CGContextBeginPath(c);
-
-  if (isTop && isBottom) {
-    CGContextMoveToPoint(c, minX, midY);
-    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
-    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
-    CGContextAddLineToPoint(c, maxX, midY);
-    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
-    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
-    CGContextAddLineToPoint(c, minX, midY);
-  } else if (isTop) {
-    CGContextMoveToPoint(c, minX, maxY);
-    CGContextAddLineToPoint(c, minX, midY);
-    CGContextAddArcToPoint(c, minX, minY + 1, midX, minY + 1, borderRadius);
-    CGContextAddArcToPoint(c, maxX, minY + 1, maxX, midY, borderRadius);
-    CGContextAddLineToPoint(c, maxX, maxY);
-  } else if (isBottom) {
-    CGContextMoveToPoint(c, maxX, minY);
-    CGContextAddLineToPoint(c, maxX, midY);
-    CGContextAddArcToPoint(c, maxX, maxY - 1, midX, maxY - 1, borderRadius);
-    CGContextAddArcToPoint(c, minX, maxY - 1, minX, midY, borderRadius);
-    CGContextAddLineToPoint(c, minX, minY);
-  } else {
-    CGContextMoveToPoint(c, minX, minY);
-    CGContextAddLineToPoint(c, minX, maxY);
-    CGContextMoveToPoint(c, maxX, minY);
-    CGContextAddLineToPoint(c, maxX, maxY);
   }
+  backgroundColor =
+      [backgroundColor mdc_resolvedColorWithTraitCollection:self.collectionView.traitCollection];
 
-  CGContextClosePath(c);
+  return MDCCollectionViewCellBackgroundImage(options, backgroundColor, borderRadius,
+                                              [[UIScreen mainScreen] scale]);
 }
 
 @end
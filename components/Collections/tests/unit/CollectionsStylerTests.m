@@ -14,6 +14,7 @@
 
 #import <XCTest/XCTest.h>
 
+#import "MDCCollectionViewCellBackgroundImages.h"
 #import "MDCCollectionViewStyler.h"
 #import "MaterialCollectionLayoutAttributes.h"
 #import "MaterialCollections.h"
@@ -137,4 +138,76 @@ static MDCCollectionViewLayoutAttributes* footer1() {
   XCTAssertFalse([styler shouldHideSeparatorForCellLayoutAttributes:footer1()]);
 }
 
+#pragma mark - Background images
+
+static MDCCollectionViewStyler* CardStyler() {
+  UICollectionView* collectionView =
+      [[UICollectionView alloc] initWithFrame:CGRectZero
+                         collectionViewLayout:[[UICollectionViewFlowLayout alloc] init]];
+  MDCCollectionViewStyler* styler =
+      [[MDCCollectionViewStyler alloc] initWithCollectionView:collectionView];
+  styler.cellStyle = MDCCollectionViewCellStyleCard;
+  return styler;
+}
+
+- (void)testBackgroundImagesAreSharedBetweenStylers {
+  // Given
+  MDCCollectionViewStyler* firstStyler = CardStyler();
+  MDCCollectionViewStyler* secondStyler = CardStyler();
+  MDCCollectionViewLayoutAttributes* attributes = cell00();
+  attributes.sectionOrdinalPosition = MDCCollectionViewOrdinalPositionVerticalTop;
+  UIImage* firstImage = [firstStyler backgroundImageForCellLayoutAttributes:attributes];
+  MDCCollectionViewCellBackgroundImageResetCounts();
+
+  // When
+  UIImage* secondImage = [secondStyler backgroundImageForCellLayoutAttributes:attributes];
+
+  // Then
+  XCTAssertNotNil(firstImage);
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundImageMissCount(), 0U);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundImageHitCount(), 1U);
+}
+
+- (void)testBackgroundImageDependsOnBorderRadius {
+  // Given
+  MDCCollectionViewStyler* styler = CardStyler();
+  MDCCollectionViewLayoutAttributes* attributes = cell00();
+  attributes.sectionOrdinalPosition = MDCCollectionViewOrdinalPositionVerticalTopBottom;
+  UIImage* defaultRadiusImage = [styler backgroundImageForCellLayoutAttributes:attributes];
+
+  // When
+  styler.cardBorderRadius = 6;
+  UIImage* largeRadiusImage = [styler backgroundImageForCellLayoutAttributes:attributes];
+
+  // Then
+  XCTAssertNotNil(largeRadiusImage);
+  XCTAssertNotEqual(defaultRadiusImage, largeRadiusImage);
+}
+
+- (void)testBackgroundImageDependsOnBackgroundColor {
+  // Given
+  MDCCollectionViewStyler* styler = CardStyler();
+  MDCCollectionViewLayoutAttributes* attributes = cell00();
+  UIImage* whiteImage = [styler backgroundImageForCellLayoutAttributes:attributes];
+
+  // When
+  styler.cellBackgroundColor = UIColor.blueColor;
+  UIImage* blueImage = [styler backgroundImageForCellLayoutAttributes:attributes];
+
+  // Then
+  XCTAssertNotEqual(whiteImage, blueImage);
+}
+
+- (void)testBackgroundImageIsDrawnAtRequestedScale {
+  // When
+  UIImage* image = MDCCollectionViewCellBackgroundImage(
+      MDCCollectionViewCellBackgroundOptionsGrouped | MDCCollectionViewCellBackgroundOptionsTop,
+      UIColor.whiteColor, 0, 3);
+
+  // Then
+  XCTAssertEqualWithAccuracy(image.scale, 3, 0.001);
+  XCTAssertTrue(CGSizeEqualToSize(image.size, CGSizeMake(44, 44)));
+}
+
 @end
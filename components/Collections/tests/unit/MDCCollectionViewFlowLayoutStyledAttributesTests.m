@@ -0,0 +1,188 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialCollectionLayoutAttributes.h"
+#import "MaterialCollections.h"
+
+static NSString *const kCellReuseIdentifier = @"Cell";
+static const CGFloat kCollectionViewHeight = 640;
+// The number of frames scrolled by each iteration of the scrolling performance test.
+static const NSUInteger kScrolledFrameCount = 10000;
+
+/** A list of plain cells in a single section. */
+@interface FakeStyledAttributesCollectionViewController : MDCCollectionViewController
+@property(nonatomic, assign) NSInteger itemCount;
+@end
+
+@implementation FakeStyledAttributesCollectionViewController
+
+- (void)viewDidLoad {
+  [super viewDidLoad];
+
+  [self.collectionView registerClass:[MDCCollectionViewCell class]
+          forCellWithReuseIdentifier:kCellReuseIdentifier];
+}
+
+- (NSInteger)numberOfSectionsInCollectionView:(UICollectionView *)collectionView {
+  return 1;
+}
+
+- (NSInteger)collectionView:(UICollectionView *)collectionView
+     numberOfItemsInSection:(NSInteger)section {
+  return self.itemCount;
+}
+
+- (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView
+                  cellForItemAtIndexPath:(NSIndexPath *)indexPath {
+  return [collectionView dequeueReusableCellWithReuseIdentifier:kCellReuseIdentifier
+                                                   forIndexPath:indexPath];
+}
+
+@end
+
+@interface MDCCollectionViewFlowLayoutStyledAttributesTests : XCTestCase
+@property(nonatomic, strong) FakeStyledAttributesCollectionViewController *controller;
+@property(nonatomic, strong) MDCCollectionViewFlowLayout *layout;
+@end
+
+@implementation MDCCollectionViewFlowLayoutStyledAttributesTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.controller = [[FakeStyledAttributesCollectionViewController alloc] init];
+  self.controller.itemCount = 100;
+  self.controller.view.frame = CGRectMake(0, 0, 360, kCollectionViewHeight);
+  [self.controller.collectionView layoutIfNeeded];
+  self.layout = (MDCCollectionViewFlowLayout *)self.controller.collectionViewLayout;
+}
+
+- (void)tearDown {
+  self.layout = nil;
+  self.controller = nil;
+
+  [super tearDown];
+}
+
+- (MDCCollectionViewLayoutAttributes *)attributesForFirstItem {
+  CGRect rect = CGRectMake(0, 0, 360, kCollectionViewHeight);
+  for (MDCCollectionViewLayoutAttributes *attr in
+       [self.layout layoutAttributesForElementsInRect:rect]) {
+    if (attr.representedElementCategory == UICollectionElementCategoryCell &&
+        attr.indexPath.item == 0) {
+      return attr;
+    }
+  }
+  return nil;
+}
+
+- (void)testRepeatedQueriesReuseStyledAttributes {
+  // Given
+  MDCCollectionViewLayoutAttributes *firstAttributes = [self attributesForFirstItem];
+
+  // When
+  MDCCollectionViewLayoutAttributes *secondAttributes = [self attributesForFirstItem];
+
+  // Then
+  XCTAssertNotNil(firstAttributes);
+  XCTAssertEqual(firstAttributes, secondAttributes);
+  XCTAssertEqual(
+      [self.layout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:0 inSection:0]],
+      firstAttributes);
+}
+
+- (void)testStylerChangeRestylesAttributes {
+  // Given
+  MDCCollectionViewLayoutAttributes *flatAttributes = [self attributesForFirstItem];
+
+  // When
+  self.controller.styler.cellStyle = MDCCollectionViewCellStyleCard;
+  MDCCollectionViewLayoutAttributes *cardAttributes = [self attributesForFirstItem];
+
+  // Then
+  XCTAssertNotEqual(flatAttributes, cardAttributes);
+  UIImage *expectedImage =
+      [self.controller.styler backgroundImageForCellLayoutAttributes:cardAttributes];
+  XCTAssertEqualObjects(cardAttributes.backgroundImage, expectedImage);
+}
+
+- (void)testEditingToggleRestylesAttributes {
+  // Given
+  MDCCollectionViewLayoutAttributes *attributes = [self attributesForFirstItem];
+  XCTAssertFalse(attributes.editing);
+
+  // When
+  self.controller.editor.editing = YES;
+  attributes = [self attributesForFirstItem];
+
+  // Then
+  XCTAssertTrue(attributes.editing);
+}
+
+- (void)testInvalidateLayoutRestylesAttributes {
+  // Given
+  MDCCollectionViewLayoutAttributes *firstAttributes = [self attributesForFirstItem];
+
+  // When
+  [self.layout invalidateLayout];
+  MDCCollectionViewLayoutAttributes *secondAttributes = [self attributesForFirstItem];
+
+  // Then
+  XCTAssertNotEqual(firstAttributes, secondAttributes);
+  XCTAssertEqual(firstAttributes.sectionOrdinalPosition, secondAttributes.sectionOrdinalPosition);
+}
+
+- (void)testStyledAttributesMatchUncachedStyling {
+  // Given
+  MDCCollectionViewLayoutAttributes *cachedAttributes = [self attributesForFirstItem];
+  cachedAttributes = [self attributesForFirstItem];
+
+  // When
+  [self.layout invalidateLayout];
+  MDCCollectionViewLayoutAttributes *freshAttributes = [self attributesForFirstItem];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(cachedAttributes.frame, freshAttributes.frame));
+  XCTAssertEqual(cachedAttributes.sectionOrdinalPosition, freshAttributes.sectionOrdinalPosition);
+  XCTAssertEqual(cachedAttributes.shouldHideSeparators, freshAttributes.shouldHideSeparators);
+  XCTAssertEqualObjects(cachedAttributes.backgroundImage, freshAttributes.backgroundImage);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceScrollingLongList {
+  // Given
+  self.controller.itemCount = 10000;
+  [self.controller.collectionView reloadData];
+  [self.controller.collectionView layoutIfNeeded];
+  CGFloat scrollableHeight = self.layout.collectionViewContentSize.height - kCollectionViewHeight;
+  // Scrolling at 48 points per frame, a fast fling on a 60Hz display.
+  CGFloat scrollPerFrame = 48;
+
+  // Then
+  // Each iteration queries the visible rect of a fixed number of frames the way UICollectionView
+  // does once per frame, wrapping back to the top at the end of the list, so that results can be
+  // compared across content sizes.
+  [self measureBlock:^{
+    for (NSUInteger frame = 0; frame < kScrolledFrameCount; frame++) {
+      CGFloat offset = (CGFloat)fmod(frame * scrollPerFrame, scrollableHeight);
+      CGRect visibleRect = CGRectMake(0, offset, 360, kCollectionViewHeight);
+      [self.layout layoutAttributesForElementsInRect:visibleRect];
+    }
+  }];
+}
+
+@end
@@ -15,11 +15,119 @@
 #import "UIColor+MaterialElevation.h"
 
 #import <CoreGraphics/CoreGraphics.h>
+#import <os/lock.h>
 
 #import "MaterialAvailability.h"
 #import "MaterialMath.h"
 #import "UIColor+MaterialBlending.h"
 
+// Elevations are cached on a grid of kElevationBucketsPerPoint buckets per point, up to
+// kMaxCachedElevation. Elevations that do not fall exactly on the grid are resolved directly so
+// that caching never changes the resolved color.
+#define kElevationBucketsPerPoint 4
+#define kMaxCachedElevation 24
+#define kElevationBucketCount (kElevationBucketsPerPoint * kMaxCachedElevation + 1)
+
+/**
+ The number of base colors whose resolved elevation colors are cached. Each base color has one slot,
+ and a base color that lands on an occupied slot replaces the color cached there.
+ */
+#define kOverlayColorCacheSlotBits 6
+#define kOverlayColorCacheSlotCount (1 << kOverlayColorCacheSlotBits)
+
+/** Returns the alpha percentage of the white elevation overlay for the given elevation. */
+static CGFloat MDCElevationOverlayAlphaPercentage(CGFloat elevation) {
+  if (MDCCGFloatEqual(elevation, 0)) {
+    return 0;
+  }
+  if (elevation < 1) {
+    // A formula for values between 0 to 1 is used here to simulate the alpha percentage
+    // as in the main formula below there is a jump between any number larger than 0 to an
+    // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
+    // of the alpha value between lower numbers to be smaller than the higher numbers.
+    // AlphaValue = 5.11916 * elevationValue ^ 2
+    return (CGFloat)5.11916 * pow((CGFloat)elevation, 2);
+  }
+  // A formula is used here to simulate the alpha percentage stated on
+  // https://material.io/design/color/dark-theme.html#properties
+  // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
+  // Note: Both formulas meet at the transition point of (1, 5.11916).
+  return (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
+}
+
+/** Returns the overlay alpha percentage of every cached elevation bucket. */
+static const CGFloat *MDCElevationOverlayAlphaPercentageTable(void) {
+  static CGFloat table[kElevationBucketCount];
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    for (NSUInteger bucket = 0; bucket < kElevationBucketCount; bucket++) {
+      table[bucket] =
+          MDCElevationOverlayAlphaPercentage((CGFloat)bucket / kElevationBucketsPerPoint);
+    }
+  });
+  return table;
+}
+
+/**
+ Returns the cache bucket of the given non-negative elevation, or NSNotFound if the elevation does
+ not fall exactly on the cached grid.
+ */
+static NSUInteger MDCElevationOverlayBucket(CGFloat elevation) {
+  if (elevation > kMaxCachedElevation) {
+    return NSNotFound;
+  }
+  CGFloat scaledElevation = elevation * kElevationBucketsPerPoint;
+  CGFloat bucket = round(scaledElevation);
+  if (bucket != scaledElevation) {
+    return NSNotFound;
+  }
+  return (NSUInteger)bucket;
+}
+
+/** Blends the white elevation overlay with the given alpha percentage over a color. */
+static UIColor *MDCBlendElevationOverlay(MDCRGBAColor color, CGFloat alphaPercentage) {
+  // TODO (https://github.com/material-components/material-components-ios/issues/8096):
+  // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
+  // The white overlay is blended directly from its components so that no intermediate UIColor is
+  // created.
+  MDCRGBAColor overlayColor = MDCRGBAColorMake(1, 1, 1, alphaPercentage * (CGFloat)0.01);
+  return [UIColor mdc_colorWithRGBAColor:MDCBlendRGBAColor(overlayColor, color)];
+}
+
+/** The resolved elevation colors of a single base color, filled in lazily per elevation bucket. */
+@interface MDCElevationOverlayColorTable : NSObject
+@end
+
+@implementation MDCElevationOverlayColorTable {
+ @public
+  MDCRGBAColor _color;
+  UIColor *_colors[kElevationBucketCount];
+}
+@end
+
+static os_unfair_lock gOverlayColorCacheLock = OS_UNFAIR_LOCK_INIT;
+
+/** The cached color tables, indexed by MDCElevationOverlayColorCacheSlot. */
+static MDCElevationOverlayColorTable *gOverlayColorTables[kOverlayColorCacheSlotCount];
+
+/** Returns the cache slot of a base color. */
+static NSUInteger MDCElevationOverlayColorCacheSlot(MDCRGBAColor color) {
+  double components[4] = {color.red, color.green, color.blue, color.alpha};
+  uint64_t hash = 0;
+  for (NSUInteger i = 0; i < 4; i++) {
+    uint64_t bits;
+    memcpy(&bits, &components[i], sizeof(bits));
+    hash = hash * 31 + bits;
+  }
+  // Fibonacci hashing: the top bits of the product depend on every bit of the hash.
+  return (NSUInteger)((hash * 0x9E3779B97F4A7C15ull) >> (64 - kOverlayColorCacheSlotBits));
+}
+
+static BOOL MDCRGBAColorEqual(MDCRGBAColor color, MDCRGBAColor otherColor) {
+  return color.red == otherColor.red && color.green == otherColor.green &&
+         color.blue == otherColor.blue && color.alpha == otherColor.alpha;
+}
+
 @implementation UIColor (MaterialElevation)
 
 - (UIColor *)mdc_resolvedColorWithTraitCollection:(UITraitCollection *)traitCollection
@@ -57,29 +165,35 @@
                 format:@"Pattern-based colors are not supported by %@", NSStringFromSelector(_cmd)];
   }
 
-  UIColor *overlayColor = UIColor.whiteColor;
   elevation = MAX(elevation, 0);
-  CGFloat alphaValue = 0;
-  if (!MDCCGFloatEqual(elevation, 0)) {
-    if (elevation < 1) {
-      // A formula for values between 0 to 1 is used here to simulate the alpha percentage
-      // as in the main formula below there is a jump between any number larger than 0 to an
-      // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
-      // of the alpha value between lower numbers to be smaller than the higher numbers.
-      // AlphaValue = 5.11916 * elevationValue ^ 2
-      alphaValue = (CGFloat)5.11916 * pow((CGFloat)elevation, 2);
-    } else {
-      // A formula is used here to simulate the alpha percentage stated on
-      // https://material.io/design/color/dark-theme.html#properties
-      // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
-      // Note: Both formulas meet at the transition point of (1, 5.11916).
-      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
-    }
+  MDCRGBAColor color = self.mdc_RGBAColor;
+  NSUInteger bucket = MDCElevationOverlayBucket(elevation);
+  if (bucket == NSNotFound) {
+    return MDCBlendElevationOverlay(color, MDCElevationOverlayAlphaPercentage(elevation));
   }
-  // TODO (https://github.com/material-components/material-components-ios/issues/8096):
-  // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
-  return [UIColor mdc_blendColor:[overlayColor colorWithAlphaComponent:alphaValue * (CGFloat)0.01]
-             withBackgroundColor:self];
+
+  NSUInteger slot = MDCElevationOverlayColorCacheSlot(color);
+  os_unfair_lock_lock(&gOverlayColorCacheLock);
+  MDCElevationOverlayColorTable *table = gOverlayColorTables[slot];
+  UIColor *resolvedColor =
+      (table && MDCRGBAColorEqual(table->_color, color)) ? table->_colors[bucket] : nil;
+  os_unfair_lock_unlock(&gOverlayColorCacheLock);
+  if (resolvedColor) {
+    return resolvedColor;
+  }
+
+  resolvedColor =
+      MDCBlendElevationOverlay(color, MDCElevationOverlayAlphaPercentageTable()[bucket]);
+  os_unfair_lock_lock(&gOverlayColorCacheLock);
+  table = gOverlayColorTables[slot];
+  if (!table || !MDCRGBAColorEqual(table->_color, color)) {
+    table = [[MDCElevationOverlayColorTable alloc] init];
+    table->_color = color;
+    gOverlayColorTables[slot] = table;
+  }
+  table->_colors[bucket] = resolvedColor;
+  os_unfair_lock_unlock(&gOverlayColorCacheLock);
+  return resolvedColor;
 }
 
 @end
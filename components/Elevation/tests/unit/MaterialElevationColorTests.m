@@ -338,4 +338,90 @@ static UIImage *fakeImageWithColorAndSize(UIColor *color, CGRect bounds) {
 #endif  // MDC_AVAILABLE_SDK_IOS(13_0)
 }
 
+- (void)testResolvedColorWithCachedElevationReturnsCachedColor {
+  // Given
+  CGFloat elevation = (CGFloat)8;
+
+  // When
+  UIColor *firstColor = [self.rgbColor mdc_resolvedColorWithElevation:elevation];
+  UIColor *secondColor = [self.rgbColor mdc_resolvedColorWithElevation:elevation];
+
+  // Then
+  XCTAssertEqual(firstColor, secondColor);
+}
+
+- (void)testResolvedColorWithEqualBaseColorsSharesCachedColor {
+  // Given
+  CGFloat elevation = (CGFloat)1.5;
+  UIColor *equalColor = [UIColor colorWithRed:(CGFloat)0.9
+                                        green:(CGFloat)0.8
+                                         blue:(CGFloat)0.6
+                                        alpha:(CGFloat)0.6];
+
+  // When
+  UIColor *firstColor = [self.rgbColor mdc_resolvedColorWithElevation:elevation];
+  UIColor *secondColor = [equalColor mdc_resolvedColorWithElevation:elevation];
+
+  // Then
+  XCTAssertEqual(firstColor, secondColor);
+}
+
+- (void)testResolvedColorWithOffGridElevationMatchesNeighboringCachedElevations {
+  // Given
+  CGFloat offGridElevation = (CGFloat)8.1;
+
+  // When
+  UIColor *lowerColor = [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)8];
+  UIColor *offGridColor = [self.rgbColor mdc_resolvedColorWithElevation:offGridElevation];
+  UIColor *upperColor = [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)8.25];
+
+  // Then
+  CGFloat lowerAlpha = 0, offGridAlpha = 0, upperAlpha = 0;
+  [lowerColor getRed:NULL green:NULL blue:NULL alpha:&lowerAlpha];
+  [offGridColor getRed:NULL green:NULL blue:NULL alpha:&offGridAlpha];
+  [upperColor getRed:NULL green:NULL blue:NULL alpha:&upperAlpha];
+  XCTAssertGreaterThan(offGridAlpha, lowerAlpha);
+  XCTAssertLessThan(offGridAlpha, upperAlpha);
+}
+
+- (void)testResolvedColorCacheIsSharedAcrossColorAppearanceChanges {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    CGFloat elevation = (CGFloat)4;
+    UITraitCollection *darkTraitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    UITraitCollection *lightTraitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleLight];
+    UIColor *firstColor = [self.rgbColor mdc_resolvedColorWithTraitCollection:darkTraitCollection
+                                                                    elevation:elevation];
+
+    // When
+    [self.rgbColor mdc_resolvedColorWithTraitCollection:lightTraitCollection elevation:elevation];
+    UIColor *secondColor = [self.rgbColor mdc_resolvedColorWithTraitCollection:darkTraitCollection
+                                                                     elevation:elevation];
+
+    // Then
+    XCTAssertEqual(firstColor, secondColor);
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+}
+
+- (void)testPerformanceResolvedColorWithElevation {
+  // Given
+  NSMutableArray<UIColor *> *colors = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 16; i++) {
+    [colors addObject:[UIColor colorWithWhite:(CGFloat)i / 16 alpha:1]];
+  }
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger iteration = 0; iteration < 1000; iteration++) {
+      for (UIColor *color in colors) {
+        [color mdc_resolvedColorWithElevation:(CGFloat)(iteration % 25)];
+      }
+    }
+  }];
+}
+
 @end
@@ -15,6 +15,7 @@
 #import "MDCFlexibleHeaderView.h"
 
 #import "private/MDCFlexibleHeaderMinMaxHeight.h"
+#import "private/MDCFlexibleHeaderScrollEngine.h"
 #import "private/MDCFlexibleHeaderShifter.h"
 #import "private/MDCFlexibleHeaderTopSafeArea.h"
 #import "private/MDCFlexibleHeaderView+Private.h"
@@ -42,6 +43,18 @@ const MDCFlexibleHeaderShiftBehavior MDCFlexibleHeaderShiftBehaviorEnabled = 1;
 const MDCFlexibleHeaderShiftBehavior MDCFlexibleHeaderShiftBehaviorEnabledWithStatusBar = 2;
 const MDCFlexibleHeaderShiftBehavior MDCFlexibleHeaderShiftBehaviorHideable = 3;
 
+// The scroll engine's phases mirror MDCFlexibleHeaderScrollPhase value for value so that the view
+// can cast between them.
+_Static_assert(MDCFlexibleHeaderScrollEnginePhaseShifting ==
+                   (int)MDCFlexibleHeaderScrollPhaseShifting,
+               "");
+_Static_assert(MDCFlexibleHeaderScrollEnginePhaseCollapsing ==
+                   (int)MDCFlexibleHeaderScrollPhaseCollapsing,
+               "");
+_Static_assert(MDCFlexibleHeaderScrollEnginePhaseOverExtending ==
+                   (int)MDCFlexibleHeaderScrollPhaseOverExtending,
+               "");
+
 // The maximum default opacity of the shadow.
 static const float kDefaultVisibleShadowOpacity = (float)0.4;
 
@@ -56,22 +69,12 @@ static const CGFloat kShadowScaleLength = 8;
 // Duration of the UIKit animation that occurs when changing the tracking scroll view.
 static const NSTimeInterval kTrackingScrollViewDidChangeAnimationDuration = 0.2;
 
-// The epsilon used to determine when we've arrived at the destination while shifting the header
-// on/off-screen with the display link.
-static const float kShiftEpsilon = (float)0.1;
-
 // The epsilon used when comparing height values.
 static const CGFloat kHeightEpsilon = (CGFloat)0.001;
 
 // The epsilon used when comparing content offset values.
 static const CGFloat kContentOffsetEpsilon = (CGFloat)0.001;
 
-// The minimum delta y before we change the scroll direction.
-static const CGFloat kDeltaYSlop = 5;
-
-// Affects how fast the header shifts on/off-screen while animating. Bigger value = faster.
-static const CGFloat kAttachmentCoefficient = 12;
-
 // The amount the user needs to scroll back before the header starts shifting back on-screen.
 static const CGFloat kMaxAnchorLengthFullSwipe = 175;
 static const CGFloat kMaxAnchorLengthQuickSwipe = 25;
@@ -153,22 +156,18 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   NSMapTable *_trackedScrollViews;  // {UIScrollView:MDCFlexibleHeaderScrollViewInfo}
   MDCFlexibleHeaderScrollViewInfo *_trackingInfo;
 
-  // The ideal visibility state of the header. This may not match the present visibility if the user
-  // is interacting with the header or if we're presently animating it.
-  BOOL _wantsToBeHidden;
-
-  // Shift behavior state
-
-  // Prevents delta calculations on first update pass.
-  BOOL _shiftAccumulatorLastContentOffsetIsValid;
-  // When the header can slide off-screen, a positive value indicates how off-screen the header is.
-  // Essentially: view's top edge = -_shiftAccumulator
+  // Shift behavior state, including the ideal visibility state of the header. The ideal visibility
+  // may not match the present visibility if the user is interacting with the header or if we're
+  // presently animating it.
+  //
+  // When the header can slide off-screen, a positive shift accumulator indicates how off-screen the
+  // header is.
+  // Essentially: view's top edge = -_scrollState.shiftAccumulator
   // When canAlwaysExpandToMaximumHeight is enabled, a negative value indicates how expanded the
   // header is.
-  // Essentially: view's height += -_shiftAccumulator
-  CGFloat _shiftAccumulator;
-  CGPoint _shiftAccumulatorLastContentOffset;  // Stores our last delta'd content offset.
-  CGFloat _shiftAccumulatorDeltaY;
+  // Essentially: view's height += -_scrollState.shiftAccumulator
+  MDCFlexibleHeaderScrollState _scrollState;
+  // Runs while _scrollState.isSettling.
   CADisplayLink *_shiftAccumulatorDisplayLink;
 
   BOOL _interfaceOrientationIsChanging;
@@ -518,12 +517,12 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   [self fhv_enforceInsetsForScrollView:_trackingScrollView];
 
   // Ignore any content offset delta that occured as a result of any safe area insets change.
-  _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
+  _scrollState.lastContentOffsetY = [self fhv_boundedContentOffset].y;
 
-  if (_shifter.behavior == MDCFlexibleHeaderShiftBehaviorHideable && _wantsToBeHidden &&
+  if (_shifter.behavior == MDCFlexibleHeaderShiftBehaviorHideable && _scrollState.wantsToBeHidden &&
       !_shiftAccumulatorDisplayLink) {
     // Using the new safe area information, immediately shift the header such that it is off-screen.
-    _shiftAccumulator = self.fhv_accumulatorMax;
+    _scrollState.shiftAccumulator = self.fhv_accumulatorMax;
     [self fhv_commitAccumulatorToFrame];
   } else if (!_trackingScrollView) {
     // The changes might require us to re-calculate the frame, or update the entire layout.
@@ -531,7 +530,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
     bounds.size.height = self.minMaxHeight.minimumHeightWithTopSafeArea;
     self.bounds = bounds;
     CGPoint position = self.center;
-    position.y = -MIN([self fhv_accumulatorMax], _shiftAccumulator);
+    position.y = -MIN([self fhv_accumulatorMax], _scrollState.shiftAccumulator);
     position.y += self.bounds.size.height / 2;
     self.center = position;
     [self.delegate flexibleHeaderViewFrameDidChange:self];
@@ -574,7 +573,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   // When we manually set our content offset it's because we're trying to avoid any sort of content
   // jumping behavior, so we ignore immediate content offset delta by resetting the shift
   // accumulator last content offset to the new content offset:
-  _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
+  _scrollState.lastContentOffsetY = [self fhv_boundedContentOffset].y;
 }
 
 - (void)fhv_adjustTrackingScrollViewInsetsForTrackingScrollView:(UIScrollView *)trackingScrollView {
@@ -753,12 +752,50 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 }
 
 - (CGFloat)fhv_accumulatorMax {
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
+  return (CGFloat)MDCFlexibleHeaderScrollAccumulatorMax(&metrics);
+}
+
+// Snapshots the header's configuration for the scroll engine.
+- (MDCFlexibleHeaderScrollMetrics)fhv_scrollMetrics {
+  MDCFlexibleHeaderMinMaxHeight *minMaxHeight = self.minMaxHeight;
   BOOL shouldCollapseToStatusBar = [self fhv_shouldCollapseToStatusBar];
-  CGFloat statusBarHeight = [UIApplication mdc_safeSharedApplication].statusBarFrame.size.height;
-  return (shouldCollapseToStatusBar
-              ? MAX(0, self.minMaxHeight.minimumHeightWithTopSafeArea - statusBarHeight)
-              : self.minMaxHeight.minimumHeightWithTopSafeArea) -
-         self.minimumHeaderViewHeight;
+  MDCFlexibleHeaderScrollMetrics metrics = {
+      .minimumHeightWithTopSafeArea = minMaxHeight.minimumHeightWithTopSafeArea,
+      .maximumHeightWithTopSafeArea = minMaxHeight.maximumHeightWithTopSafeArea,
+      .maximumHeightWithoutTopSafeArea = minMaxHeight.maximumHeightWithoutTopSafeArea,
+      .minimumHeight = self.minimumHeight,
+      .maximumHeight = self.maximumHeight,
+      .minimumHeaderViewHeight = self.minimumHeaderViewHeight,
+      .statusBarHeight = 0,
+      .anchorLength = [self fhv_anchorLength],
+      .collapsesToStatusBar = shouldCollapseToStatusBar,
+      .canAlwaysExpandToMaximumHeight = self.canAlwaysExpandToMaximumHeight,
+      .canOverExtend = _canOverExtend && !UIAccessibilityIsVoiceOverRunning(),
+      // When the shift behavior is MDCFlexibleHeaderShiftBehaviorHideable, we explicitly disable
+      // interactive shifting behaviors so that the header's visibility is controlled only via
+      // direct invocations to -shiftHeaderOnScreenAnimated: and shiftHeaderOffScreenAnimated:
+      .allowsInteractiveShift = _shifter.behavior != MDCFlexibleHeaderShiftBehaviorHideable,
+      .canShiftOffscreen = [self fhv_canShiftOffscreen],
+  };
+  if (shouldCollapseToStatusBar) {
+    metrics.statusBarHeight = [UIApplication mdc_safeSharedApplication].statusBarFrame.size.height;
+  }
+  return metrics;
+}
+
+// Samples the tracking scroll view for the scroll engine.
+- (MDCFlexibleHeaderScrollSample)fhv_scrollSample {
+  MDCFlexibleHeaderScrollSample sample = {
+      .contentOffsetY = _trackingScrollView.contentOffset.y,
+      .topContentInset = [self fhv_rawTopContentInset],
+      .bottomContentInset = _trackingScrollView.contentInset.bottom,
+      .contentHeight = _trackingScrollView.contentSize.height,
+      .viewportHeight = _trackingScrollView.bounds.size.height,
+      .isTracking = _trackingScrollView.isTracking,
+      .isScrubbing = self.trackingScrollViewIsBeingScrubbed,
+  };
+  return sample;
 }
 
 #pragma mark Logical short forms
@@ -780,18 +817,18 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 }
 
 - (BOOL)fhv_isPartiallyShifted {
-  return ([self fhv_isDetachedFromTopOfContent] && _shiftAccumulator > 0 &&
-          _shiftAccumulator < [self fhv_accumulatorMax]);
+  return ([self fhv_isDetachedFromTopOfContent] && _scrollState.shiftAccumulator > 0 &&
+          _scrollState.shiftAccumulator < [self fhv_accumulatorMax]);
 }
 
 - (BOOL)fhv_isFullyShifted {
-  return ([self fhv_isDetachedFromTopOfContent] && _shiftAccumulator > 0 &&
-          _shiftAccumulator >= [self fhv_accumulatorMax]);
+  return ([self fhv_isDetachedFromTopOfContent] && _scrollState.shiftAccumulator > 0 &&
+          _scrollState.shiftAccumulator >= [self fhv_accumulatorMax]);
 }
 
 - (BOOL)fhv_isPartiallyExpanded {
-  return ([self fhv_isDetachedFromTopOfContent] && _shiftAccumulator < 0 &&
-          _shiftAccumulator > -(self.maximumHeight - self.minimumHeight));
+  return ([self fhv_isDetachedFromTopOfContent] && _scrollState.shiftAccumulator < 0 &&
+          _scrollState.shiftAccumulator > -(self.maximumHeight - self.minimumHeight));
 }
 
 // The flexible header is "in front of" the content.
@@ -800,67 +837,19 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   return [self fhv_projectedHeaderBottomEdge] > (CGFloat)0.5;
 }
 
-- (BOOL)fhv_isOverExtendingBottom {
-  CGFloat bottomEdgeOfScrollView =
-      (_trackingScrollView.contentOffset.y + _trackingScrollView.bounds.size.height);
-  CGFloat bottomEdgeOfContent =
-      (_trackingScrollView.contentSize.height + _trackingScrollView.contentInset.bottom);
-  BOOL canOverExtendBottom =
-      (_trackingScrollView.contentSize.height > _trackingScrollView.bounds.size.height);
-  return (canOverExtendBottom && (bottomEdgeOfScrollView >= bottomEdgeOfContent));
-}
-
 #pragma mark Phase Calculation
 
 // Given the current frame, calculates the scroll phase, value, and percentage.
-- (void)fhv_recalculatePhase {
-  CGRect frame = self.frame;
-
-  CGFloat topEdge = self.center.y - self.bounds.size.height / 2;
-
-  if (topEdge < 0) {
-    _scrollPhase = MDCFlexibleHeaderScrollPhaseShifting;
-    _scrollPhaseValue = topEdge + self.minMaxHeight.minimumHeightWithTopSafeArea;
-    CGFloat adjustedHeight = self.minMaxHeight.minimumHeightWithTopSafeArea;
-    if ([self fhv_shouldCollapseToStatusBar]) {
-      CGFloat statusBarHeight =
-          [UIApplication mdc_safeSharedApplication].statusBarFrame.size.height;
-      adjustedHeight -= statusBarHeight;
-    }
-    if (adjustedHeight > 0) {
-      _scrollPhasePercentage = -topEdge / adjustedHeight;
-    } else {
-      _scrollPhasePercentage = 0;
-    }
-
-    return;
-  }
-
-  _scrollPhaseValue = frame.size.height;
-
-  if (frame.size.height < self.minMaxHeight.maximumHeightWithTopSafeArea) {
-    _scrollPhase = MDCFlexibleHeaderScrollPhaseCollapsing;
-
-    CGFloat heightLength = self.minMaxHeight.maximumHeightWithTopSafeArea -
-                           self.minMaxHeight.minimumHeightWithTopSafeArea;
-    if (heightLength > 0) {
-      _scrollPhasePercentage =
-          (frame.size.height - self.minMaxHeight.minimumHeightWithTopSafeArea) / heightLength;
-    } else {
-      _scrollPhasePercentage = 0;
-    }
-
-    return;
-  }
+- (void)fhv_recalculatePhaseWithMetrics:(const MDCFlexibleHeaderScrollMetrics *)metrics {
+  MDCFlexibleHeaderScrollFrame frame = {
+      .height = self.frame.size.height,
+      .shiftOffset = -(self.center.y - self.bounds.size.height / 2),
+  };
+  MDCFlexibleHeaderScrollFrameCalculatePhase(metrics, &frame);
 
-  _scrollPhase = MDCFlexibleHeaderScrollPhaseOverExtending;
-  if (self.minMaxHeight.maximumHeightWithTopSafeArea > 0) {
-    _scrollPhasePercentage =
-        1 + (frame.size.height - self.minMaxHeight.maximumHeightWithTopSafeArea) /
-                self.minMaxHeight.maximumHeightWithTopSafeArea;
-  } else {
-    _scrollPhasePercentage = 0;
-  }
+  _scrollPhase = (MDCFlexibleHeaderScrollPhase)frame.phase;
+  _scrollPhaseValue = (CGFloat)frame.phaseValue;
+  _scrollPhasePercentage = (CGFloat)frame.phasePercentage;
 }
 
 #pragma mark Display Link
@@ -889,66 +878,39 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
       [CADisplayLink displayLinkWithTarget:self
                                   selector:@selector(fhv_shiftAccumulatorDisplayLinkDidFire:)];
   [_shiftAccumulatorDisplayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+  _scrollState.isSettling = YES;
 }
 
 - (void)fhv_stopDisplayLink {
   [_shiftAccumulatorDisplayLink invalidate];
   _shiftAccumulatorDisplayLink = nil;
+  _scrollState.isSettling = NO;
 }
 
 - (void)fhv_shiftAccumulatorDisplayLinkDidFire:(CADisplayLink *)displayLink {
-  // Erase any scrollback that was injected into the accumulator by capping it back down.
-  _shiftAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-
-  CGFloat destination;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    if (_shiftAccumulator > 0) {  // Shifted
-      destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
-
-    } else if (_shiftAccumulator < 0) {  // Expanded
-      destination = _wantsToBeHidden ? 0 : [self fhv_accumulatorMin];
-
-    } else {
-      destination = 0;
-    }
-
-  } else {
-    destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
-  }
-
-  CGFloat distanceToDestination = destination - _shiftAccumulator;
-
   NSTimeInterval duration = displayLink.duration;
 
 #if TARGET_IPHONE_SIMULATOR
   duration /= [self fhv_dragCoefficient];
 #endif
 
-  // This is a simple "force" that's stronger the further we are from the destination.
-  _shiftAccumulator += (CGFloat)(kAttachmentCoefficient * distanceToDestination * duration);
-
-  if (self.canAlwaysExpandToMaximumHeight) {
-    _shiftAccumulator =
-        MAX([self fhv_accumulatorMin], MIN([self fhv_accumulatorMax], _shiftAccumulator));
-    [_statusBarShifter setOffset:MAX(0, _shiftAccumulator)];
-  } else {
-    _shiftAccumulator = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-    [_statusBarShifter setOffset:_shiftAccumulator];
-  }
-
-  // Have we reached our destination?
-  if (fabs(destination - _shiftAccumulator) <= kShiftEpsilon) {
-    _shiftAccumulator = destination;
-
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
+  CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
+  if (MDCFlexibleHeaderScrollStateSettle(&_scrollState, &metrics, headerHeight, duration)) {
     [self fhv_stopDisplayLink];
   }
 
-  [self fhv_commitAccumulatorToFrame];
+  [self fhv_commitAccumulatorToFrameWithMetrics:&metrics];
 }
 
 #pragma mark Shift Accumulator
 
 - (void)fhv_accumulatorDidChange {
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
+  [self fhv_accumulatorDidChangeWithMetrics:&metrics];
+}
+
+- (void)fhv_accumulatorDidChangeWithMetrics:(const MDCFlexibleHeaderScrollMetrics *)metrics {
   if (!_trackingScrollView) {
     // Set the shadow opacity directly.
     self.layer.shadowOpacity =
@@ -962,11 +924,12 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 
   CGFloat frameBottomEdge = [self fhv_projectedHeaderBottomEdge];
   frameBottomEdge = MAX(0, MIN(kShadowScaleLength, frameBottomEdge));
+  CGFloat accumulatorMax = (CGFloat)MDCFlexibleHeaderScrollAccumulatorMax(metrics);
   CGFloat boundedAccumulator;
   if (self.canAlwaysExpandToMaximumHeight) {
-    boundedAccumulator = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
+    boundedAccumulator = MAX(0, MIN(accumulatorMax, _scrollState.shiftAccumulator));
   } else {
-    boundedAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
+    boundedAccumulator = MIN(accumulatorMax, _scrollState.shiftAccumulator);
   }
 
   CGFloat shadowIntensity;
@@ -1030,26 +993,9 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 #pragma mark Layout
 
 - (CGFloat)fhv_accumulatorMin {
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
   CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
-
-  CGFloat lowerBound;
-
-  if (self.canAlwaysExpandToMaximumHeight) {
-    CGFloat maxExpansion;
-    if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-      // The header is detached from the content and able to fully expand.
-      maxExpansion = self.maximumHeight - self.minimumHeight;
-    } else {
-      // We're now attached to the content and need to constrain our possible expansion.
-      maxExpansion = self.minMaxHeight.maximumHeightWithTopSafeArea - headerHeight;
-    }
-    // Expansion is tracked via negative accumulation.
-    lowerBound = MIN(0, -maxExpansion);
-  } else {
-    lowerBound = 0;
-  }
-
-  return lowerBound;
+  return (CGFloat)MDCFlexibleHeaderScrollAccumulatorMin(&metrics, headerHeight);
 }
 
 - (void)fhv_updateLayout {
@@ -1069,139 +1015,24 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   // are up-to-date before we process the content offset.
   [self fhv_enforceInsetsForScrollView:_trackingScrollView];
 
-  // We use the content offset to calculate the unclamped height of the frame.
-  CGFloat offsetWithoutInset = [self fhv_contentOffsetWithoutInjectedTopInset];
-  CGFloat headerHeight = -offsetWithoutInset;
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
+  MDCFlexibleHeaderScrollSample sample = [self fhv_scrollSample];
+  MDCFlexibleHeaderScrollStateProcessSample(&_scrollState, &metrics, &sample);
 
-  if (_trackingScrollView.isTracking) {
+  // The engine stops settling as soon as the user touches the scroll view.
+  if (_shiftAccumulatorDisplayLink && !_scrollState.isSettling) {
     [self fhv_stopDisplayLink];
   }
 
-  // When the shift behavior is MDCFlexibleHeaderShiftBehaviorHideable, we explicitly disable
-  // interactive shifting behaviors so that the header's visibility is controlled only via direct
-  // invocations to -shiftHeaderOnScreenAnimated: and shiftHeaderOffScreenAnimated:
-  BOOL allowsInteractiveShift = _shifter.behavior != MDCFlexibleHeaderShiftBehaviorHideable;
-
-  if (_shiftAccumulatorLastContentOffsetIsValid && allowsInteractiveShift) {
-    // We track the last direction for our target offset behavior.
-    CGFloat deltaY = [self fhv_boundedContentOffset].y - _shiftAccumulatorLastContentOffset.y;
-
-    if (_shiftAccumulatorDeltaY * deltaY < 0) {
-      // Direction has changed.
-      _shiftAccumulatorDeltaY = 0;
-    }
-    _shiftAccumulatorDeltaY += deltaY;
-
-    // Keeps track of the last direction the user moved their finger in.
-    if (_trackingScrollView.isTracking) {
-      if (_shiftAccumulatorDeltaY > kDeltaYSlop) {
-        _wantsToBeHidden = YES;
-      } else if (_shiftAccumulatorDeltaY < -kDeltaYSlop) {
-        _wantsToBeHidden = NO;
-      }
-    }
-
-    if (![self fhv_isOverExtendingBottom] && !_shiftAccumulatorDisplayLink) {
-      if (!self.canAlwaysExpandToMaximumHeight) {
-        // When we're not allowed to shift offscreen, only allow the header to shift further
-        // on-screen in case it was previously off-screen due to a behavior change.
-        if (![self fhv_canShiftOffscreen]) {
-          deltaY = MIN(0, deltaY);
-        }
-      }
-
-      // When scrubbing we only allow the header to shrink and shift off-screen.
-      if (self.trackingScrollViewIsBeingScrubbed) {
-        deltaY = MAX(0, deltaY);
-      }
-
-      if (self.canAlwaysExpandToMaximumHeight) {
-        // When still attached to the top content, don't accumulate negatively.
-        if (headerHeight >= self.minMaxHeight.minimumHeightWithTopSafeArea) {
-          deltaY = MAX(0, deltaY);
-        }
-      }
-
-      // Check if our delta y will cause us to cross the boundary from shrinking to shifting and,
-      // if so, cap the deltaY to only the overshoot, otherwise the header will overshift.
-
-      // headerHeight and deltaY are in inverted coordinate spaces, so when we do
-      // headerHeight + deltaY we're calculating where the headerHeight was _before_ this update.
-
-      CGFloat previousHeaderHeight = headerHeight + deltaY;
-
-      // Overshoot coming in
-      if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea &&
-          previousHeaderHeight > self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = self.minMaxHeight.minimumHeightWithTopSafeArea - headerHeight;
-
-        // Overshoot going out
-      } else if (headerHeight > self.minMaxHeight.minimumHeightWithTopSafeArea &&
-                 previousHeaderHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = (headerHeight + deltaY) - self.minMaxHeight.minimumHeightWithTopSafeArea;
-      }
-
-      // Calculate the upper bound of the accumulator based on what phase we're in.
-      CGFloat upperBound = [self upperBoundWithHeaderHeight:headerHeight];
-
-      // Ensure that we don't lose any deltaY by first capping the accumulator within its valid
-      // range.
-      _shiftAccumulator = MIN(upperBound, _shiftAccumulator);
-
-      // Accumulate the deltaY.
-      if (self.canAlwaysExpandToMaximumHeight) {
-        CGFloat lowerBound = [self fhv_accumulatorMin];
-        _shiftAccumulator = MAX(lowerBound, MIN(upperBound, _shiftAccumulator + deltaY));
-      } else {
-        _shiftAccumulator = MAX(0, MIN(upperBound, _shiftAccumulator + deltaY));
-      }
-    }
-  }
-
   if (!self.canAlwaysExpandToMaximumHeight) {
     CGRect bounds = self.bounds;
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight);
-    } else {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                               MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight));
-    }
+    CGFloat headerHeight = (CGFloat)MDCFlexibleHeaderScrollSampleHeaderHeight(&sample);
+    bounds.size.height = (CGFloat)MDCFlexibleHeaderScrollHeight(&metrics, headerHeight,
+                                                                _scrollState.shiftAccumulator);
     self.bounds = bounds;
   }
 
-  [self fhv_commitAccumulatorToFrame];
-
-  _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
-  _shiftAccumulatorLastContentOffsetIsValid = YES;
-}
-
-- (CGFloat)upperBoundWithHeaderHeight:(CGFloat)headerHeight {
-  CGFloat upperBound;
-  if (self.canAlwaysExpandToMaximumHeight && ![self fhv_canShiftOffscreen]) {
-    // Don't allow any shifting.
-    upperBound = 0;
-  } else if (headerHeight < 0) {
-    if (self.minimumHeaderViewHeight != 0.0) {
-      // Set upperBound distance to be between
-      // |maximum height| and |remaining minimum height after shifting|.
-      upperBound = self.minMaxHeight.maximumHeightWithoutTopSafeArea - self.minimumHeaderViewHeight;
-    } else {
-      upperBound = [self fhv_accumulatorMax] + [self fhv_anchorLength];
-    }
-  } else if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-    if (self.minimumHeaderViewHeight != 0.0) {
-      // Set upperBound distance to be between
-      // |maximum height| and |remaining minimum height after shifting|.
-      upperBound = self.minMaxHeight.maximumHeightWithoutTopSafeArea - self.minimumHeaderViewHeight;
-    } else {
-      upperBound = [self fhv_accumulatorMax];
-    }
-
-  } else {
-    // Header is not shifting.
-    upperBound = 0;
-  }
-  return upperBound;
+  [self fhv_commitAccumulatorToFrameWithMetrics:&metrics];
 }
 
 - (CGFloat)fhv_anchorLength {
@@ -1216,21 +1047,16 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 
 // Commit the current shiftOffscreenAccumulator value to the view's position.
 - (void)fhv_commitAccumulatorToFrame {
+  MDCFlexibleHeaderScrollMetrics metrics = [self fhv_scrollMetrics];
+  [self fhv_commitAccumulatorToFrameWithMetrics:&metrics];
+}
+
+- (void)fhv_commitAccumulatorToFrameWithMetrics:(const MDCFlexibleHeaderScrollMetrics *)metrics {
   if (self.canAlwaysExpandToMaximumHeight) {
-    CGFloat offsetWithoutInset = [self fhv_contentOffsetWithoutInjectedTopInset];
-    CGFloat headerHeight = -offsetWithoutInset;
+    CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
     CGRect bounds = self.bounds;
-
-    CGFloat additionalHeightInjection = MAX(0, -_shiftAccumulator);
-
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight) +
-                           additionalHeightInjection;
-    } else {
-      bounds.size.height = (MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                                MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight)) +
-                            additionalHeightInjection);
-    }
+    bounds.size.height = (CGFloat)MDCFlexibleHeaderScrollHeight(metrics, headerHeight,
+                                                                _scrollState.shiftAccumulator);
 
     // Avoid excessive writes - the default behavior of the flexible header has minimal height
     // adjustment behavior (basically only when over-extending).
@@ -1240,22 +1066,19 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   }
 
   CGPoint position = self.center;
-  CGFloat shiftOffset;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    shiftOffset = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-  } else {
-    shiftOffset = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-  }
+  CGFloat shiftOffset =
+      (CGFloat)MDCFlexibleHeaderScrollShiftOffset(metrics, _scrollState.shiftAccumulator);
   // Offset the frame.
   position.y = -shiftOffset;
   position.y += self.bounds.size.height / 2;
 
   self.center = position;
 
-  [self fhv_accumulatorDidChange];
-  [self fhv_recalculatePhase];
+  [self fhv_accumulatorDidChangeWithMetrics:metrics];
+  [self fhv_recalculatePhaseWithMetrics:metrics];
 
-  CGFloat opacityShiftThreshold = [self fhv_accumulatorMax] * kContentHidingThreshold;
+  CGFloat opacityShiftThreshold =
+      (CGFloat)MDCFlexibleHeaderScrollAccumulatorMax(metrics) * kContentHidingThreshold;
   // 0% means not shifted at all, 100% means shifted up to our threshold amount.
   CGFloat percentShiftedAlongThreshold = MIN(1, MAX(0, shiftOffset / opacityShiftThreshold));
   for (UIView *view in _viewsToHideWhenShifted) {
@@ -1264,7 +1087,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
     view.alpha = 1 - percentShiftedAlongThreshold;
   }
 
-  [_statusBarShifter setOffset:_shiftAccumulator];
+  [_statusBarShifter setOffset:_scrollState.shiftAccumulator];
 
   [self.delegate flexibleHeaderViewFrameDidChange:self];
 }
@@ -1277,16 +1100,17 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   if (_trackingInfo.shouldIgnoreNextSafeAreaAdjustment) {
     _trackingInfo.shouldIgnoreNextSafeAreaAdjustment = NO;
 
-    if (_shiftAccumulatorLastContentOffsetIsValid) {
-      CGFloat delta = (CGFloat)fabs(_shiftAccumulatorLastContentOffset.y -
+    if (_scrollState.lastContentOffsetIsValid) {
+      CGFloat delta = (CGFloat)fabs(_scrollState.lastContentOffsetY -
                                     self.trackingScrollView.contentOffset.y);
       if (fabs(delta - [_topSafeArea topSafeAreaInset]) < kContentOffsetEpsilon) {
         // Looks like a top safe area inset adjustment. Let's ignore it.
-        self.trackingScrollView.contentOffset = _shiftAccumulatorLastContentOffset;
+        self.trackingScrollView.contentOffset =
+            CGPointMake(self.trackingScrollView.contentOffset.x, _scrollState.lastContentOffsetY);
         return;
       }
     }
-    _shiftAccumulatorLastContentOffsetIsValid = NO;
+    _scrollState.lastContentOffsetIsValid = NO;
   }
 
   if (self.trackingScrollView.isTracking) {
@@ -1490,7 +1314,7 @@ static BOOL isRunningiOS10_3OrAbove() {
 
   MDCFlexibleHeaderScrollViewInfo *info = [_trackedScrollViews objectForKey:scrollView];
 
-  if (_shiftAccumulator >= [self fhv_accumulatorMax]) {
+  if (_scrollState.shiftAccumulator >= [self fhv_accumulatorMax]) {
     // We're shifted off-screen, make sure that this scroll view isn't expecting to show the header.
 
     CGPoint offset = scrollView.contentOffset;
@@ -1581,9 +1405,9 @@ static BOOL isRunningiOS10_3OrAbove() {
     [self fhv_removeInsetsFromScrollView:oldTrackingScrollView];
   }
 
-  _shiftAccumulatorLastContentOffsetIsValid = NO;
-  _shiftAccumulatorLastContentOffset = _trackingScrollView.contentOffset;
-  _shiftAccumulatorDeltaY = 0;
+  _scrollState.lastContentOffsetIsValid = NO;
+  _scrollState.lastContentOffsetY = _trackingScrollView.contentOffset.y;
+  _scrollState.accumulatedDeltaY = 0;
 
   _trackingInfo = [_trackedScrollViews objectForKey:_trackingScrollView];
   _trackingInfo.stashedHeightIsValid = NO;
@@ -1621,9 +1445,10 @@ static BOOL isRunningiOS10_3OrAbove() {
       }
       // Adjust the accumulator so that our height won't change and cap it to the possible range.
       CGFloat desiredShiftAccumulatorValue =
-          MAX(accumulatorMin, MIN([self fhv_accumulatorMax], _shiftAccumulator - heightDelta));
-      if (_shiftAccumulator != desiredShiftAccumulatorValue) {
-        _shiftAccumulator = desiredShiftAccumulatorValue;
+          MAX(accumulatorMin,
+              MIN([self fhv_accumulatorMax], _scrollState.shiftAccumulator - heightDelta));
+      if (_scrollState.shiftAccumulator != desiredShiftAccumulatorValue) {
+        _scrollState.shiftAccumulator = desiredShiftAccumulatorValue;
       }
     }
 
@@ -1712,14 +1537,14 @@ static BOOL isRunningiOS10_3OrAbove() {
 
   if (self.canAlwaysExpandToMaximumHeight) {
     if (![self fhv_canShiftOffscreen] && [self fhv_isPartiallyShifted]) {
-      _wantsToBeHidden = NO;
+      _scrollState.wantsToBeHidden = NO;
     }
     if (!willDecelerate && ([self fhv_isPartiallyShifted] || [self fhv_isPartiallyExpanded])) {
       [self fhv_startDisplayLink];
     }
   } else {
     if (![self fhv_canShiftOffscreen]) {
-      _wantsToBeHidden = NO;
+      _scrollState.wantsToBeHidden = NO;
     }
     if (!willDecelerate && [self fhv_isPartiallyShifted]) {
       [self fhv_startDisplayLink];
@@ -1744,12 +1569,14 @@ static BOOL isRunningiOS10_3OrAbove() {
     return;
   }
   if ([self fhv_isPartiallyShifted]) {
-    _wantsToBeHidden =
-        (_shiftAccumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMax]);
+    _scrollState.wantsToBeHidden =
+        (_scrollState.shiftAccumulator >=
+         (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMax]);
     [self fhv_startDisplayLink];
   } else if ([self fhv_isPartiallyExpanded]) {
-    _wantsToBeHidden =
-        (_shiftAccumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMin]);
+    _scrollState.wantsToBeHidden =
+        (_scrollState.shiftAccumulator >=
+         (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMin]);
     [self fhv_startDisplayLink];
   }
 }
@@ -1789,7 +1616,7 @@ static BOOL isRunningiOS10_3OrAbove() {
   _statusBarShifter.enabled = [self fhv_shouldAllowShifting];
 
   if (needsShiftOnScreen) {
-    _wantsToBeHidden = NO;
+    _scrollState.wantsToBeHidden = NO;
     [self fhv_startDisplayLink];
   }
 }
@@ -1835,7 +1662,7 @@ static BOOL isRunningiOS10_3OrAbove() {
   _interfaceOrientationIsChanging = NO;
 
   // Ignore any content offset delta that occured as a result of any orientation change.
-  _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
+  _scrollState.lastContentOffsetY = [self fhv_boundedContentOffset].y;
 
   [self fhv_updateLayout];
 
@@ -1928,7 +1755,7 @@ static BOOL isRunningiOS10_3OrAbove() {
     if ([self fhv_canShiftOffscreen] &&
         (0 < flexHeight && flexHeight < self.minMaxHeight.minimumHeightWithTopSafeArea)) {
       // Don't allow the header to be partially visible.
-      if (_wantsToBeHidden) {
+      if (_scrollState.wantsToBeHidden) {
         target.y = -[self fhv_rawTopContentInset];
       } else {
         target.y = -self.minMaxHeight.minimumHeightWithTopSafeArea - [self fhv_rawTopContentInset];
@@ -1941,10 +1768,10 @@ static BOOL isRunningiOS10_3OrAbove() {
     CGPoint target = *targetContentOffset;
 
     // Don't allow the header to be partially expanded.
-    if (_wantsToBeHidden) {
-      target.y -= _shiftAccumulator;
+    if (_scrollState.wantsToBeHidden) {
+      target.y -= _scrollState.shiftAccumulator;
     } else {
-      target.y += ([self fhv_accumulatorMin] - _shiftAccumulator);
+      target.y += ([self fhv_accumulatorMin] - _scrollState.shiftAccumulator);
     }
     *targetContentOffset = target;
     return YES;
@@ -1968,25 +1795,25 @@ static BOOL isRunningiOS10_3OrAbove() {
 }
 
 - (void)shiftHeaderOnScreenAnimated:(BOOL)animated {
-  _wantsToBeHidden = NO;
+  _scrollState.wantsToBeHidden = NO;
 
   if (animated) {
     [self fhv_startDisplayLink];
   } else {
     // Remove any offscreen accumulation.
-    _shiftAccumulator = 0;
+    _scrollState.shiftAccumulator = 0;
     [self fhv_commitAccumulatorToFrame];
   }
 }
 
 - (void)shiftHeaderOffScreenAnimated:(BOOL)animated {
-  _wantsToBeHidden = YES;
+  _scrollState.wantsToBeHidden = YES;
 
   if (animated) {
     [self fhv_startDisplayLink];
   } else {
     // Add offscreen accumulation equal to this header view's size.
-    _shiftAccumulator = self.fhv_accumulatorMax;
+    _scrollState.shiftAccumulator = self.fhv_accumulatorMax;
     [self fhv_commitAccumulatorToFrame];
   }
 }
@@ -2039,7 +1866,7 @@ static BOOL isRunningiOS10_3OrAbove() {
 }
 
 - (BOOL)isShiftedOffscreen {
-  return _wantsToBeHidden || [self fhv_isFullyShifted];
+  return _scrollState.wantsToBeHidden || [self fhv_isFullyShifted];
 }
 
 #pragma mark - MDCElevation
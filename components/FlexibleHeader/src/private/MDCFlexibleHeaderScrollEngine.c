@@ -0,0 +1,293 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MDCFlexibleHeaderScrollEngine.h"
+
+#include <math.h>
+
+// The epsilon used to decide that the settling header has reached its destination.
+static const float kShiftEpsilon = 0.1f;
+
+// How far the user must scroll in one direction before the header's desired visibility follows.
+static const double kDeltaYSlop = 5;
+
+// The strength of the "force" that pulls a settling header towards its destination.
+static const double kAttachmentCoefficient = 12;
+
+static inline double Clamp(double value, double lowerBound, double upperBound) {
+  return fmax(lowerBound, fmin(upperBound, value));
+}
+
+// Samples
+
+double MDCFlexibleHeaderScrollSampleHeaderHeight(const MDCFlexibleHeaderScrollSample *sample) {
+  return -(sample->contentOffsetY + sample->topContentInset);
+}
+
+double MDCFlexibleHeaderScrollSampleBoundedContentOffsetY(
+    const MDCFlexibleHeaderScrollSample *sample) {
+  // We don't care about rubber banding beyond the bottom of the content.
+  return fmin(sample->contentOffsetY, sample->contentHeight - sample->viewportHeight);
+}
+
+bool MDCFlexibleHeaderScrollSampleIsOverExtendingBottom(
+    const MDCFlexibleHeaderScrollSample *sample) {
+  double bottomEdgeOfScrollView = sample->contentOffsetY + sample->viewportHeight;
+  double bottomEdgeOfContent = sample->contentHeight + sample->bottomContentInset;
+  bool canOverExtendBottom = sample->contentHeight > sample->viewportHeight;
+  return canOverExtendBottom && bottomEdgeOfScrollView >= bottomEdgeOfContent;
+}
+
+// Accumulator bounds
+
+double MDCFlexibleHeaderScrollAccumulatorMax(const MDCFlexibleHeaderScrollMetrics *metrics) {
+  double shiftableHeight =
+      metrics->collapsesToStatusBar
+          ? fmax(0, metrics->minimumHeightWithTopSafeArea - metrics->statusBarHeight)
+          : metrics->minimumHeightWithTopSafeArea;
+  return shiftableHeight - metrics->minimumHeaderViewHeight;
+}
+
+double MDCFlexibleHeaderScrollAccumulatorMin(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                             double headerHeight) {
+  if (!metrics->canAlwaysExpandToMaximumHeight) {
+    return 0;
+  }
+  double maxExpansion;
+  if (headerHeight < metrics->minimumHeightWithTopSafeArea) {
+    // The header is detached from the content and able to fully expand.
+    maxExpansion = metrics->maximumHeight - metrics->minimumHeight;
+  } else {
+    // We're now attached to the content and need to constrain our possible expansion.
+    maxExpansion = metrics->maximumHeightWithTopSafeArea - headerHeight;
+  }
+  // Expansion is tracked via negative accumulation.
+  return fmin(0, -maxExpansion);
+}
+
+double MDCFlexibleHeaderScrollAccumulatorUpperBound(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                                    double headerHeight) {
+  if (metrics->canAlwaysExpandToMaximumHeight && !metrics->canShiftOffscreen) {
+    // Don't allow any shifting.
+    return 0;
+  }
+  if (headerHeight >= 0 && headerHeight >= metrics->minimumHeightWithTopSafeArea) {
+    // Header is not shifting.
+    return 0;
+  }
+  if (metrics->minimumHeaderViewHeight != 0) {
+    // Set upperBound distance to be between
+    // |maximum height| and |remaining minimum height after shifting|.
+    return metrics->maximumHeightWithoutTopSafeArea - metrics->minimumHeaderViewHeight;
+  }
+  double accumulatorMax = MDCFlexibleHeaderScrollAccumulatorMax(metrics);
+  if (headerHeight < 0) {
+    // The header is detached from the content, so it can be dragged past fully shifted.
+    return accumulatorMax + metrics->anchorLength;
+  }
+  return accumulatorMax;
+}
+
+// State transitions
+
+void MDCFlexibleHeaderScrollStateProcessSample(MDCFlexibleHeaderScrollState *state,
+                                               const MDCFlexibleHeaderScrollMetrics *metrics,
+                                               const MDCFlexibleHeaderScrollSample *sample) {
+  double headerHeight = MDCFlexibleHeaderScrollSampleHeaderHeight(sample);
+  double boundedContentOffsetY = MDCFlexibleHeaderScrollSampleBoundedContentOffsetY(sample);
+
+  if (sample->isTracking) {
+    state->isSettling = false;
+  }
+
+  if (state->lastContentOffsetIsValid && metrics->allowsInteractiveShift) {
+    // We track the last direction for our target offset behavior.
+    double deltaY = boundedContentOffsetY - state->lastContentOffsetY;
+
+    if (state->accumulatedDeltaY * deltaY < 0) {
+      // Direction has changed.
+      state->accumulatedDeltaY = 0;
+    }
+    state->accumulatedDeltaY += deltaY;
+
+    // Keeps track of the last direction the user moved their finger in.
+    if (sample->isTracking) {
+      if (state->accumulatedDeltaY > kDeltaYSlop) {
+        state->wantsToBeHidden = true;
+      } else if (state->accumulatedDeltaY < -kDeltaYSlop) {
+        state->wantsToBeHidden = false;
+      }
+    }
+
+    if (!MDCFlexibleHeaderScrollSampleIsOverExtendingBottom(sample) && !state->isSettling) {
+      // When we're not allowed to shift offscreen, only allow the header to shift further on-screen
+      // in case it was previously off-screen due to a behavior change.
+      if (!metrics->canAlwaysExpandToMaximumHeight && !metrics->canShiftOffscreen) {
+        deltaY = fmin(0, deltaY);
+      }
+
+      // When scrubbing we only allow the header to shrink and shift off-screen.
+      if (sample->isScrubbing) {
+        deltaY = fmax(0, deltaY);
+      }
+
+      // When still attached to the top content, don't accumulate negatively.
+      if (metrics->canAlwaysExpandToMaximumHeight &&
+          headerHeight >= metrics->minimumHeightWithTopSafeArea) {
+        deltaY = fmax(0, deltaY);
+      }
+
+      // Check if our delta y will cause us to cross the boundary from shrinking to shifting and,
+      // if so, cap the deltaY to only the overshoot, otherwise the header will overshift.
+      //
+      // headerHeight and deltaY are in inverted coordinate spaces, so headerHeight + deltaY is
+      // where the headerHeight was _before_ this sample.
+      double minimumHeight = metrics->minimumHeightWithTopSafeArea;
+      double previousHeaderHeight = headerHeight + deltaY;
+      if (headerHeight < minimumHeight && previousHeaderHeight > minimumHeight) {
+        // Overshoot coming in.
+        deltaY = minimumHeight - headerHeight;
+      } else if (headerHeight > minimumHeight && previousHeaderHeight < minimumHeight) {
+        // Overshoot going out.
+        deltaY = previousHeaderHeight - minimumHeight;
+      }
+
+      double upperBound = MDCFlexibleHeaderScrollAccumulatorUpperBound(metrics, headerHeight);
+
+      // Ensure that we don't lose any deltaY by first capping the accumulator within its valid
+      // range.
+      state->shiftAccumulator = fmin(upperBound, state->shiftAccumulator);
+
+      double lowerBound = MDCFlexibleHeaderScrollAccumulatorMin(metrics, headerHeight);
+      state->shiftAccumulator = Clamp(state->shiftAccumulator + deltaY, lowerBound, upperBound);
+    }
+  }
+
+  state->lastContentOffsetY = boundedContentOffsetY;
+  state->lastContentOffsetIsValid = true;
+}
+
+bool MDCFlexibleHeaderScrollStateSettle(MDCFlexibleHeaderScrollState *state,
+                                        const MDCFlexibleHeaderScrollMetrics *metrics,
+                                        double headerHeight, double duration) {
+  double accumulatorMax = MDCFlexibleHeaderScrollAccumulatorMax(metrics);
+  double accumulatorMin = MDCFlexibleHeaderScrollAccumulatorMin(metrics, headerHeight);
+
+  // Erase any scrollback that was injected into the accumulator by capping it back down.
+  state->shiftAccumulator = fmin(accumulatorMax, state->shiftAccumulator);
+
+  double destination = 0;
+  if (state->shiftAccumulator > 0 || !metrics->canAlwaysExpandToMaximumHeight) {  // Shifted
+    destination = state->wantsToBeHidden ? accumulatorMax : 0;
+  } else if (state->shiftAccumulator < 0) {  // Expanded
+    destination = state->wantsToBeHidden ? 0 : accumulatorMin;
+  }
+
+  // This is a simple "force" that's stronger the further we are from the destination.
+  double distanceToDestination = destination - state->shiftAccumulator;
+  state->shiftAccumulator += kAttachmentCoefficient * distanceToDestination * duration;
+  state->shiftAccumulator =
+      Clamp(state->shiftAccumulator,
+            metrics->canAlwaysExpandToMaximumHeight ? accumulatorMin : 0, accumulatorMax);
+
+  // Have we reached our destination?
+  if (fabs(destination - state->shiftAccumulator) <= kShiftEpsilon) {
+    state->shiftAccumulator = destination;
+    state->isSettling = false;
+    return true;
+  }
+  return false;
+}
+
+// Frames
+
+double MDCFlexibleHeaderScrollHeight(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                     double headerHeight, double accumulator) {
+  double height;
+  if (metrics->canOverExtend) {
+    height = fmax(metrics->minimumHeightWithTopSafeArea, headerHeight);
+  } else {
+    height = Clamp(headerHeight, metrics->minimumHeightWithTopSafeArea,
+                   metrics->maximumHeightWithTopSafeArea);
+  }
+  if (metrics->canAlwaysExpandToMaximumHeight) {
+    height += fmax(0, -accumulator);
+  }
+  return height;
+}
+
+double MDCFlexibleHeaderScrollShiftOffset(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                          double accumulator) {
+  double shiftOffset = fmin(MDCFlexibleHeaderScrollAccumulatorMax(metrics), accumulator);
+  if (metrics->canAlwaysExpandToMaximumHeight) {
+    // Expansion is applied to the height, not the position.
+    shiftOffset = fmax(0, shiftOffset);
+  }
+  return shiftOffset;
+}
+
+void MDCFlexibleHeaderScrollFrameCalculatePhase(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                                MDCFlexibleHeaderScrollFrame *frame) {
+  double minimumHeight = metrics->minimumHeightWithTopSafeArea;
+  double maximumHeight = metrics->maximumHeightWithTopSafeArea;
+  double topEdge = -frame->shiftOffset;
+
+  if (topEdge < 0) {
+    frame->phase = MDCFlexibleHeaderScrollEnginePhaseShifting;
+    frame->phaseValue = topEdge + minimumHeight;
+    double adjustedHeight = minimumHeight;
+    if (metrics->collapsesToStatusBar) {
+      adjustedHeight -= metrics->statusBarHeight;
+    }
+    frame->phasePercentage = adjustedHeight > 0 ? -topEdge / adjustedHeight : 0;
+    return;
+  }
+
+  frame->phaseValue = frame->height;
+
+  if (frame->height < maximumHeight) {
+    frame->phase = MDCFlexibleHeaderScrollEnginePhaseCollapsing;
+    double heightLength = maximumHeight - minimumHeight;
+    frame->phasePercentage = heightLength > 0 ? (frame->height - minimumHeight) / heightLength : 0;
+    return;
+  }
+
+  frame->phase = MDCFlexibleHeaderScrollEnginePhaseOverExtending;
+  frame->phasePercentage =
+      maximumHeight > 0 ? 1 + (frame->height - maximumHeight) / maximumHeight : 0;
+}
+
+void MDCFlexibleHeaderScrollFrameCalculate(const MDCFlexibleHeaderScrollState *state,
+                                           const MDCFlexibleHeaderScrollMetrics *metrics,
+                                           double headerHeight,
+                                           MDCFlexibleHeaderScrollFrame *frame) {
+  frame->height = MDCFlexibleHeaderScrollHeight(metrics, headerHeight, state->shiftAccumulator);
+  frame->shiftOffset = MDCFlexibleHeaderScrollShiftOffset(metrics, state->shiftAccumulator);
+  MDCFlexibleHeaderScrollFrameCalculatePhase(metrics, frame);
+}
+
+// Replay
+
+void MDCFlexibleHeaderScrollReplay(MDCFlexibleHeaderScrollState *state,
+                                   const MDCFlexibleHeaderScrollMetrics *metrics,
+                                   const MDCFlexibleHeaderScrollSample *samples, size_t count,
+                                   MDCFlexibleHeaderScrollFrame *frames) {
+  for (size_t i = 0; i < count; i++) {
+    const MDCFlexibleHeaderScrollSample *sample = &samples[i];
+    MDCFlexibleHeaderScrollStateProcessSample(state, metrics, sample);
+    MDCFlexibleHeaderScrollFrameCalculate(state, metrics,
+                                          MDCFlexibleHeaderScrollSampleHeaderHeight(sample),
+                                          &frames[i]);
+  }
+}
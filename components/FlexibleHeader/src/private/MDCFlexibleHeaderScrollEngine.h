@@ -0,0 +1,185 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MDCFlexibleHeaderScrollEngine_h
+#define MDCFlexibleHeaderScrollEngine_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ The scroll physics behind MDCFlexibleHeaderView.
+
+ The engine is a value-type state machine with no UIKit, CoreGraphics or Foundation dependency. It
+ is fed samples of the tracking scroll view and produces the header's height, shift offset and
+ scroll phase, so that the view only has to read its scroll view and apply the results.
+ */
+
+/** Mirrors MDCFlexibleHeaderScrollPhase. */
+typedef enum MDCFlexibleHeaderScrollEnginePhase {
+  MDCFlexibleHeaderScrollEnginePhaseShifting = 0,
+  MDCFlexibleHeaderScrollEnginePhaseCollapsing = 1,
+  MDCFlexibleHeaderScrollEnginePhaseOverExtending = 2,
+} MDCFlexibleHeaderScrollEnginePhase;
+
+/** The header's configuration, as it stands when a sample is processed. */
+typedef struct MDCFlexibleHeaderScrollMetrics {
+  double minimumHeightWithTopSafeArea;
+  double maximumHeightWithTopSafeArea;
+  double maximumHeightWithoutTopSafeArea;
+  /** The minimum height as set on the header, which may or may not include the safe area. */
+  double minimumHeight;
+  /** The maximum height as set on the header, which may or may not include the safe area. */
+  double maximumHeight;
+  double minimumHeaderViewHeight;
+  /** The status bar's height. Only read when @c collapsesToStatusBar is true. */
+  double statusBarHeight;
+  /** How far the header can be dragged past fully shifted before it stops following the content. */
+  double anchorLength;
+  /** Whether a shifted header stops at the status bar rather than shifting it off-screen too. */
+  bool collapsesToStatusBar;
+  bool canAlwaysExpandToMaximumHeight;
+  /** Whether the header can grow past its maximum height. */
+  bool canOverExtend;
+  /** False when the header's visibility may only be changed by the client. */
+  bool allowsInteractiveShift;
+  bool canShiftOffscreen;
+} MDCFlexibleHeaderScrollMetrics;
+
+/** One observation of the tracking scroll view. */
+typedef struct MDCFlexibleHeaderScrollSample {
+  double contentOffsetY;
+  /** The top content inset, excluding the inset injected by the header. */
+  double topContentInset;
+  double bottomContentInset;
+  double contentHeight;
+  /** The height of the scroll view's bounds. */
+  double viewportHeight;
+  bool isTracking;
+  /** Whether the scroll view is being scrubbed, in which case the header may only shrink. */
+  bool isScrubbing;
+} MDCFlexibleHeaderScrollSample;
+
+/** The state the engine carries from one sample to the next. Zero-initialize to reset it. */
+typedef struct MDCFlexibleHeaderScrollState {
+  /**
+   A positive value is how far the header is shifted off-screen. When the header can always expand
+   to its maximum height, a negative value is how far it is expanded beyond its content-driven
+   height.
+   */
+  double shiftAccumulator;
+  /** The bounded content offset of the last processed sample. */
+  double lastContentOffsetY;
+  /** False until a sample has been processed, so that the first sample has no delta. */
+  bool lastContentOffsetIsValid;
+  /** The distance scrolled in the current direction. */
+  double accumulatedDeltaY;
+  /** The visibility the header settles towards once the user lets go. */
+  bool wantsToBeHidden;
+  /** Whether the header is settling towards its desired visibility. Samples don't shift it. */
+  bool isSettling;
+} MDCFlexibleHeaderScrollState;
+
+/** Where the header should be after a sample. */
+typedef struct MDCFlexibleHeaderScrollFrame {
+  double height;
+  /** How far the header's top edge is above the top of its superview. */
+  double shiftOffset;
+  MDCFlexibleHeaderScrollEnginePhase phase;
+  double phaseValue;
+  double phasePercentage;
+} MDCFlexibleHeaderScrollFrame;
+
+// Samples
+
+/** The header height implied by the content offset alone, before clamping. */
+double MDCFlexibleHeaderScrollSampleHeaderHeight(const MDCFlexibleHeaderScrollSample *sample);
+
+/** The content offset, ignoring rubber banding past the bottom of the content. */
+double MDCFlexibleHeaderScrollSampleBoundedContentOffsetY(
+    const MDCFlexibleHeaderScrollSample *sample);
+
+/** Whether the scroll view is scrolled to, or rubber banding past, the bottom of its content. */
+bool MDCFlexibleHeaderScrollSampleIsOverExtendingBottom(
+    const MDCFlexibleHeaderScrollSample *sample);
+
+// Accumulator bounds
+
+/** The accumulator value at which the header is fully shifted. */
+double MDCFlexibleHeaderScrollAccumulatorMax(const MDCFlexibleHeaderScrollMetrics *metrics);
+
+/** The accumulator value at which the header is fully expanded. Zero unless it always can. */
+double MDCFlexibleHeaderScrollAccumulatorMin(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                             double headerHeight);
+
+/** The largest accumulator value allowed while the content implies @c headerHeight. */
+double MDCFlexibleHeaderScrollAccumulatorUpperBound(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                                    double headerHeight);
+
+// State transitions
+
+/** Accumulates the scroll delta since the last sample. */
+void MDCFlexibleHeaderScrollStateProcessSample(MDCFlexibleHeaderScrollState *state,
+                                               const MDCFlexibleHeaderScrollMetrics *metrics,
+                                               const MDCFlexibleHeaderScrollSample *sample);
+
+/**
+ Moves the accumulator @c duration seconds closer to the header's desired visibility.
+
+ @return true once the destination is reached, at which point @c isSettling is cleared.
+ */
+bool MDCFlexibleHeaderScrollStateSettle(MDCFlexibleHeaderScrollState *state,
+                                        const MDCFlexibleHeaderScrollMetrics *metrics,
+                                        double headerHeight, double duration);
+
+// Frames
+
+/** The header's height for the content-implied @c headerHeight and @c accumulator. */
+double MDCFlexibleHeaderScrollHeight(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                     double headerHeight, double accumulator);
+
+/** How far the header is shifted up for @c accumulator. */
+double MDCFlexibleHeaderScrollShiftOffset(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                          double accumulator);
+
+/** Sets @c frame's phase, phase value and phase percentage from its height and shift offset. */
+void MDCFlexibleHeaderScrollFrameCalculatePhase(const MDCFlexibleHeaderScrollMetrics *metrics,
+                                                MDCFlexibleHeaderScrollFrame *frame);
+
+/** Calculates the whole frame for the content-implied @c headerHeight. */
+void MDCFlexibleHeaderScrollFrameCalculate(const MDCFlexibleHeaderScrollState *state,
+                                           const MDCFlexibleHeaderScrollMetrics *metrics,
+                                           double headerHeight,
+                                           MDCFlexibleHeaderScrollFrame *frame);
+
+// Replay
+
+/**
+ Feeds @c count recorded samples through the engine, as MDCFlexibleHeaderView would for a stream of
+ content offset changes, and writes the resulting frame for each sample to @c frames.
+ */
+void MDCFlexibleHeaderScrollReplay(MDCFlexibleHeaderScrollState *state,
+                                   const MDCFlexibleHeaderScrollMetrics *metrics,
+                                   const MDCFlexibleHeaderScrollSample *samples, size_t count,
+                                   MDCFlexibleHeaderScrollFrame *frames);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif  // MDCFlexibleHeaderScrollEngine_h
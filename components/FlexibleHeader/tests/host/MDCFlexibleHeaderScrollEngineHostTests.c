@@ -0,0 +1,181 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays recorded scroll traces through MDCFlexibleHeaderScrollEngine.c, checks the frames it
+// produces, and reports the cost of one sample. Run with scripts/test_host, optionally followed by
+// the paths of the traces to replay instead of ScrollTrace.csv. Traces have one sample per line:
+//
+// contentOffsetY,topContentInset,bottomContentInset,contentHeight,viewportHeight,isTracking,
+// isScrubbing
+//
+// Lines starting with # are ignored. Relative trace paths are resolved against this directory.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/private/MDCFlexibleHeaderScrollEngine.h"
+#include "MDCHostTest.h"
+
+#define BENCHMARK_SAMPLE_COUNT 2000000UL
+
+/** A 56-200pt header that shifts off-screen and over-extends. */
+#define DEFAULT_METRICS                     \
+  {                                         \
+    .minimumHeightWithTopSafeArea = 56,     \
+    .maximumHeightWithTopSafeArea = 200,    \
+    .maximumHeightWithoutTopSafeArea = 200, \
+    .minimumHeight = 56,                    \
+    .maximumHeight = 200,                   \
+    .statusBarHeight = 20,                  \
+    .anchorLength = 175,                    \
+    .canOverExtend = true,                  \
+    .allowsInteractiveShift = true,         \
+    .canShiftOffscreen = true,              \
+  }
+
+typedef struct Trace {
+  const char *name;
+  MDCFlexibleHeaderScrollSample *samples;
+  size_t count;
+} Trace;
+
+static int ReadTrace(const char *path, Trace *trace) {
+  trace->name = path;
+  trace->samples = NULL;
+  trace->count = 0;
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "%s: could not open trace\n", path);
+    return 0;
+  }
+  size_t capacity = 1024;
+  trace->samples = malloc(capacity * sizeof(MDCFlexibleHeaderScrollSample));
+
+  char line[256];
+  unsigned long lineNumber = 0;
+  while (fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    MDCFlexibleHeaderScrollSample sample;
+    int isTracking;
+    int isScrubbing;
+    if (sscanf(line, "%lf,%lf,%lf,%lf,%lf,%d,%d", &sample.contentOffsetY, &sample.topContentInset,
+               &sample.bottomContentInset, &sample.contentHeight, &sample.viewportHeight,
+               &isTracking, &isScrubbing) != 7) {
+      fprintf(stderr, "%s:%lu: malformed sample\n", path, lineNumber);
+      MDCHostTestFailureCount++;
+      continue;
+    }
+    sample.isTracking = isTracking != 0;
+    sample.isScrubbing = isScrubbing != 0;
+    if (trace->count == capacity) {
+      capacity *= 2;
+      trace->samples = realloc(trace->samples, capacity * sizeof(MDCFlexibleHeaderScrollSample));
+    }
+    trace->samples[trace->count++] = sample;
+  }
+  fclose(file);
+  return trace->count > 0;
+}
+
+/** Checks that replaying the whole trace matches feeding it to the engine one sample at a time. */
+static void TestReplayMatchesStepwiseProcessing(const Trace *trace,
+                                                const MDCFlexibleHeaderScrollMetrics *metrics) {
+  MDCFlexibleHeaderScrollFrame *frames = malloc(trace->count * sizeof(*frames));
+  MDCFlexibleHeaderScrollState replayState = {0};
+  MDCFlexibleHeaderScrollState state = {0};
+
+  MDCFlexibleHeaderScrollReplay(&replayState, metrics, trace->samples, trace->count, frames);
+
+  for (size_t i = 0; i < trace->count; i++) {
+    const MDCFlexibleHeaderScrollSample *sample = &trace->samples[i];
+    MDCFlexibleHeaderScrollStateProcessSample(&state, metrics, sample);
+    MDCFlexibleHeaderScrollFrame frame;
+    MDCFlexibleHeaderScrollFrameCalculate(
+        &state, metrics, MDCFlexibleHeaderScrollSampleHeaderHeight(sample), &frame);
+    MDC_HOST_EXPECT_NEAR(frames[i].height, frame.height, 0);
+    MDC_HOST_EXPECT_NEAR(frames[i].shiftOffset, frame.shiftOffset, 0);
+    MDC_HOST_EXPECT_TRUE(frames[i].phase == frame.phase);
+  }
+  MDC_HOST_EXPECT_NEAR(replayState.shiftAccumulator, state.shiftAccumulator, 0);
+  free(frames);
+}
+
+/** Checks that the header never shrinks below its minimum height or shifts past fully shifted. */
+static void TestFramesStayInBounds(const Trace *trace,
+                                   const MDCFlexibleHeaderScrollMetrics *metrics) {
+  MDCFlexibleHeaderScrollFrame *frames = malloc(trace->count * sizeof(*frames));
+  MDCFlexibleHeaderScrollState state = {0};
+  double accumulatorMax = MDCFlexibleHeaderScrollAccumulatorMax(metrics);
+
+  MDCFlexibleHeaderScrollReplay(&state, metrics, trace->samples, trace->count, frames);
+
+  double maximumShiftOffset = 0;
+  for (size_t i = 0; i < trace->count; i++) {
+    MDC_HOST_EXPECT_TRUE(frames[i].height >= metrics->minimumHeightWithTopSafeArea);
+    MDC_HOST_EXPECT_TRUE(frames[i].shiftOffset <= accumulatorMax);
+    maximumShiftOffset = fmax(maximumShiftOffset, frames[i].shiftOffset);
+  }
+  // Every trace is expected to scroll far enough down its content to shift the header off-screen.
+  MDC_HOST_EXPECT_NEAR(maximumShiftOffset, accumulatorMax, 0);
+  free(frames);
+}
+
+static void BenchmarkReplay(const char *name, const Trace *trace,
+                            const MDCFlexibleHeaderScrollMetrics *metrics) {
+  MDCFlexibleHeaderScrollFrame *frames = malloc(trace->count * sizeof(*frames));
+  unsigned long passCount = (BENCHMARK_SAMPLE_COUNT + trace->count - 1) / trace->count;
+  double heights = 0;
+
+  double start = MDCHostTestNanoseconds();
+  for (unsigned long pass = 0; pass < passCount; pass++) {
+    MDCFlexibleHeaderScrollState state = {0};
+    MDCFlexibleHeaderScrollReplay(&state, metrics, trace->samples, trace->count, frames);
+    heights += frames[trace->count - 1].height;
+  }
+  char label[48];
+  const char *traceName = strrchr(trace->name, '/');
+  snprintf(label, sizeof(label), "%s %s", name, traceName ? traceName + 1 : trace->name);
+  MDCHostTestReportCost(label, MDCHostTestNanoseconds() - start, passCount * trace->count);
+  MDC_HOST_EXPECT_TRUE(heights > 0);
+  free(frames);
+}
+
+int main(int argc, char *argv[]) {
+  const char *defaultPaths[] = {"ScrollTrace.csv"};
+  const char **paths = argc > 1 ? (const char **)&argv[1] : defaultPaths;
+  int pathCount = argc > 1 ? argc - 1 : 1;
+
+  MDCFlexibleHeaderScrollMetrics metrics = DEFAULT_METRICS;
+  MDCFlexibleHeaderScrollMetrics alwaysExpandingMetrics = DEFAULT_METRICS;
+  alwaysExpandingMetrics.canAlwaysExpandToMaximumHeight = true;
+
+  for (int i = 0; i < pathCount; i++) {
+    Trace trace;
+    if (!ReadTrace(paths[i], &trace)) {
+      MDCHostTestFailureCount++;
+      free(trace.samples);
+      continue;
+    }
+    TestReplayMatchesStepwiseProcessing(&trace, &metrics);
+    TestReplayMatchesStepwiseProcessing(&trace, &alwaysExpandingMetrics);
+    TestFramesStayInBounds(&trace, &metrics);
+    BenchmarkReplay("Replay", &trace, &metrics);
+    BenchmarkReplay("Replay always expanding", &trace, &alwaysExpandingMetrics);
+    free(trace.samples);
+  }
+  return MDCHostTestExitStatus();
+}
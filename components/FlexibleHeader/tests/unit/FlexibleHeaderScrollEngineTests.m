@@ -0,0 +1,298 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFlexibleHeaderScrollEngine.h"
+
+static const double kMinimumHeight = 56;
+static const double kMaximumHeight = 200;
+static const double kAnchorLength = 175;
+static const double kFrameDuration = 1.0 / 60.0;
+
+@interface FlexibleHeaderScrollEngineTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderScrollEngineTests {
+  MDCFlexibleHeaderScrollMetrics _metrics;
+  MDCFlexibleHeaderScrollState _state;
+  MDCFlexibleHeaderScrollSample _sample;
+}
+
+- (void)setUp {
+  [super setUp];
+
+  _metrics = (MDCFlexibleHeaderScrollMetrics){
+      .minimumHeightWithTopSafeArea = kMinimumHeight,
+      .maximumHeightWithTopSafeArea = kMaximumHeight,
+      .maximumHeightWithoutTopSafeArea = kMaximumHeight,
+      .minimumHeight = kMinimumHeight,
+      .maximumHeight = kMaximumHeight,
+      .statusBarHeight = 20,
+      .anchorLength = kAnchorLength,
+      .canOverExtend = true,
+      .allowsInteractiveShift = true,
+      .canShiftOffscreen = true,
+  };
+  _state = (MDCFlexibleHeaderScrollState){0};
+  // A long list whose top content inset was injected by a maximum height header.
+  _sample = (MDCFlexibleHeaderScrollSample){
+      .contentOffsetY = -kMaximumHeight,
+      .contentHeight = 10000,
+      .viewportHeight = 600,
+      .isTracking = true,
+  };
+}
+
+// Processes one sample per point between the two content offsets.
+- (void)drag:(double)fromContentOffsetY to:(double)toContentOffsetY {
+  double step = toContentOffsetY > fromContentOffsetY ? 1 : -1;
+  for (double y = fromContentOffsetY; y * step <= toContentOffsetY * step; y += step) {
+    _sample.contentOffsetY = y;
+    MDCFlexibleHeaderScrollStateProcessSample(&_state, &_metrics, &_sample);
+  }
+}
+
+#pragma mark - Accumulator bounds
+
+- (void)testAccumulatorMaxIsMinimumHeight {
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorMax(&_metrics), kMinimumHeight,
+                             0.001);
+}
+
+- (void)testAccumulatorMaxStopsAtStatusBarWhenCollapsingToIt {
+  // When
+  _metrics.collapsesToStatusBar = true;
+
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorMax(&_metrics),
+                             kMinimumHeight - _metrics.statusBarHeight, 0.001);
+}
+
+- (void)testAccumulatorUpperBoundIncludesAnchorOnceDetached {
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorUpperBound(&_metrics, 100), 0,
+                             0.001);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorUpperBound(&_metrics, 20),
+                             kMinimumHeight, 0.001);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorUpperBound(&_metrics, -20),
+                             kMinimumHeight + kAnchorLength, 0.001);
+}
+
+- (void)testAccumulatorMinIsZeroUnlessHeaderCanAlwaysExpand {
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorMin(&_metrics, -100), 0, 0.001);
+
+  // When
+  _metrics.canAlwaysExpandToMaximumHeight = true;
+
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollAccumulatorMin(&_metrics, -100),
+                             -(kMaximumHeight - kMinimumHeight), 0.001);
+}
+
+#pragma mark - Samples
+
+- (void)testFirstSampleDoesNotShift {
+  // Given
+  _sample.contentOffsetY = 500;
+
+  // When
+  MDCFlexibleHeaderScrollStateProcessSample(&_state, &_metrics, &_sample);
+
+  // Then
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, 0, 0.001);
+  XCTAssertTrue(_state.lastContentOffsetIsValid);
+  XCTAssertEqualWithAccuracy(_state.lastContentOffsetY, 500, 0.001);
+}
+
+- (void)testDraggingUpShiftsHeaderOffscreen {
+  // When
+  [self drag:-kMaximumHeight to:400];
+  MDCFlexibleHeaderScrollFrame frame;
+  MDCFlexibleHeaderScrollFrameCalculate(&_state, &_metrics, -400, &frame);
+
+  // Then
+  XCTAssertTrue(_state.wantsToBeHidden);
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, kMinimumHeight + kAnchorLength, 0.001);
+  XCTAssertEqualWithAccuracy(frame.height, kMinimumHeight, 0.001);
+  XCTAssertEqualWithAccuracy(frame.shiftOffset, kMinimumHeight, 0.001);
+  XCTAssertEqual(frame.phase, MDCFlexibleHeaderScrollEnginePhaseShifting);
+  XCTAssertEqualWithAccuracy(frame.phasePercentage, 1, 0.001);
+}
+
+- (void)testDraggingBackDownRevealsHeader {
+  // Given
+  [self drag:-kMaximumHeight to:400];
+
+  // When
+  [self drag:400 to:100];
+
+  // Then
+  XCTAssertFalse(_state.wantsToBeHidden);
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, 0, 0.001);
+}
+
+- (void)testScrubbingOnlyShrinksHeader {
+  // Given
+  [self drag:-kMaximumHeight to:400];
+  _sample.contentOffsetY = 100;
+  _sample.isScrubbing = true;
+
+  // When
+  MDCFlexibleHeaderScrollStateProcessSample(&_state, &_metrics, &_sample);
+
+  // Then
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, kMinimumHeight + kAnchorLength, 0.001);
+}
+
+- (void)testHideableHeaderDoesNotShiftInteractively {
+  // Given
+  _metrics.allowsInteractiveShift = false;
+
+  // When
+  [self drag:-kMaximumHeight to:400];
+
+  // Then
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, 0, 0.001);
+  XCTAssertFalse(_state.wantsToBeHidden);
+}
+
+- (void)testSamplesDoNotShiftSettlingHeader {
+  // Given
+  [self drag:-kMaximumHeight to:0];
+  double shiftAccumulator = _state.shiftAccumulator;
+  _state.isSettling = true;
+  _sample.contentOffsetY = 50;
+  _sample.isTracking = false;
+
+  // When
+  MDCFlexibleHeaderScrollStateProcessSample(&_state, &_metrics, &_sample);
+
+  // Then
+  XCTAssertEqualWithAccuracy(_state.shiftAccumulator, shiftAccumulator, 0.001);
+  XCTAssertTrue(_state.isSettling);
+}
+
+#pragma mark - Settling
+
+- (void)testSettleReachesHiddenDestination {
+  // Given
+  _state.shiftAccumulator = kMinimumHeight / 2;
+  _state.wantsToBeHidden = true;
+  _state.isSettling = true;
+
+  // When
+  NSUInteger frameCount = 0;
+  while (!MDCFlexibleHeaderScrollStateSettle(&_state, &_metrics, -100, kFrameDuration) &&
+         frameCount < 600) {
+    frameCount++;
+  }
+
+  // Then
+  XCTAssertLessThan(frameCount, 600U);
+  XCTAssertEqual(_state.shiftAccumulator, kMinimumHeight);
+  XCTAssertFalse(_state.isSettling);
+}
+
+- (void)testSettleReachesVisibleDestination {
+  // Given
+  _state.shiftAccumulator = kMinimumHeight + kAnchorLength;
+  _state.wantsToBeHidden = false;
+  _state.isSettling = true;
+
+  // When
+  MDCFlexibleHeaderScrollStateSettle(&_state, &_metrics, -100, kFrameDuration);
+
+  // Then
+  XCTAssertLessThanOrEqual(_state.shiftAccumulator, kMinimumHeight);
+
+  // When
+  while (!MDCFlexibleHeaderScrollStateSettle(&_state, &_metrics, -100, kFrameDuration)) {
+  }
+
+  // Then
+  XCTAssertEqual(_state.shiftAccumulator, 0);
+}
+
+#pragma mark - Phases
+
+- (void)testCollapsingPhase {
+  // Given
+  MDCFlexibleHeaderScrollFrame frame = {.height = 128, .shiftOffset = 0};
+
+  // When
+  MDCFlexibleHeaderScrollFrameCalculatePhase(&_metrics, &frame);
+
+  // Then
+  XCTAssertEqual(frame.phase, MDCFlexibleHeaderScrollEnginePhaseCollapsing);
+  XCTAssertEqualWithAccuracy(frame.phaseValue, 128, 0.001);
+  XCTAssertEqualWithAccuracy(frame.phasePercentage, 0.5, 0.001);
+}
+
+- (void)testOverExtendingPhase {
+  // Given
+  MDCFlexibleHeaderScrollFrame frame;
+
+  // When
+  MDCFlexibleHeaderScrollFrameCalculate(&_state, &_metrics, 300, &frame);
+
+  // Then
+  XCTAssertEqualWithAccuracy(frame.height, 300, 0.001);
+  XCTAssertEqual(frame.phase, MDCFlexibleHeaderScrollEnginePhaseOverExtending);
+  XCTAssertEqualWithAccuracy(frame.phasePercentage, 1.5, 0.001);
+}
+
+- (void)testHeightIsClampedWhenHeaderCannotOverExtend {
+  // When
+  _metrics.canOverExtend = false;
+
+  // Then
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollHeight(&_metrics, 300, 0), kMaximumHeight,
+                             0.001);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderScrollHeight(&_metrics, 10, 0), kMinimumHeight,
+                             0.001);
+}
+
+#pragma mark - Replay
+
+- (void)testReplayMatchesStepwiseProcessing {
+  // Given
+  MDCFlexibleHeaderScrollSample samples[480];
+  for (NSUInteger i = 0; i < 480; i++) {
+    samples[i] = _sample;
+    // Drag down the content and then back up past the top.
+    samples[i].contentOffsetY = i < 240 ? -kMaximumHeight + 3 * i : 520 - 3 * (i - 240.0);
+  }
+  MDCFlexibleHeaderScrollFrame frames[480];
+  MDCFlexibleHeaderScrollState replayState = {0};
+
+  // When
+  MDCFlexibleHeaderScrollReplay(&replayState, &_metrics, samples, 480, frames);
+
+  // Then
+  for (NSUInteger i = 0; i < 480; i++) {
+    MDCFlexibleHeaderScrollStateProcessSample(&_state, &_metrics, &samples[i]);
+    MDCFlexibleHeaderScrollFrame frame;
+    MDCFlexibleHeaderScrollFrameCalculate(
+        &_state, &_metrics, MDCFlexibleHeaderScrollSampleHeaderHeight(&samples[i]), &frame);
+    XCTAssertEqual(frames[i].height, frame.height);
+    XCTAssertEqual(frames[i].shiftOffset, frame.shiftOffset);
+    XCTAssertEqual(frames[i].phase, frame.phase);
+  }
+  XCTAssertEqual(replayState.shiftAccumulator, _state.shiftAccumulator);
+}
+
+@end
@@ -17,6 +17,7 @@
 #import "MDCBottomDrawerHeader.h"
 #import "MDCBottomDrawerState.h"
 #import "MDCBottomDrawerContainerViewControllerDelegate.h"
+#import "MDCBottomDrawerScrollGeometry.h"
 #import "MDCBottomDrawerShadowedView.h"
 #import "MDCShadowElevations.h"
 #import "MDCShadowLayer.h"
@@ -24,7 +25,6 @@
 #import "MDCMath.h"
 #import "MDCLayoutMetrics.h"
 
-static const CGFloat kVerticalShadowAnimationDistance = 10;
 // This value is the vertical offset that the drawer must be scrolled downward to cause it to be
 // dismissed.
 static const CGFloat kVerticalDistanceDismissalThreshold = 40;
@@ -38,13 +38,6 @@ static const CGFloat kHeaderAnimationDistanceAddedDistanceFromTopSafeAreaInset =
 // This epsilon is defined in units of screen points, and is supposed to be as small as possible
 // yet meaningful for comparison calculations.
 static const CGFloat kEpsilon = (CGFloat)0.001;
-// The buffer for the drawer's scroll view is neeeded to ensure that the KVO receiving the new
-// content offset, which is then changing the content offset of the tracking scroll view, will
-// be able to provide a value as if the scroll view is scrolling at natural speed. This is needed
-// as in cases where the drawer shows in full screen, the scroll offset is 0, and then the scrolling
-// has the behavior as if we are scrolling at the end of the content, and the scrolling isn't
-// smooth.
-static const CGFloat kScrollViewBufferForPerformance = 20;
 static const CGFloat kDragVelocityThresholdForHidingDrawer = -2;
 static const CGFloat kInitialDrawerHeightFactor = (CGFloat)0.5;
 static NSString *const kContentOffsetKeyPath = @"contentOffset";
@@ -188,6 +181,9 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 // Updates both the header and content based off content offset of the scroll view.
 - (void)updateViewWithContentOffset:(CGPoint)contentOffset;
 
+// Snapshots the drawer's layout values for the scroll math.
+- (MDCBottomDrawerGeometry)drawerGeometry;
+
 @end
 
 @implementation MDCBottomDrawerContainerViewController {
@@ -294,90 +290,63 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     // main scroll view using the bounds origin, and we don't want the view update with content
     // offset to use the outdated content offset of the main scroll view, so we update it
     // accordingly.
+    MDCBottomDrawerGeometry geometry = [self drawerGeometry];
     CGPoint normalizedContentOffset = contentOffset;
     if (self.trackingScrollView != nil) {
-      normalizedContentOffset.y = [self updateContentOffsetForPerformantScrolling:contentOffset.y];
+      normalizedContentOffset.y = [self updateContentOffsetForPerformantScrolling:contentOffset.y
+                                                                         geometry:&geometry];
     }
 
-    [self updateViewWithContentOffset:normalizedContentOffset];
+    [self updateViewWithContentOffset:normalizedContentOffset geometry:&geometry];
+  }
+}
+
+- (CGFloat)updateContentOffsetForPerformantScrolling:(CGFloat)contentYOffset
+                                            geometry:(const MDCBottomDrawerGeometry *)geometry {
+  UIScrollView *scrollView = self.scrollView;
+  UIScrollView *trackingScrollView = self.trackingScrollView;
+  CGRect scrollViewBounds = scrollView.bounds;
+  CGSize scrollViewContentSize = scrollView.contentSize;
+  CGRect trackingScrollViewBounds = trackingScrollView.bounds;
+  MDCBottomDrawerScrollViews scrollViews = {
+      .drawerBoundsOriginY = CGRectGetMinY(scrollViewBounds),
+      .drawerFrameHeight = CGRectGetHeight(scrollView.frame),
+      .drawerContentWidth = scrollViewContentSize.width,
+      .drawerContentHeight = scrollViewContentSize.height,
+      .trackingBoundsOriginY = CGRectGetMinY(trackingScrollViewBounds),
+      .trackingFrameHeight = CGRectGetHeight(trackingScrollView.frame),
+      .trackingContentHeight = trackingScrollView.contentSize.height,
+  };
+  MDCBottomDrawerScrollUpdate update;
+  MDCBottomDrawerScrollUpdateCalculate(geometry, &scrollViews, contentYOffset, &update);
+
+  switch (update.scrimColorAdoption) {
+    case MDCBottomDrawerScrimColorAdoptionUnchanged:
+      break;
+    case MDCBottomDrawerScrimColorAdoptionNone:
+      self.scrimShouldAdoptTrackingScrollViewBackgroundColor = NO;
+      break;
+    case MDCBottomDrawerScrimColorAdoptionTrackingScrollView:
+      self.scrimShouldAdoptTrackingScrollViewBackgroundColor = YES;
+      break;
   }
-}
 
-- (CGFloat)updateContentOffsetForPerformantScrolling:(CGFloat)contentYOffset {
-  CGFloat normalizedYContentOffset = contentYOffset;
-  CGFloat topAreaInsetForHeader = self.topAreaInsetForHeader;
-  // The top area inset for header should be a positive non zero value for the algorithm to
-  // correctly work when the drawer is presented in full screen and there is no top inset.
-  // The reason being is that otherwise there would be a conflict between if the drawer is currently
-  // in full screen and we should move the header view outside the scrollview to remain sticky, or
-  // if we aren't in full screen and need the header view to be scrolled as part of the scrolling.
-  if (self.contentHeaderTopInset <= topAreaInsetForHeader + kEpsilon) {
-    topAreaInsetForHeader = kEpsilon;
+  // Only write what changed: every bounds write on the drawer's scroll view re-enters this KVO
+  // callback, and content size writes invalidate its layout.
+  if (update.drawerBoundsOriginY != scrollViewBounds.origin.y) {
+    scrollViewBounds.origin.y = (CGFloat)update.drawerBoundsOriginY;
+    scrollView.bounds = scrollViewBounds;
   }
-  // We reset this to 0 if the `maximumDrawerHeight` should be 0 since we assume that the
-  // `maximumDrawerHeight` will be less than the screen height minus the top safe area. Typically we
-  // add height to the header but if we are using the `maximumDrawerHeight` no height is added to
-  // the header.
-  if ([self shouldUseMaximumDrawerHeight]) {
-    topAreaInsetForHeader = 0;
-  }
-  CGFloat bottomSafeAreaInset = [self bottomSafeAreaInsetsToAdjustContainerHeight];
-  CGFloat drawerOffset =
-      self.contentHeaderTopInset - topAreaInsetForHeader + kScrollViewBufferForPerformance;
-  CGFloat headerHeightWithoutInset = self.contentHeaderHeight - topAreaInsetForHeader;
-  CGFloat contentDiff = contentYOffset - drawerOffset;
-  CGFloat maxScrollOrigin = self.trackingScrollView.contentSize.height -
-                            CGRectGetHeight(self.presentingViewBounds) + headerHeightWithoutInset +
-                            bottomSafeAreaInset - kScrollViewBufferForPerformance;
-  // Since we are not adding any height, typically the safe area, to the header. We need allow for
-  // additional scrolling of the content.
-  if ([self shouldUseMaximumDrawerHeight]) {
-    maxScrollOrigin += [self topSafeAreaInset];
+  if (update.drawerContentWidth != scrollViewContentSize.width ||
+      update.drawerContentHeight != scrollViewContentSize.height) {
+    scrollView.contentSize =
+        CGSizeMake((CGFloat)update.drawerContentWidth, (CGFloat)update.drawerContentHeight);
   }
-  BOOL scrollingUpInFull = contentDiff < 0 && CGRectGetMinY(self.trackingScrollView.bounds) > 0;
-
-  if (CGRectGetMinY(self.scrollView.bounds) >= drawerOffset || scrollingUpInFull) {
-    // If we reach full screen or if we are scrolling up after being in full screen.
-    if (CGRectGetMinY(self.trackingScrollView.bounds) < maxScrollOrigin || scrollingUpInFull) {
-      // If we still didn't reach the end of the content, or if we are scrolling up after reaching
-      // the end of the content.
-      self.scrimShouldAdoptTrackingScrollViewBackgroundColor = NO;
-
-      // Update the drawer's scrollView's offset to be static so the content will scroll instead.
-      CGRect scrollViewBounds = self.scrollView.bounds;
-      scrollViewBounds.origin.y = drawerOffset;
-      normalizedYContentOffset = drawerOffset;
-      self.scrollView.bounds = scrollViewBounds;
-
-      // Make sure the drawer's scrollView's content size is the full size of the content
-      CGSize scrollViewContentSize = self.presentingViewBounds.size;
-      scrollViewContentSize.height += self.contentHeightSurplus;
-      self.scrollView.contentSize = scrollViewContentSize;
-
-      // Update the main content view's scrollView offset
-      CGRect contentViewBounds = self.trackingScrollView.bounds;
-      contentViewBounds.origin.y += contentDiff;
-      contentViewBounds.origin.y = MIN(maxScrollOrigin, MAX(CGRectGetMinY(contentViewBounds), 0));
-      self.trackingScrollView.bounds = contentViewBounds;
-    } else {
-      if (![self shouldUseMaximumDrawerHeight]) {
-        self.scrimShouldAdoptTrackingScrollViewBackgroundColor = YES;
-      }
-
-      if (self.trackingScrollView.contentSize.height >=
-          CGRectGetHeight(self.trackingScrollView.frame)) {
-        // Have the drawer's scrollView's content size be static so it will bounce when reaching the
-        // end of the content.
-        CGSize scrollViewContentSize = self.scrollView.contentSize;
-        scrollViewContentSize.height =
-            drawerOffset + CGRectGetHeight(self.scrollView.frame) + 2 * topAreaInsetForHeader;
-        self.scrollView.contentSize = scrollViewContentSize;
-      }
-    }
-  } else {
-    self.scrimShouldAdoptTrackingScrollViewBackgroundColor = NO;
+  if (update.trackingBoundsOriginY != trackingScrollViewBounds.origin.y) {
+    trackingScrollViewBounds.origin.y = (CGFloat)update.trackingBoundsOriginY;
+    trackingScrollView.bounds = trackingScrollViewBounds;
   }
-  return normalizedYContentOffset;
+  return (CGFloat)update.contentOffsetY;
 }
 
 - (BOOL)isAccessibilityMode {
@@ -480,12 +449,13 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
       setContentOffset:CGPointMake(self.scrollView.contentOffset.x, calculatedYContentOffset)
               animated:animated];
   if (!animated) {
-    // There is an issue that is deriving from us setting a kScrollViewBufferForPerformance in our
-    // scrolling logic that is influencing the drawer from sometimes getting to the exact offset
-    // specifically when scrolling to the top (contentOffsetY = 0). For us to mitigate this issue
-    // we will need to set the content offset twice for non animated calls and set it the second
-    // time in scrollViewDidEndScrollingAnimation for animated calls. As far as our research went
-    // to get rid of kScrollViewBufferForPerformance, we will need to do some refactoring work
+    // There is an issue that is deriving from us setting a
+    // MDCBottomDrawerScrollViewBufferForPerformance in our scrolling logic that is influencing the
+    // drawer from sometimes getting to the exact offset specifically when scrolling to the top
+    // (contentOffsetY = 0). For us to mitigate this issue we will need to set the content offset
+    // twice for non animated calls and set it the second time in
+    // scrollViewDidEndScrollingAnimation for animated calls. As far as our research went to get rid
+    // of MDCBottomDrawerScrollViewBufferForPerformance, we will need to do some refactoring work
     // that we have opened a tracking bug for: GitHub issue #5785.
     calculatedYContentOffset =
         contentOffsetY - self.trackingScrollView.contentOffset.y + drawerOffset;
@@ -637,7 +607,8 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   CGRect contentViewFrame = self.scrollView.bounds;
   contentViewFrame.origin.y = self.contentHeaderTopInset + self.contentHeaderHeight;
   if (self.trackingScrollView != nil) {
-    contentViewFrame.size.height -= self.contentHeaderHeight - kScrollViewBufferForPerformance;
+    contentViewFrame.size.height -=
+        self.contentHeaderHeight - (CGFloat)MDCBottomDrawerScrollViewBufferForPerformance;
     // We add the topAreaInsetForHeader to the height of the content view frame when a tracking
     // scroll view is set, to normalize the algorithm after the removal of this value from the
     // topAreaInsetForHeader inside the updateContentOffsetForPerformantScrolling method.
@@ -781,51 +752,24 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 #pragma mark Content Offset Adaptions (Private)
 
 - (void)updateViewWithContentOffset:(CGPoint)contentOffset {
-  CGFloat transitionPercentage =
-      [self transitionPercentageForContentOffset:contentOffset
-                                          offset:0
-                                        distance:self.headerAnimationDistance];
-  CGFloat headerTransitionToTop =
-      contentOffset.y >= self.transitionCompleteContentOffset ? 1 : transitionPercentage;
-  CGFloat adjustedTransitionRatio = transitionPercentage;
-  // The transition ratio is adjusted if the sticky status bar view is being used in place of a
-  // headerViewController to prevent presentation issues with corner radius not being kept in sync
-  // with the animation of the sticky view's expansion.
-  if (!self.hasHeaderViewController && self.shouldUseStickyStatusBar) {
-    adjustedTransitionRatio = (adjustedTransitionRatio > 0) ? 1 : 0;
-  }
+  MDCBottomDrawerGeometry geometry = [self drawerGeometry];
+  [self updateViewWithContentOffset:contentOffset geometry:&geometry];
+}
+
+- (void)updateViewWithContentOffset:(CGPoint)contentOffset
+                           geometry:(const MDCBottomDrawerGeometry *)geometry {
+  MDCBottomDrawerHeaderLayout headerLayout;
+  MDCBottomDrawerHeaderLayoutCalculate(geometry, contentOffset.y, &headerLayout);
+
+  CGFloat transitionRatio = (CGFloat)headerLayout.transitionRatio;
   [self.delegate bottomDrawerContainerViewControllerTopTransitionRatio:self
-                                                       transitionRatio:adjustedTransitionRatio];
-  [self updateDrawerState:adjustedTransitionRatio];
-
-  self.currentlyFullscreen =
-      self.contentReachesFullscreen && headerTransitionToTop >= 1 && contentOffset.y > 0;
-  // If we are using maximumDrawerHeight then the drawer is not in full screen until it has scrolled
-  // the `contentHeaderTopInset` distance, as typically it assumes it needs to scroll the
-  // `contentHeaderTopInset` minus the safeAreaInsets.top.
-  if ([self shouldUseMaximumDrawerHeight]) {
-    self.currentlyFullscreen = contentOffset.y > self.contentHeaderTopInset ? YES : NO;
-  }
-  CGFloat fullscreenHeaderHeight =
-      self.contentReachesFullscreen ? self.topHeaderHeight : [self contentHeaderHeight];
-
-  CGFloat contentHeight =
-      _contentVCPreferredContentSizeHeightCached + _headerVCPerferredContentSizeHeightCached;
-  if (self.shouldAlwaysExpandHeader && (contentHeight < self.presentingViewBounds.size.height)) {
-    // Make sure the content offset is greater than the content height surplus or we will divide
-    // by 0.
-    if (contentOffset.y > self.contentHeightSurplus) {
-      CGFloat additionalScrollPassedMaxHeight =
-          self.contentHeaderTopInset - (self.contentHeightSurplus + self.topSafeAreaInset);
-      fullscreenHeaderHeight = self.topHeaderHeight;
-      headerTransitionToTop =
-          MIN(1, (contentOffset.y - self.contentHeightSurplus) / additionalScrollPassedMaxHeight);
-    }
-  }
+                                                       transitionRatio:transitionRatio];
+  [self updateDrawerState:transitionRatio];
+
+  self.currentlyFullscreen = headerLayout.isFullscreen;
 
-  [self updateContentHeaderWithTransitionToTop:headerTransitionToTop
-                        fullscreenHeaderHeight:fullscreenHeaderHeight];
-  [self updateTopHeaderBottomShadowWithContentOffset:contentOffset];
+  [self updateContentHeaderWithLayout:&headerLayout geometry:geometry];
+  [self updateTopHeaderBottomShadowWithLayout:&headerLayout];
   [self updateContentWithHeight:contentOffset.y];
 
   // Calculate the current yOffset of the header and content.
@@ -834,7 +778,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 
   // While animating open or closed, always send back the final target Y offset.
   if (self.animatingPresentation) {
-    yOffset = self.contentHeaderTopInset;
+    yOffset = (CGFloat)geometry->contentHeaderTopInset;
   }
   if (self.animatingDismissal) {
     yOffset = self.view.frame.size.height;
@@ -844,26 +788,21 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
                                                              yOffset:MAX(0.0f, yOffset)];
 }
 
-- (void)updateContentHeaderWithTransitionToTop:(CGFloat)headerTransitionToTop
-                        fullscreenHeaderHeight:(CGFloat)fullscreenHeaderHeight {
-  if (!self.shouldUseStickyStatusBar && !self.hasHeaderViewController) {
+- (void)updateContentHeaderWithLayout:(const MDCBottomDrawerHeaderLayout *)headerLayout
+                             geometry:(const MDCBottomDrawerGeometry *)geometry {
+  if (!geometry->usesStickyStatusBar && !geometry->hasHeaderViewController) {
     return;
   }
 
-  if (self.hasHeaderViewController &&
+  if (geometry->hasHeaderViewController &&
       [self.headerViewController
           respondsToSelector:@selector(updateDrawerHeaderTransitionRatio:)]) {
-    if (self.shouldAlwaysExpandHeader) {
-      [self.headerViewController updateDrawerHeaderTransitionRatio:headerTransitionToTop];
-    } else {
-      [self.headerViewController updateDrawerHeaderTransitionRatio:self.contentReachesFullscreen
-                                                                       ? headerTransitionToTop
-                                                                       : 0];
-    }
+    [self.headerViewController
+        updateDrawerHeaderTransitionRatio:(CGFloat)headerLayout->headerViewTransitionRatio];
   }
 
   UIView *contentHeaderView =
-      self.hasHeaderViewController ? self.headerViewController.view : self.topSafeAreaView;
+      geometry->hasHeaderViewController ? self.headerViewController.view : self.topSafeAreaView;
   if (self.currentlyFullscreen && contentHeaderView.superview != self.view) {
     // The content header should be located statically at the top of the drawer when the drawer
     // is shown in fullscreen.
@@ -878,38 +817,26 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     [self.view setNeedsLayout];
   }
 
-  CGFloat contentHeaderHeight = self.contentHeaderHeight;
-  CGFloat headersDiff = fullscreenHeaderHeight - contentHeaderHeight;
-  if ([self shouldUseMaximumDrawerHeight]) {
-    headersDiff = 0;
-  }
-  CGFloat contentHeaderViewHeight = contentHeaderHeight + headerTransitionToTop * headersDiff;
-  CGFloat contentHeaderViewWidth = self.presentingViewBounds.size.width;
-  CGFloat contentHeaderViewTop =
-      self.currentlyFullscreen ? 0
-                               : self.contentHeaderTopInset - headerTransitionToTop * headersDiff;
-  // If we should be using the `maximumDrawerHeight` property then we reset the header height to be
-  // its original height and its origin to be the views height minus the drawer height.
-  if (self.currentlyFullscreen && [self shouldUseMaximumDrawerHeight]) {
-    contentHeaderViewTop = CGRectGetHeight(self.view.frame) - self.maximumDrawerHeight;
-    contentHeaderViewHeight = self.contentHeaderHeight;
-  }
-  contentHeaderView.frame =
-      CGRectMake(0, contentHeaderViewTop, contentHeaderViewWidth, contentHeaderViewHeight);
-  self.shadowedView.frame = contentHeaderView.frame;
+  CGRect contentHeaderViewFrame =
+      CGRectMake(0, (CGFloat)headerLayout->headerTop, (CGFloat)geometry->presentingViewWidth,
+                 (CGFloat)headerLayout->headerHeight);
+  // Skip unchanged frames, which would otherwise lay the header out again on every scroll tick.
+  if (!CGRectEqualToRect(contentHeaderView.frame, contentHeaderViewFrame)) {
+    contentHeaderView.frame = contentHeaderViewFrame;
+  }
+  if (!CGRectEqualToRect(self.shadowedView.frame, contentHeaderViewFrame)) {
+    self.shadowedView.frame = contentHeaderViewFrame;
+  }
   if (self.headerViewController.view.layer.mask) {
     CAShapeLayer *shapeLayer = self.headerViewController.view.layer.mask;
     self.shadowedView.layer.shadowPath = shapeLayer.path;
   }
 }
 
-- (void)updateTopHeaderBottomShadowWithContentOffset:(CGPoint)contentOffset {
-  self.headerShadowLayer.hidden = !self.currentlyFullscreen;
+- (void)updateTopHeaderBottomShadowWithLayout:(const MDCBottomDrawerHeaderLayout *)headerLayout {
+  self.headerShadowLayer.hidden = !headerLayout->isFullscreen;
   if (!self.headerShadowLayer.hidden) {
-    self.headerShadowLayer.opacity =
-        (float)[self transitionPercentageForContentOffset:contentOffset
-                                                   offset:-kVerticalShadowAnimationDistance
-                                                 distance:kVerticalShadowAnimationDistance];
+    self.headerShadowLayer.opacity = (float)headerLayout->headerShadowOpacity;
   }
 }
 
@@ -932,6 +859,33 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   }
 }
 
+- (MDCBottomDrawerGeometry)drawerGeometry {
+  CGRect presentingViewBounds = self.presentingViewBounds;
+  MDCBottomDrawerGeometry geometry = {
+      .presentingViewWidth = CGRectGetWidth(presentingViewBounds),
+      .presentingViewHeight = CGRectGetHeight(presentingViewBounds),
+      .viewHeight = CGRectGetHeight(self.view.frame),
+      .contentHeaderTopInset = self.contentHeaderTopInset,
+      .contentHeightSurplus = self.contentHeightSurplus,
+      .contentHeaderHeight = self.contentHeaderHeight,
+      .topHeaderHeight = self.topHeaderHeight,
+      .topAreaInsetForHeader = self.topAreaInsetForHeader,
+      .topSafeAreaInset = self.topSafeAreaInset,
+      .bottomSafeAreaInset = [self bottomSafeAreaInsetsToAdjustContainerHeight],
+      .transitionCompleteContentOffset = self.transitionCompleteContentOffset,
+      .headerAnimationDistance = self.headerAnimationDistance,
+      .maximumDrawerHeight = self.maximumDrawerHeight,
+      .contentHeight =
+          _contentVCPreferredContentSizeHeightCached + _headerVCPerferredContentSizeHeightCached,
+      .contentReachesFullscreen = self.contentReachesFullscreen,
+      .usesMaximumDrawerHeight = [self shouldUseMaximumDrawerHeight],
+      .hasHeaderViewController = self.hasHeaderViewController,
+      .usesStickyStatusBar = self.shouldUseStickyStatusBar,
+      .alwaysExpandsHeader = self.shouldAlwaysExpandHeader,
+  };
+  return geometry;
+}
+
 #pragma mark Getters (Private)
 
 - (UIScrollView *)scrollView {
@@ -1122,15 +1076,10 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 - (CGFloat)transitionPercentageForContentOffset:(CGPoint)contentOffset
                                          offset:(CGFloat)offset
                                        distance:(CGFloat)distance {
-  // If the distance is zero or negative there is no distance for a transition to occur and
-  // therefore it is set to one (100%). Rather than comparing precisely against `0`, comparison is
-  // done against the almost-zero value that is used throughout the calculations performed in this
-  // class.
-  if (distance <= kEpsilon) {
-    return 1;
-  }
-  return 1 - MAX(0, MIN(1, (self.transitionCompleteContentOffset - contentOffset.y - offset) /
-                               distance));
+  MDCBottomDrawerGeometry geometry = {
+      .transitionCompleteContentOffset = self.transitionCompleteContentOffset,
+  };
+  return (CGFloat)MDCBottomDrawerTransitionPercentage(&geometry, contentOffset.y, offset, distance);
 }
 
 - (CGFloat)midAnimationScrollToPositionForOffset:(CGPoint)targetContentOffset {
@@ -0,0 +1,204 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MDCBottomDrawerScrollGeometry.h"
+
+#include <math.h>
+
+const double MDCBottomDrawerScrollViewBufferForPerformance = 20;
+
+// The distance over which the top header's bottom shadow fades in.
+static const double kVerticalShadowAnimationDistance = 10;
+
+// This epsilon is defined in units of screen points, and is supposed to be as small as possible
+// yet meaningful for comparison calculations.
+static const double kEpsilon = 0.001;
+
+double MDCBottomDrawerTransitionPercentage(const MDCBottomDrawerGeometry *geometry,
+                                           double contentOffsetY, double offset, double distance) {
+  // If the distance is zero or negative there is no distance for a transition to occur and
+  // therefore it is set to one (100%).
+  if (distance <= kEpsilon) {
+    return 1;
+  }
+  double remaining =
+      (geometry->transitionCompleteContentOffset - contentOffsetY - offset) / distance;
+  return 1 - fmax(0, fmin(1, remaining));
+}
+
+// Scrolling
+
+void MDCBottomDrawerScrollUpdateCalculate(const MDCBottomDrawerGeometry *geometry,
+                                          const MDCBottomDrawerScrollViews *scrollViews,
+                                          double contentOffsetY,
+                                          MDCBottomDrawerScrollUpdate *update) {
+  update->contentOffsetY = contentOffsetY;
+  update->drawerBoundsOriginY = scrollViews->drawerBoundsOriginY;
+  update->drawerContentWidth = scrollViews->drawerContentWidth;
+  update->drawerContentHeight = scrollViews->drawerContentHeight;
+  update->trackingBoundsOriginY = scrollViews->trackingBoundsOriginY;
+  update->scrimColorAdoption = MDCBottomDrawerScrimColorAdoptionUnchanged;
+
+  double topAreaInsetForHeader = geometry->topAreaInsetForHeader;
+  // The top area inset for header should be a positive non zero value for the algorithm to
+  // correctly work when the drawer is presented in full screen and there is no top inset.
+  // The reason being is that otherwise there would be a conflict between if the drawer is currently
+  // in full screen and we should move the header view outside the scrollview to remain sticky, or
+  // if we aren't in full screen and need the header view to be scrolled as part of the scrolling.
+  if (geometry->contentHeaderTopInset <= topAreaInsetForHeader + kEpsilon) {
+    topAreaInsetForHeader = kEpsilon;
+  }
+  // We reset this to 0 if the `maximumDrawerHeight` should be used since we assume that the
+  // `maximumDrawerHeight` will be less than the screen height minus the top safe area. Typically we
+  // add height to the header but if we are using the `maximumDrawerHeight` no height is added to
+  // the header.
+  if (geometry->usesMaximumDrawerHeight) {
+    topAreaInsetForHeader = 0;
+  }
+  double drawerOffset = geometry->contentHeaderTopInset - topAreaInsetForHeader +
+                        MDCBottomDrawerScrollViewBufferForPerformance;
+  double headerHeightWithoutInset = geometry->contentHeaderHeight - topAreaInsetForHeader;
+  double contentDiff = contentOffsetY - drawerOffset;
+  double maxScrollOrigin = scrollViews->trackingContentHeight - geometry->presentingViewHeight +
+                           headerHeightWithoutInset + geometry->bottomSafeAreaInset -
+                           MDCBottomDrawerScrollViewBufferForPerformance;
+  // Since we are not adding any height, typically the safe area, to the header. We need allow for
+  // additional scrolling of the content.
+  if (geometry->usesMaximumDrawerHeight) {
+    maxScrollOrigin += geometry->topSafeAreaInset;
+  }
+  bool scrollingUpInFull = contentDiff < 0 && scrollViews->trackingBoundsOriginY > 0;
+
+  if (scrollViews->drawerBoundsOriginY < drawerOffset && !scrollingUpInFull) {
+    update->scrimColorAdoption = MDCBottomDrawerScrimColorAdoptionNone;
+    return;
+  }
+
+  // We reached full screen or we are scrolling up after being in full screen.
+  if (scrollViews->trackingBoundsOriginY < maxScrollOrigin || scrollingUpInFull) {
+    // We still didn't reach the end of the content, or we are scrolling up after reaching the end
+    // of the content.
+    update->scrimColorAdoption = MDCBottomDrawerScrimColorAdoptionNone;
+
+    // Keep the drawer's scroll view static so the content will scroll instead.
+    update->drawerBoundsOriginY = drawerOffset;
+    update->contentOffsetY = drawerOffset;
+
+    // Make sure the drawer's scroll view content size is the full size of the content.
+    update->drawerContentWidth = geometry->presentingViewWidth;
+    update->drawerContentHeight = geometry->presentingViewHeight + geometry->contentHeightSurplus;
+
+    // Scroll the tracking scroll view instead.
+    update->trackingBoundsOriginY =
+        fmin(maxScrollOrigin, fmax(scrollViews->trackingBoundsOriginY + contentDiff, 0));
+    return;
+  }
+
+  if (!geometry->usesMaximumDrawerHeight) {
+    update->scrimColorAdoption = MDCBottomDrawerScrimColorAdoptionTrackingScrollView;
+  }
+  if (scrollViews->trackingContentHeight >= scrollViews->trackingFrameHeight) {
+    // Have the drawer's scroll view content size be static so it will bounce when reaching the end
+    // of the content.
+    update->drawerContentHeight =
+        drawerOffset + scrollViews->drawerFrameHeight + 2 * topAreaInsetForHeader;
+  }
+}
+
+// Header
+
+void MDCBottomDrawerHeaderLayoutCalculate(const MDCBottomDrawerGeometry *geometry,
+                                          double contentOffsetY,
+                                          MDCBottomDrawerHeaderLayout *layout) {
+  double transitionPercentage = MDCBottomDrawerTransitionPercentage(
+      geometry, contentOffsetY, 0, geometry->headerAnimationDistance);
+  double headerTransitionToTop =
+      contentOffsetY >= geometry->transitionCompleteContentOffset ? 1 : transitionPercentage;
+
+  // The transition ratio is adjusted if the sticky status bar view is being used in place of a
+  // header view controller to prevent presentation issues with corner radius not being kept in sync
+  // with the animation of the sticky view's expansion.
+  layout->transitionRatio = transitionPercentage;
+  if (!geometry->hasHeaderViewController && geometry->usesStickyStatusBar) {
+    layout->transitionRatio = transitionPercentage > 0 ? 1 : 0;
+  }
+
+  bool isFullscreen =
+      geometry->contentReachesFullscreen && headerTransitionToTop >= 1 && contentOffsetY > 0;
+  // If we are using maximumDrawerHeight then the drawer is not in full screen until it has scrolled
+  // the `contentHeaderTopInset` distance, as typically it assumes it needs to scroll the
+  // `contentHeaderTopInset` minus the top safe area inset.
+  if (geometry->usesMaximumDrawerHeight) {
+    isFullscreen = contentOffsetY > geometry->contentHeaderTopInset;
+  }
+  layout->isFullscreen = isFullscreen;
+
+  double fullscreenHeaderHeight = geometry->contentReachesFullscreen
+                                      ? geometry->topHeaderHeight
+                                      : geometry->contentHeaderHeight;
+  // Make sure the content offset is greater than the content height surplus or we will divide by 0.
+  if (geometry->alwaysExpandsHeader && geometry->contentHeight < geometry->presentingViewHeight &&
+      contentOffsetY > geometry->contentHeightSurplus) {
+    double additionalScrollPassedMaxHeight =
+        geometry->contentHeaderTopInset -
+        (geometry->contentHeightSurplus + geometry->topSafeAreaInset);
+    fullscreenHeaderHeight = geometry->topHeaderHeight;
+    double scrollPassedSurplus = contentOffsetY - geometry->contentHeightSurplus;
+    headerTransitionToTop = fmin(1, scrollPassedSurplus / additionalScrollPassedMaxHeight);
+  }
+  layout->headerTransitionToTop = headerTransitionToTop;
+  layout->headerViewTransitionRatio =
+      geometry->alwaysExpandsHeader || geometry->contentReachesFullscreen ? headerTransitionToTop
+                                                                           : 0;
+
+  double headersDiff = geometry->usesMaximumDrawerHeight
+                           ? 0
+                           : fullscreenHeaderHeight - geometry->contentHeaderHeight;
+  layout->headerHeight = geometry->contentHeaderHeight + headerTransitionToTop * headersDiff;
+  layout->headerTop =
+      isFullscreen ? 0 : geometry->contentHeaderTopInset - headerTransitionToTop * headersDiff;
+  // When using the `maximumDrawerHeight` the header keeps its original height and sits at the top
+  // of the drawer.
+  if (isFullscreen && geometry->usesMaximumDrawerHeight) {
+    layout->headerTop = geometry->viewHeight - geometry->maximumDrawerHeight;
+    layout->headerHeight = geometry->contentHeaderHeight;
+  }
+
+  layout->headerShadowOpacity =
+      isFullscreen ? MDCBottomDrawerTransitionPercentage(geometry, contentOffsetY,
+                                                         -kVerticalShadowAnimationDistance,
+                                                         kVerticalShadowAnimationDistance)
+                   : 0;
+}
+
+// Replay
+
+void MDCBottomDrawerScrollReplay(const MDCBottomDrawerGeometry *geometry,
+                                 MDCBottomDrawerScrollViews *scrollViews,
+                                 const double *contentOffsets, size_t count,
+                                 MDCBottomDrawerHeaderLayout *layouts) {
+  for (size_t i = 0; i < count; i++) {
+    // The drawer's content offset is its bounds origin at the time of the KVO tick.
+    scrollViews->drawerBoundsOriginY = contentOffsets[i];
+
+    MDCBottomDrawerScrollUpdate update;
+    MDCBottomDrawerScrollUpdateCalculate(geometry, scrollViews, contentOffsets[i], &update);
+    scrollViews->drawerBoundsOriginY = update.drawerBoundsOriginY;
+    scrollViews->drawerContentWidth = update.drawerContentWidth;
+    scrollViews->drawerContentHeight = update.drawerContentHeight;
+    scrollViews->trackingBoundsOriginY = update.trackingBoundsOriginY;
+
+    MDCBottomDrawerHeaderLayoutCalculate(geometry, update.contentOffsetY, &layouts[i]);
+  }
+}
@@ -0,0 +1,154 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MDCBottomDrawerScrollGeometry_h
+#define MDCBottomDrawerScrollGeometry_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ The scroll math behind MDCBottomDrawerContainerViewController.
+
+ Every function here is a side-effect-free function of the drawer's geometry and the state of its
+ scroll views, so that the container only has to snapshot its views, call in, and apply whatever
+ changed.
+ */
+
+/**
+ The buffer for the drawer's scroll view is needed to ensure that the KVO receiving the new content
+ offset, which is then changing the content offset of the tracking scroll view, will be able to
+ provide a value as if the scroll view is scrolling at natural speed. This is needed as in cases
+ where the drawer shows in full screen, the scroll offset is 0, and then the scrolling has the
+ behavior as if we are scrolling at the end of the content, and the scrolling isn't smooth.
+ */
+extern const double MDCBottomDrawerScrollViewBufferForPerformance;
+
+/** Whether the scrim should adopt the tracking scroll view's background color. */
+typedef enum MDCBottomDrawerScrimColorAdoption {
+  /** The scrim keeps its current color. */
+  MDCBottomDrawerScrimColorAdoptionUnchanged = 0,
+  MDCBottomDrawerScrimColorAdoptionNone = 1,
+  MDCBottomDrawerScrimColorAdoptionTrackingScrollView = 2,
+} MDCBottomDrawerScrimColorAdoption;
+
+/** The drawer's layout values, which only change when its content or container does. */
+typedef struct MDCBottomDrawerGeometry {
+  double presentingViewWidth;
+  double presentingViewHeight;
+  /** The height of the container's own view. */
+  double viewHeight;
+  double contentHeaderTopInset;
+  double contentHeightSurplus;
+  double contentHeaderHeight;
+  double topHeaderHeight;
+  /** The top safe area inset if there is a header view controller, 0 otherwise. */
+  double topAreaInsetForHeader;
+  double topSafeAreaInset;
+  /** The bottom safe area inset that is added to the content height, if any. */
+  double bottomSafeAreaInset;
+  double transitionCompleteContentOffset;
+  double headerAnimationDistance;
+  double maximumDrawerHeight;
+  /** The preferred heights of the content and header view controllers, combined. */
+  double contentHeight;
+  bool contentReachesFullscreen;
+  bool usesMaximumDrawerHeight;
+  bool hasHeaderViewController;
+  bool usesStickyStatusBar;
+  bool alwaysExpandsHeader;
+} MDCBottomDrawerGeometry;
+
+/** The state of the drawer's scroll view and of the tracking scroll view. */
+typedef struct MDCBottomDrawerScrollViews {
+  double drawerBoundsOriginY;
+  double drawerFrameHeight;
+  double drawerContentWidth;
+  double drawerContentHeight;
+  double trackingBoundsOriginY;
+  double trackingFrameHeight;
+  double trackingContentHeight;
+} MDCBottomDrawerScrollViews;
+
+/** What the tracking scroll view's performant scrolling does with one content offset. */
+typedef struct MDCBottomDrawerScrollUpdate {
+  /** The content offset the rest of the drawer should be laid out for. */
+  double contentOffsetY;
+  double drawerBoundsOriginY;
+  double drawerContentWidth;
+  double drawerContentHeight;
+  double trackingBoundsOriginY;
+  MDCBottomDrawerScrimColorAdoption scrimColorAdoption;
+} MDCBottomDrawerScrollUpdate;
+
+/** Where the content header should be for one content offset. */
+typedef struct MDCBottomDrawerHeaderLayout {
+  /** The transition ratio reported to the delegate and used for the drawer state. */
+  double transitionRatio;
+  /** How far the header has transitioned to its fullscreen height. */
+  double headerTransitionToTop;
+  /** The transition ratio to forward to the header view controller. */
+  double headerViewTransitionRatio;
+  /** Whether the header sticks to the top of the drawer rather than scrolling with the content. */
+  bool isFullscreen;
+  double headerTop;
+  double headerHeight;
+  /** The opacity of the header's bottom shadow, only shown while fullscreen. */
+  double headerShadowOpacity;
+} MDCBottomDrawerHeaderLayout;
+
+/**
+ The percentage of the header transition for @c contentOffsetY. The transition occurs either when
+ the content reaches fullscreen or when the entire content is displayed, whichever comes first.
+
+ @param offset A value by which the triggering point of the transition is shifted. A positive value
+ starts it earlier, a negative value later.
+ @param distance The distance scrolled from the moment the transition starts until it completes.
+ */
+double MDCBottomDrawerTransitionPercentage(const MDCBottomDrawerGeometry *geometry,
+                                           double contentOffsetY, double offset, double distance);
+
+/**
+ Calculates how the drawer's scroll view hands scrolling over to the tracking scroll view once the
+ drawer reaches its top, and back again.
+ */
+void MDCBottomDrawerScrollUpdateCalculate(const MDCBottomDrawerGeometry *geometry,
+                                          const MDCBottomDrawerScrollViews *scrollViews,
+                                          double contentOffsetY,
+                                          MDCBottomDrawerScrollUpdate *update);
+
+/** Calculates the content header's transition and frame for @c contentOffsetY. */
+void MDCBottomDrawerHeaderLayoutCalculate(const MDCBottomDrawerGeometry *geometry,
+                                          double contentOffsetY,
+                                          MDCBottomDrawerHeaderLayout *layout);
+
+/**
+ Feeds @c count recorded drawer content offsets through the scroll math, as a container with a
+ tracking scroll view would for a stream of KVO ticks, and writes the resulting header layout for
+ each offset to @c layouts. @c scrollViews is updated as the container's views would be.
+ */
+void MDCBottomDrawerScrollReplay(const MDCBottomDrawerGeometry *geometry,
+                                 MDCBottomDrawerScrollViews *scrollViews,
+                                 const double *contentOffsets, size_t count,
+                                 MDCBottomDrawerHeaderLayout *layouts);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif  // MDCBottomDrawerScrollGeometry_h
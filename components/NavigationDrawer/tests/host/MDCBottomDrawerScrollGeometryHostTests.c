@@ -0,0 +1,167 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays drawer content offset traces through MDCBottomDrawerScrollGeometry.c, checks the header
+// layouts it produces, and reports the cost of one KVO tick. Run with scripts/test_host, optionally
+// followed by the paths of the traces to replay instead of DrawerScrollTrace.csv. Traces have one
+// drawer content offset per line. Lines starting with # are ignored. Relative trace paths are
+// resolved against this directory.
+//
+// DrawerScrollTrace.csv is generated by generate_drawer_scroll_trace.py.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/private/MDCBottomDrawerScrollGeometry.h"
+#include "MDCHostTest.h"
+
+#define BENCHMARK_TICK_COUNT 2000000UL
+
+/**
+ A drawer with a 56pt header over long content, first displayed with its header 400pt from the top
+ of an 800pt tall screen with a 44pt top safe area.
+ */
+static const MDCBottomDrawerGeometry kGeometry = {
+    .presentingViewWidth = 375,
+    .presentingViewHeight = 800,
+    .viewHeight = 800,
+    .contentHeaderTopInset = 400,
+    .contentHeightSurplus = 1000,
+    .contentHeaderHeight = 56,
+    .topHeaderHeight = 100,
+    .topAreaInsetForHeader = 44,
+    .topSafeAreaInset = 44,
+    .transitionCompleteContentOffset = 356,
+    .headerAnimationDistance = 64,
+    .contentHeight = 2000,
+    .contentReachesFullscreen = true,
+    .hasHeaderViewController = true,
+};
+
+static const MDCBottomDrawerScrollViews kScrollViews = {
+    .drawerFrameHeight = 800,
+    .drawerContentWidth = 375,
+    .drawerContentHeight = 1800,
+    .trackingFrameHeight = 808,
+    .trackingContentHeight = 3000,
+};
+
+typedef struct Trace {
+  const char *name;
+  double *offsets;
+  size_t count;
+} Trace;
+
+static int ReadTrace(const char *path, Trace *trace) {
+  trace->name = path;
+  trace->offsets = NULL;
+  trace->count = 0;
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "%s: could not open trace\n", path);
+    return 0;
+  }
+  size_t capacity = 1024;
+  trace->offsets = malloc(capacity * sizeof(double));
+
+  char line[256];
+  unsigned long lineNumber = 0;
+  while (fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    double offset;
+    if (sscanf(line, "%lf", &offset) != 1) {
+      fprintf(stderr, "%s:%lu: malformed offset\n", path, lineNumber);
+      MDCHostTestFailureCount++;
+      continue;
+    }
+    if (trace->count == capacity) {
+      capacity *= 2;
+      trace->offsets = realloc(trace->offsets, capacity * sizeof(double));
+    }
+    trace->offsets[trace->count++] = offset;
+  }
+  fclose(file);
+  return trace->count > 0;
+}
+
+/**
+ Checks that the trace starts and ends with the drawer at rest, and that the header sticks to the
+ top of a fullscreen drawer whenever the tracking scroll view has taken over scrolling.
+ */
+static void TestTraceHandsOffToTrackingScrollView(const Trace *trace) {
+  MDCBottomDrawerScrollViews scrollViews = kScrollViews;
+  MDCBottomDrawerHeaderLayout layout;
+  size_t handedOffTickCount = 0;
+
+  for (size_t i = 0; i < trace->count; i++) {
+    MDCBottomDrawerScrollReplay(&kGeometry, &scrollViews, &trace->offsets[i], 1, &layout);
+    if (i == 0) {
+      MDC_HOST_EXPECT_TRUE(!layout.isFullscreen);
+      MDC_HOST_EXPECT_NEAR(layout.headerTop, 400, 0.001);
+    }
+    if (scrollViews.trackingBoundsOriginY > 0) {
+      handedOffTickCount++;
+      MDC_HOST_EXPECT_TRUE(layout.isFullscreen);
+      MDC_HOST_EXPECT_NEAR(layout.headerTop, 0, 0.001);
+      MDC_HOST_EXPECT_NEAR(layout.headerHeight, 100, 0.001);
+    }
+  }
+  // Every trace is expected to scroll the tracking scroll view and hand scrolling back before the
+  // drawer comes to rest.
+  MDC_HOST_EXPECT_TRUE(handedOffTickCount > 0);
+  MDC_HOST_EXPECT_NEAR(scrollViews.trackingBoundsOriginY, 0, 0);
+  MDC_HOST_EXPECT_TRUE(!layout.isFullscreen);
+}
+
+static void BenchmarkReplay(const Trace *trace) {
+  MDCBottomDrawerHeaderLayout *layouts = malloc(trace->count * sizeof(*layouts));
+  unsigned long passCount = (BENCHMARK_TICK_COUNT + trace->count - 1) / trace->count;
+  double heights = 0;
+
+  double start = MDCHostTestNanoseconds();
+  for (unsigned long pass = 0; pass < passCount; pass++) {
+    MDCBottomDrawerScrollViews scrollViews = kScrollViews;
+    MDCBottomDrawerScrollReplay(&kGeometry, &scrollViews, trace->offsets, trace->count, layouts);
+    heights += layouts[trace->count - 1].headerHeight;
+  }
+  char label[64];
+  const char *traceName = strrchr(trace->name, '/');
+  snprintf(label, sizeof(label), "MDCBottomDrawerScrollReplay %s",
+           traceName ? traceName + 1 : trace->name);
+  MDCHostTestReportCost(label, MDCHostTestNanoseconds() - start, passCount * trace->count);
+  MDC_HOST_EXPECT_TRUE(heights > 0);
+  free(layouts);
+}
+
+int main(int argc, char *argv[]) {
+  const char *defaultPaths[] = {"DrawerScrollTrace.csv"};
+  const char **paths = argc > 1 ? (const char **)&argv[1] : defaultPaths;
+  int pathCount = argc > 1 ? argc - 1 : 1;
+
+  for (int i = 0; i < pathCount; i++) {
+    Trace trace;
+    if (!ReadTrace(paths[i], &trace)) {
+      MDCHostTestFailureCount++;
+      free(trace.offsets);
+      continue;
+    }
+    TestTraceHandsOffToTrackingScrollView(&trace);
+    BenchmarkReplay(&trace);
+    free(trace.offsets);
+  }
+  return MDCHostTestExitStatus();
+}
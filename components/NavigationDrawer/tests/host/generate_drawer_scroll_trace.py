@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates DrawerScrollTrace.csv for MDCBottomDrawerScrollGeometryHostTests.c.
+
+The trace is synthesized, not recorded: a scripted sequence of finger velocities is fed through a
+model of the drawer's scroll view, which hands scrolling over to the tracking scroll view once the
+drawer reaches its top, and the drawer's content offset is written out once per 60 Hz KVO tick.
+The model mirrors MDCBottomDrawerScrollUpdateCalculate for the geometry the host test uses.
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+
+# The drawer's content offset at which the tracking scroll view takes over: the content header's
+# top inset, less the top area inset for the header, plus the performance buffer.
+DRAWER_OFFSET = 400 - 44 + 20
+# The furthest the tracking scroll view scrolls: its content height, less the presenting view's
+# height, plus the header height without its inset, less the performance buffer.
+MAX_TRACKING_ORIGIN = 3000 - 800 + (56 - 44) - 20
+
+# Each phase is (description, tick count, velocity in points per tick). A velocity of None flings:
+# the velocity left over from the previous phase decays by FLING_DECAY each tick. 'jitter'
+# alternates between the JITTER velocities.
+PHASES = [
+    ('rest', 10, 0),
+    ('drag up the drawer past the hand-off', 32, 14),
+    ('fling into the tracking scroll view', 90, None),
+    ('drag back down through the hand-off', 45, -11),
+    ('reverse and drag up through the hand-off again', 40, 9),
+    ('jitter while fullscreen', 12, 'jitter'),
+    ('drag down to the resting position', 70, -10),
+    ('rest', 10, 0),
+]
+FLING_DECAY = 0.95
+JITTER = (4, -3)
+
+
+def velocities():
+  velocity = 0.0
+  for _, tick_count, phase_velocity in PHASES:
+    for tick in range(tick_count):
+      if phase_velocity is None:
+        velocity *= FLING_DECAY
+      elif phase_velocity == 'jitter':
+        velocity = JITTER[tick % len(JITTER)]
+      else:
+        # Ease into the new velocity over a few ticks, as a finger does.
+        velocity += (phase_velocity - velocity) / 4
+      yield velocity
+
+
+def offsets():
+  drawer_origin = 0.0
+  tracking_origin = 0.0
+  for velocity in velocities():
+    offset = max(0.0, drawer_origin + velocity)
+    content_diff = offset - DRAWER_OFFSET
+    scrolling_up_in_full = content_diff < 0 and tracking_origin > 0
+    if offset < DRAWER_OFFSET and not scrolling_up_in_full:
+      drawer_origin = offset
+    else:
+      drawer_origin = DRAWER_OFFSET
+      tracking_origin = min(MAX_TRACKING_ORIGIN, max(tracking_origin + content_diff, 0))
+    yield offset
+
+
+def main():
+  script_dir = os.path.dirname(os.path.abspath(__file__))
+  default_output = os.path.join(script_dir, 'DrawerScrollTrace.csv')
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('output', nargs='?', default=default_output)
+  args = parser.parse_args()
+
+  with open(args.output, 'w') as trace:
+    trace.write('# Generated by generate_drawer_scroll_trace.py, not recorded on a device.\n')
+    trace.write('# The drawer\'s content offset at each 60 Hz KVO tick of a scripted gesture:\n')
+    for description, tick_count, _ in PHASES:
+      trace.write('# - %s (%d ticks)\n' % (description, tick_count))
+    trace.write('# contentOffsetY\n')
+    for offset in offsets():
+      trace.write('%.2f\n' % offset)
+
+
+if __name__ == '__main__':
+  main()
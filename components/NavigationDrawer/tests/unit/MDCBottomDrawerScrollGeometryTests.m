@@ -0,0 +1,253 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCBottomDrawerScrollGeometry.h"
+
+static const NSUInteger kReplayOffsetCount = 480;
+
+@interface MDCBottomDrawerScrollGeometryTests : XCTestCase
+@end
+
+@implementation MDCBottomDrawerScrollGeometryTests {
+  MDCBottomDrawerGeometry _geometry;
+  MDCBottomDrawerScrollViews _scrollViews;
+}
+
+- (void)setUp {
+  [super setUp];
+
+  // A drawer with a 56pt header over long content, first displayed with its header 400pt from the
+  // top of an 800pt tall screen with a 44pt top safe area.
+  _geometry = (MDCBottomDrawerGeometry){
+      .presentingViewWidth = 375,
+      .presentingViewHeight = 800,
+      .viewHeight = 800,
+      .contentHeaderTopInset = 400,
+      .contentHeightSurplus = 1000,
+      .contentHeaderHeight = 56,
+      .topHeaderHeight = 100,
+      .topAreaInsetForHeader = 44,
+      .topSafeAreaInset = 44,
+      .transitionCompleteContentOffset = 356,
+      .headerAnimationDistance = 64,
+      .contentHeight = 2000,
+      .contentReachesFullscreen = true,
+      .hasHeaderViewController = true,
+  };
+  _scrollViews = (MDCBottomDrawerScrollViews){
+      .drawerFrameHeight = 800,
+      .drawerContentWidth = 375,
+      .drawerContentHeight = 1800,
+      .trackingFrameHeight = 808,
+      .trackingContentHeight = 3000,
+  };
+}
+
+#pragma mark - Transition
+
+- (void)testTransitionPercentageIsClamped {
+  // Then
+  XCTAssertEqualWithAccuracy(MDCBottomDrawerTransitionPercentage(&_geometry, 0, 0, 64), 0, 0.001);
+  XCTAssertEqualWithAccuracy(MDCBottomDrawerTransitionPercentage(&_geometry, 324, 0, 64), 0.5,
+                             0.001);
+  XCTAssertEqualWithAccuracy(MDCBottomDrawerTransitionPercentage(&_geometry, 500, 0, 64), 1,
+                             0.001);
+}
+
+- (void)testTransitionPercentageIsCompleteWithoutDistance {
+  // Then
+  XCTAssertEqualWithAccuracy(MDCBottomDrawerTransitionPercentage(&_geometry, 0, 0, 0), 1, 0.001);
+}
+
+#pragma mark - Scrolling
+
+- (void)testDrawerScrollsItselfBelowItsTop {
+  // Given
+  _scrollViews.drawerBoundsOriginY = 100;
+  MDCBottomDrawerScrollUpdate update;
+
+  // When
+  MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, 100, &update);
+
+  // Then
+  XCTAssertEqualWithAccuracy(update.contentOffsetY, 100, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerBoundsOriginY, 100, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerContentHeight, _scrollViews.drawerContentHeight, 0.001);
+  XCTAssertEqualWithAccuracy(update.trackingBoundsOriginY, 0, 0.001);
+  XCTAssertEqual(update.scrimColorAdoption, MDCBottomDrawerScrimColorAdoptionNone);
+}
+
+- (void)testTrackingScrollViewScrollsOnceDrawerReachesItsTop {
+  // Given
+  _scrollViews.drawerBoundsOriginY = 400;
+  MDCBottomDrawerScrollUpdate update;
+
+  // When
+  MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, 400, &update);
+
+  // Then
+  XCTAssertEqualWithAccuracy(update.contentOffsetY, 376, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerBoundsOriginY, 376, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerContentWidth, 375, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerContentHeight, 1800, 0.001);
+  XCTAssertEqualWithAccuracy(update.trackingBoundsOriginY, 24, 0.001);
+  XCTAssertEqual(update.scrimColorAdoption, MDCBottomDrawerScrimColorAdoptionNone);
+}
+
+- (void)testScrollingUpInFullscreenScrollsTrackingScrollView {
+  // Given
+  _scrollViews.drawerBoundsOriginY = 350;
+  _scrollViews.trackingBoundsOriginY = 100;
+  MDCBottomDrawerScrollUpdate update;
+
+  // When
+  MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, 350, &update);
+
+  // Then
+  XCTAssertEqualWithAccuracy(update.drawerBoundsOriginY, 376, 0.001);
+  XCTAssertEqualWithAccuracy(update.trackingBoundsOriginY, 74, 0.001);
+}
+
+- (void)testDrawerBouncesAtEndOfTrackingScrollViewContent {
+  // Given
+  _scrollViews.drawerBoundsOriginY = 400;
+  _scrollViews.trackingBoundsOriginY = 2192;
+  MDCBottomDrawerScrollUpdate update;
+
+  // When
+  MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, 400, &update);
+
+  // Then
+  XCTAssertEqualWithAccuracy(update.contentOffsetY, 400, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerBoundsOriginY, 400, 0.001);
+  XCTAssertEqualWithAccuracy(update.drawerContentHeight, 376 + 800 + 2 * 44, 0.001);
+  XCTAssertEqualWithAccuracy(update.trackingBoundsOriginY, 2192, 0.001);
+  XCTAssertEqual(update.scrimColorAdoption, MDCBottomDrawerScrimColorAdoptionTrackingScrollView);
+}
+
+- (void)testScrimIsUnchangedAtEndOfContentWithMaximumDrawerHeight {
+  // Given
+  _geometry.usesMaximumDrawerHeight = true;
+  _scrollViews.drawerBoundsOriginY = 500;
+  _scrollViews.trackingBoundsOriginY = 2500;
+  MDCBottomDrawerScrollUpdate update;
+
+  // When
+  MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, 500, &update);
+
+  // Then
+  XCTAssertEqual(update.scrimColorAdoption, MDCBottomDrawerScrimColorAdoptionUnchanged);
+}
+
+#pragma mark - Header
+
+- (void)testHeaderScrollsWithContentBeforeTransition {
+  // Given
+  MDCBottomDrawerHeaderLayout layout;
+
+  // When
+  MDCBottomDrawerHeaderLayoutCalculate(&_geometry, 0, &layout);
+
+  // Then
+  XCTAssertFalse(layout.isFullscreen);
+  XCTAssertEqualWithAccuracy(layout.transitionRatio, 0, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerTop, 400, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerHeight, 56, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerShadowOpacity, 0, 0.001);
+}
+
+- (void)testHeaderGrowsDuringTransition {
+  // Given
+  MDCBottomDrawerHeaderLayout layout;
+
+  // When
+  MDCBottomDrawerHeaderLayoutCalculate(&_geometry, 324, &layout);
+
+  // Then
+  XCTAssertFalse(layout.isFullscreen);
+  XCTAssertEqualWithAccuracy(layout.headerTransitionToTop, 0.5, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerViewTransitionRatio, 0.5, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerTop, 378, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerHeight, 78, 0.001);
+}
+
+- (void)testHeaderSticksToTopInFullscreen {
+  // Given
+  MDCBottomDrawerHeaderLayout layout;
+
+  // When
+  MDCBottomDrawerHeaderLayoutCalculate(&_geometry, 400, &layout);
+
+  // Then
+  XCTAssertTrue(layout.isFullscreen);
+  XCTAssertEqualWithAccuracy(layout.transitionRatio, 1, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerTop, 0, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerHeight, 100, 0.001);
+  XCTAssertEqualWithAccuracy(layout.headerShadowOpacity, 1, 0.001);
+}
+
+- (void)testStickyStatusBarSnapsTransitionRatio {
+  // Given
+  _geometry.hasHeaderViewController = false;
+  _geometry.usesStickyStatusBar = true;
+  MDCBottomDrawerHeaderLayout layout;
+
+  // When
+  MDCBottomDrawerHeaderLayoutCalculate(&_geometry, 324, &layout);
+
+  // Then
+  XCTAssertEqualWithAccuracy(layout.transitionRatio, 1, 0.001);
+}
+
+#pragma mark - Replay
+
+- (void)testReplayMatchesStepwiseCalculation {
+  // Given
+  double offsets[kReplayOffsetCount];
+  for (NSUInteger i = 0; i < kReplayOffsetCount; i++) {
+    // Drag the drawer up to fullscreen, keep scrolling its content, then drag back down.
+    NSUInteger tick = i % 240;
+    offsets[i] = tick < 120 ? tick * 5 : (240 - tick) * 5;
+  }
+  MDCBottomDrawerHeaderLayout layouts[kReplayOffsetCount];
+  MDCBottomDrawerScrollViews replayScrollViews = _scrollViews;
+
+  // When
+  MDCBottomDrawerScrollReplay(&_geometry, &replayScrollViews, offsets, kReplayOffsetCount,
+                              layouts);
+
+  // Then
+  BOOL reachedFullscreen = NO;
+  for (NSUInteger i = 0; i < kReplayOffsetCount; i++) {
+    _scrollViews.drawerBoundsOriginY = offsets[i];
+    MDCBottomDrawerScrollUpdate update;
+    MDCBottomDrawerScrollUpdateCalculate(&_geometry, &_scrollViews, offsets[i], &update);
+    _scrollViews.drawerBoundsOriginY = update.drawerBoundsOriginY;
+    _scrollViews.drawerContentWidth = update.drawerContentWidth;
+    _scrollViews.drawerContentHeight = update.drawerContentHeight;
+    _scrollViews.trackingBoundsOriginY = update.trackingBoundsOriginY;
+    MDCBottomDrawerHeaderLayout layout;
+    MDCBottomDrawerHeaderLayoutCalculate(&_geometry, update.contentOffsetY, &layout);
+    XCTAssertEqual(layouts[i].isFullscreen, layout.isFullscreen);
+    XCTAssertEqual(layouts[i].headerTop, layout.headerTop);
+    XCTAssertEqual(layouts[i].headerHeight, layout.headerHeight);
+    reachedFullscreen = reachedFullscreen || layout.isFullscreen;
+  }
+  XCTAssertEqual(replayScrollViews.trackingBoundsOriginY, _scrollViews.trackingBoundsOriginY);
+  XCTAssertTrue(reachedFullscreen);
+}
+
+@end
@@ -135,6 +135,9 @@ CG_EXTERN const MDCPaletteAccent _Nonnull MDCPaletteAccent700Name;
 
  TODO(ajsecord): Document the algorithm used to generate the palette.
 
+ Generated palettes are immutable and are cached by the RGBA components of the target color, so
+ generating a palette from an equal color again returns the cached palette.
+
  @param target500Color The target "500" color in the palette.
  @return A palette generated with a 500 color matching the target color.
  */
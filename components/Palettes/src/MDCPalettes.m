@@ -40,6 +40,76 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
                          alpha:1];
 }
 
+/** The maximum number of generated palettes kept by +paletteGeneratedFromColor:. */
+static const NSUInteger kGeneratedPaletteCacheCountLimit = 128;
+
+/** Identifies a generated palette by its class and the RGBA components of its target color. */
+@interface MDCGeneratedPaletteKey : NSObject
+- (instancetype)initWithPaletteClass:(Class)paletteClass
+                                 red:(CGFloat)red
+                               green:(CGFloat)green
+                                blue:(CGFloat)blue
+                               alpha:(CGFloat)alpha;
+@end
+
+@implementation MDCGeneratedPaletteKey {
+  Class _paletteClass;
+  CGFloat _components[4];
+}
+
+- (instancetype)initWithPaletteClass:(Class)paletteClass
+                                 red:(CGFloat)red
+                               green:(CGFloat)green
+                                blue:(CGFloat)blue
+                               alpha:(CGFloat)alpha {
+  self = [super init];
+  if (self) {
+    _paletteClass = paletteClass;
+    _components[0] = red;
+    _components[1] = green;
+    _components[2] = blue;
+    _components[3] = alpha;
+  }
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCGeneratedPaletteKey class]]) {
+    return NO;
+  }
+  MDCGeneratedPaletteKey *other = object;
+  return _paletteClass == other->_paletteClass &&
+         memcmp(_components, other->_components, sizeof(_components)) == 0;
+}
+
+- (NSUInteger)hash {
+  // Hash the exact bits of each component so that distinct colors that round to the same 8-bit
+  // channels do not collide.
+  uint64_t hash = [_paletteClass hash];
+  for (int i = 0; i < 4; i++) {
+    double component = _components[i];
+    uint64_t bits;
+    memcpy(&bits, &component, sizeof(bits));
+    hash = 31 * hash + bits;
+  }
+  return (NSUInteger)(hash ^ (hash >> 32));
+}
+
+@end
+
+static NSCache<MDCGeneratedPaletteKey *, MDCPalette *> *MDCGeneratedPaletteCache(void) {
+  static NSCache *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [[NSCache alloc] init];
+    cache.countLimit = kGeneratedPaletteCacheCountLimit;
+  });
+  return cache;
+}
+
 @interface MDCPalette () {
   NSDictionary<MDCPaletteTint, UIColor *> *_tints;
   NSDictionary<MDCPaletteAccent, UIColor *> *_accents;
@@ -529,28 +599,48 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
 }
 
 + (instancetype)paletteGeneratedFromColor:(nonnull UIColor *)target500Color {
-  NSArray *tintNames = @[
-    MDCPaletteTint50Name, MDCPaletteTint100Name, MDCPaletteTint200Name, MDCPaletteTint300Name,
-    MDCPaletteTint400Name, MDCPaletteTint500Name, MDCPaletteTint600Name, MDCPaletteTint700Name,
-    MDCPaletteTint800Name, MDCPaletteTint900Name, MDCPaletteAccent100Name, MDCPaletteAccent200Name,
-    MDCPaletteAccent400Name, MDCPaletteAccent700Name
-  ];
-
-  NSMutableDictionary *tints = [[NSMutableDictionary alloc] init];
-  for (MDCPaletteTint name in tintNames) {
-    [tints setObject:MDCPaletteTintFromTargetColor(target500Color, name) forKey:name];
+  CGFloat red = 0, green = 0, blue = 0, alpha = 0;
+  MDCGeneratedPaletteKey *key = nil;
+  if ([target500Color getRed:&red green:&green blue:&blue alpha:&alpha]) {
+    key = [[MDCGeneratedPaletteKey alloc] initWithPaletteClass:self
+                                                           red:red
+                                                         green:green
+                                                          blue:blue
+                                                         alpha:alpha];
+    MDCPalette *palette = [MDCGeneratedPaletteCache() objectForKey:key];
+    if (palette) {
+      return palette;
+    }
   }
 
-  NSArray *accentNames = @[
-    MDCPaletteAccent100Name, MDCPaletteAccent200Name, MDCPaletteAccent400Name,
-    MDCPaletteAccent700Name
-  ];
-  NSMutableDictionary *accents = [[NSMutableDictionary alloc] init];
-  for (MDCPaletteAccent name in accentNames) {
-    [accents setObject:MDCPaletteAccentFromTargetColor(target500Color, name) forKey:name];
+  UIColor *tintColors[MDC_PALETTE_GENERATED_TINT_COUNT];
+  UIColor *accentColors[MDC_PALETTE_GENERATED_ACCENT_COUNT];
+  MDCPaletteExpansionsFromTargetColor(target500Color, tintColors, accentColors);
+
+  NSDictionary<MDCPaletteTint, UIColor *> *tints = @{
+    MDCPaletteTint50Name : tintColors[0],
+    MDCPaletteTint100Name : tintColors[1],
+    MDCPaletteTint200Name : tintColors[2],
+    MDCPaletteTint300Name : tintColors[3],
+    MDCPaletteTint400Name : tintColors[4],
+    MDCPaletteTint500Name : tintColors[5],
+    MDCPaletteTint600Name : tintColors[6],
+    MDCPaletteTint700Name : tintColors[7],
+    MDCPaletteTint800Name : tintColors[8],
+    MDCPaletteTint900Name : tintColors[9]
+  };
+  NSDictionary<MDCPaletteAccent, UIColor *> *accents = @{
+    MDCPaletteAccent100Name : accentColors[0],
+    MDCPaletteAccent200Name : accentColors[1],
+    MDCPaletteAccent400Name : accentColors[2],
+    MDCPaletteAccent700Name : accentColors[3]
+  };
+
+  MDCPalette *palette = [self paletteWithTints:tints accents:accents];
+  if (key) {
+    [MDCGeneratedPaletteCache() setObject:palette forKey:key];
   }
-
-  return [self paletteWithTints:tints accents:accents];
+  return palette;
 }
 
 + (instancetype)paletteWithTints:(NSDictionary<MDCPaletteTint, UIColor *> *)tints
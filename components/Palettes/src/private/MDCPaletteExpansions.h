@@ -14,8 +14,22 @@
 
 #import <UIKit/UIKit.h>
 
-UIColor* _Nonnull MDCPaletteTintFromTargetColor(UIColor* _Nonnull targetColor,
-                                                NSString* _Nonnull tintName);
+/** The number of tints in a generated palette, 50 through 900. */
+#define MDC_PALETTE_GENERATED_TINT_COUNT 10
 
-UIColor* _Nonnull MDCPaletteAccentFromTargetColor(UIColor* _Nonnull targetColor,
-                                                  NSString* _Nonnull accentName);
+/** The number of accents in a generated palette, A100, A200, A400 and A700. */
+#define MDC_PALETTE_GENERATED_ACCENT_COUNT 4
+
+/**
+ Computes every tint and accent of a palette generated from a target "500" color.
+
+ The target color is converted to HSB once, and all tints and accents are then computed in a single
+ pass over fixed tables of saturation and brightness curves.
+
+ @param targetColor The target "500" color of the palette.
+ @param tints Receives the tints, ordered from 50 to 900.
+ @param accents Receives the accents, ordered A100, A200, A400, A700.
+ */
+void MDCPaletteExpansionsFromTargetColor(UIColor* _Nonnull targetColor,
+                                         UIColor* _Nonnull __strong* _Nonnull tints,
+                                         UIColor* _Nonnull __strong* _Nonnull accents);
@@ -16,8 +16,6 @@
 
 #include <Foundation/Foundation.h>
 
-#import "MDCPaletteNames.h"
-
 // Observed saturation ranges for tints 50, 500, 900.
 static const CGFloat kSaturation50Min = (CGFloat)0.06;
 static const CGFloat kSaturation50Max = (CGFloat)0.12;
@@ -46,21 +44,20 @@ static const CGFloat kBrightnessLinearCoeff = (CGFloat)-0.03585714285714282;
 static const CGFloat kAccentSaturation[4] = {(CGFloat)0.49, (CGFloat)0.75, 1, 1};
 static const CGFloat kAccentBrightness[4] = {1, 1, 1, (CGFloat)0.92};
 
-// Ordered indices of each of the tints/accents.
-static const int kQTMColorTint50Index = 0;
-static const int kQTMColorTint100Index = 1;
-static const int kQTMColorTint200Index = 2;
-static const int kQTMColorTint300Index = 3;
-static const int kQTMColorTint400Index = 4;
+// Ordered indices of each of the tints.
 static const int kQTMColorTint500Index = 5;
-static const int kQTMColorTint600Index = 6;
-static const int kQTMColorTint700Index = 7;
-static const int kQTMColorTint800Index = 8;
 static const int kQTMColorTint900Index = 9;
-static const int kQTMColorAccent100Index = 10;
-static const int kQTMColorAccent200Index = 11;
-static const int kQTMColorAccent400Index = 12;
-static const int kQTMColorAccent700Index = 13;
+
+// Position of each tint along its saturation curve: tints 50-500 interpolate from the 50 curve to
+// the target, tints 600-900 interpolate from the target to the 900 curve.
+static const CGFloat kTintSaturationCurve[MDC_PALETTE_GENERATED_TINT_COUNT] = {
+    0, (CGFloat)1 / 5, (CGFloat)2 / 5, (CGFloat)3 / 5, (CGFloat)4 / 5, 1,
+    (CGFloat)1 / 4, (CGFloat)2 / 4, (CGFloat)3 / 4, 1};
+
+// Position of each tint along its brightness curve: tints 50-500 interpolate linearly from the 50
+// curve to the target, tints 600-900 are the number of steps past 500 on the quadratic falloff.
+static const CGFloat kTintBrightnessCurve[MDC_PALETTE_GENERATED_TINT_COUNT] = {
+    0, (CGFloat)1 / 5, (CGFloat)2 / 5, (CGFloat)3 / 5, (CGFloat)4 / 5, 1, 1, 2, 3, 4};
 
 /** Returns a value Clamped to the range [min, max]. */
 static inline CGFloat Clamp(CGFloat value, CGFloat min, CGFloat max) {
@@ -105,100 +102,63 @@ static void ColorToHSB(UIColor *_Nonnull color, CGFloat hsb[4]) {
   }
 }
 
-/** Return the ordered index of a tint/accent by name. */
-static int NameToIndex(NSString *_Nonnull name) {
-  static NSDictionary *map = nil;
-  static dispatch_once_t onceToken;
-  dispatch_once(&onceToken, ^{
-    map = @{
-      MDC_PALETTE_TINT_50_INTERNAL_NAME : @(kQTMColorTint50Index),
-      MDC_PALETTE_TINT_100_INTERNAL_NAME : @(kQTMColorTint100Index),
-      MDC_PALETTE_TINT_200_INTERNAL_NAME : @(kQTMColorTint200Index),
-      MDC_PALETTE_TINT_300_INTERNAL_NAME : @(kQTMColorTint300Index),
-      MDC_PALETTE_TINT_400_INTERNAL_NAME : @(kQTMColorTint400Index),
-      MDC_PALETTE_TINT_500_INTERNAL_NAME : @(kQTMColorTint500Index),
-      MDC_PALETTE_TINT_600_INTERNAL_NAME : @(kQTMColorTint600Index),
-      MDC_PALETTE_TINT_700_INTERNAL_NAME : @(kQTMColorTint700Index),
-      MDC_PALETTE_TINT_800_INTERNAL_NAME : @(kQTMColorTint800Index),
-      MDC_PALETTE_TINT_900_INTERNAL_NAME : @(kQTMColorTint900Index),
-      MDC_PALETTE_ACCENT_100_INTERNAL_NAME : @(kQTMColorAccent100Index),
-      MDC_PALETTE_ACCENT_200_INTERNAL_NAME : @(kQTMColorAccent200Index),
-      MDC_PALETTE_ACCENT_400_INTERNAL_NAME : @(kQTMColorAccent400Index),
-      MDC_PALETTE_ACCENT_700_INTERNAL_NAME : @(kQTMColorAccent700Index)
-    };
-  });
-
-  NSNumber *index = map[name];
-  if (index != nil) {
-    return [index intValue];
-  } else {
-    NSCAssert(NO, @"%@ is not a valid tint/accent name.", name);
-    return kQTMColorTint500Index;
-  }
-}
-
-UIColor *MDCPaletteTintFromTargetColor(UIColor *targetColor, NSString *tintName) {
-  NSCAssert(MDCPaletteIsTintOrAccentName(tintName), @"Invalid tint/accent name %@.", tintName);
-  int tint = NameToIndex(tintName);
-
+void MDCPaletteExpansionsFromTargetColor(UIColor *targetColor, UIColor *__strong *tints,
+                                         UIColor *__strong *accents) {
   CGFloat hsb[4];
   ColorToHSB(targetColor, hsb);
+  CGFloat hue = hsb[0];
 
   // Saturation: select a saturation curve from the input saturation, unless the saturation is so
   // low to be considered 'colorless', e.g. white/black/grey, in which case skip this step.
-  CGFloat saturation = hsb[1];
-  CGFloat t;
-  if (IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold)) {
+  CGFloat saturations[MDC_PALETTE_GENERATED_TINT_COUNT];
+  BOOL isColorful = IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold);
+  if (isColorful) {
     // Limit saturation to observed values.
-    hsb[1] = Clamp(hsb[1], kSaturation500Min, kSaturation500Max);
-
-    t = InvLerp(hsb[1], kSaturation500Min, kSaturation500Max);
-    if (tint <= kQTMColorTint500Index) {
-      CGFloat saturation50 = Lerp(t, kSaturation50Min, kSaturation50Max);
-      CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
-      saturation = Lerp(u, saturation50, hsb[1]);
-    } else {
-      CGFloat saturation900 = Lerp(t, kSaturation900Min, kSaturation900Max);
-      CGFloat u = InvLerp(tint, kQTMColorTint500Index, kQTMColorTint900Index);
-      saturation = Lerp(u, hsb[1], saturation900);
+    CGFloat saturation = Clamp(hsb[1], kSaturation500Min, kSaturation500Max);
+    CGFloat t = InvLerp(saturation, kSaturation500Min, kSaturation500Max);
+    CGFloat saturation50 = Lerp(t, kSaturation50Min, kSaturation50Max);
+    CGFloat saturation900 = Lerp(t, kSaturation900Min, kSaturation900Max);
+    for (int i = 0; i <= kQTMColorTint500Index; i++) {
+      saturations[i] = Lerp(kTintSaturationCurve[i], saturation50, saturation);
+    }
+    for (int i = kQTMColorTint500Index + 1; i <= kQTMColorTint900Index; i++) {
+      saturations[i] = Lerp(kTintSaturationCurve[i], saturation, saturation900);
+    }
+  } else {
+    for (int i = 0; i < MDC_PALETTE_GENERATED_TINT_COUNT; i++) {
+      saturations[i] = hsb[1];
     }
   }
 
   // Brightness: select a brightness curve from the input brightness.
-  CGFloat brightness;
+  CGFloat brightnesses[MDC_PALETTE_GENERATED_TINT_COUNT];
 
   // Limit brightness to observed values.
-  hsb[2] = Clamp(hsb[2], kBrightness500Min, kBrightness500Max);
-  t = InvLerp(hsb[2], kBrightness500Min, kBrightness500Max);
+  CGFloat brightness = Clamp(hsb[2], kBrightness500Min, kBrightness500Max);
+  CGFloat t = InvLerp(brightness, kBrightness500Min, kBrightness500Max);
 
   // The tints 50-500 are nice and linear.
-  if (tint <= kQTMColorTint500Index) {
-    CGFloat brightness50 = Lerp(t, kBrightness50Min, kBrightness50Max);
-    CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
-    brightness = Lerp(u, brightness50, hsb[2]);
-
-    // The tints > 500 fall off roughly quadratically.
-  } else {
-    CGFloat u = tint - kQTMColorTint500Index;
-    brightness = hsb[2] + kBrightnessQuadracticCoeff * u * u + kBrightnessLinearCoeff * u;
+  CGFloat brightness50 = Lerp(t, kBrightness50Min, kBrightness50Max);
+  for (int i = 0; i <= kQTMColorTint500Index; i++) {
+    brightnesses[i] = Lerp(kTintBrightnessCurve[i], brightness50, brightness);
   }
 
-  return [UIColor colorWithHue:hsb[0] saturation:saturation brightness:brightness alpha:1];
-}
-
-UIColor *MDCPaletteAccentFromTargetColor(UIColor *targetColor, NSString *accentName) {
-  NSCAssert(MDCPaletteIsTintOrAccentName(accentName), @"Invalid tint/accent name %@.", accentName);
-  int accent = NameToIndex(accentName);
-
-  CGFloat hsb[4];
-  ColorToHSB(targetColor, hsb);
-
-  int index = accent - kQTMColorAccent100Index;
-  NSCAssert(index >= 0 && index < 4, @"Invalid accent index %i", (int)accent);
+  // The tints > 500 fall off roughly quadratically.
+  for (int i = kQTMColorTint500Index + 1; i <= kQTMColorTint900Index; i++) {
+    CGFloat u = kTintBrightnessCurve[i];
+    brightnesses[i] = brightness + kBrightnessQuadracticCoeff * u * u + kBrightnessLinearCoeff * u;
+  }
 
-  CGFloat saturation = IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold)
-                           ? kAccentSaturation[index]
-                           : hsb[1];
-  CGFloat brightness = kAccentBrightness[index];
-  return [UIColor colorWithHue:hsb[0] saturation:saturation brightness:brightness alpha:1];
+  for (int i = 0; i < MDC_PALETTE_GENERATED_TINT_COUNT; i++) {
+    tints[i] = [UIColor colorWithHue:hue
+                          saturation:saturations[i]
+                          brightness:brightnesses[i]
+                               alpha:1];
+  }
+  for (int i = 0; i < MDC_PALETTE_GENERATED_ACCENT_COUNT; i++) {
+    accents[i] = [UIColor colorWithHue:hue
+                            saturation:isColorful ? kAccentSaturation[i] : hsb[1]
+                            brightness:kAccentBrightness[i]
+                                 alpha:1];
+  }
 }
@@ -103,4 +103,81 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
   XCTAssertEqual(palette.accent700, accents[MDCPaletteAccent700Name]);
 }
 
+- (void)testGeneratedPaletteIsCachedByTargetColor {
+  // Given
+  UIColor *targetColor = [UIColor colorWithRed:(CGFloat)0.2
+                                         green:(CGFloat)0.4
+                                          blue:(CGFloat)0.8
+                                         alpha:1];
+  UIColor *equalTargetColor = [UIColor colorWithRed:(CGFloat)0.2
+                                              green:(CGFloat)0.4
+                                               blue:(CGFloat)0.8
+                                              alpha:1];
+
+  // When
+  MDCPalette *first = [MDCPalette paletteGeneratedFromColor:targetColor];
+  MDCPalette *second = [MDCPalette paletteGeneratedFromColor:equalTargetColor];
+  MDCPalette *other = [MDCPalette paletteGeneratedFromColor:UIColor.redColor];
+
+  // Then
+  XCTAssertEqual(first, second);
+  XCTAssertNotEqual(first, other);
+}
+
+- (void)testGeneratedPaletteTintsDarkenFrom50To900 {
+  // Given
+  UIColor *targetColor = [UIColor colorWithRed:(CGFloat)0.2
+                                         green:(CGFloat)0.6
+                                          blue:(CGFloat)0.3
+                                         alpha:1];
+
+  // When
+  MDCPalette *palette = [MDCPalette paletteGeneratedFromColor:targetColor];
+
+  // Then
+  NSArray<UIColor *> *tints = @[
+    palette.tint50, palette.tint100, palette.tint200, palette.tint300, palette.tint400,
+    palette.tint500, palette.tint600, palette.tint700, palette.tint800, palette.tint900
+  ];
+  CGFloat targetHue = 0;
+  [targetColor getHue:&targetHue saturation:NULL brightness:NULL alpha:NULL];
+  CGFloat previousBrightness = 2;
+  for (UIColor *tint in tints) {
+    CGFloat hue = 0, brightness = 0;
+    [tint getHue:&hue saturation:NULL brightness:&brightness alpha:NULL];
+    XCTAssertEqualWithAccuracy(hue, targetHue, 0.001);
+    XCTAssertLessThan(brightness, previousBrightness);
+    previousBrightness = brightness;
+  }
+}
+
+- (void)testGeneratedPaletteFromGreyColorIsColorless {
+  // When
+  MDCPalette *palette =
+      [MDCPalette paletteGeneratedFromColor:[UIColor colorWithWhite:(CGFloat)0.5 alpha:1]];
+
+  // Then
+  NSArray<UIColor *> *colors = @[
+    palette.tint50, palette.tint500, palette.tint900, palette.accent100, palette.accent200,
+    palette.accent400, palette.accent700
+  ];
+  for (UIColor *color in colors) {
+    CGFloat saturation = 1;
+    [color getHue:NULL saturation:&saturation brightness:NULL alpha:NULL];
+    XCTAssertEqualWithAccuracy(saturation, 0, 0.001);
+  }
+}
+
+- (void)testPerformanceGeneratedPalettes {
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 1000; i++) {
+      UIColor *targetColor = [UIColor colorWithHue:(CGFloat)(i % 100) / 100
+                                        saturation:(CGFloat)0.8
+                                        brightness:(CGFloat)0.7
+                                             alpha:1];
+      [MDCPalette paletteGeneratedFromColor:targetColor];
+    }
+  }];
+}
+
 @end
@@ -37,7 +37,15 @@
 static const CGFloat kRippleDefaultAlpha = (CGFloat)0.12;
 static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
 
-@implementation MDCRippleView
+// The most ripple layers a view keeps around for reuse. Rapid taps rarely overlap more than a few
+// ripples at once.
+static const NSUInteger kMaxReusableRippleLayers = 4;
+
+@implementation MDCRippleView {
+  // Ripple layers created by this view. Any of them without a superlayer has finished its ripple
+  // and can begin a new one.
+  NSMutableArray<MDCRippleLayer *> *_rippleLayerPool;
+}
 
 @synthesize activeRippleLayer = _activeRippleLayer;
 
@@ -139,7 +147,25 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
             MAX(latestBeginTouchDownRippleTime, rippleLayer.rippleTouchDownStartTime);
       }
     }
-    dispatch_group_t group = dispatch_group_create();
+    // Each ripple's completion counts down; the last one to finish calls the completion block.
+    __block NSUInteger pendingRippleCount = 0;
+    MDCRippleCompletionBlock rippleCompletion = ^{
+      pendingRippleCount -= 1;
+      if (pendingRippleCount == 0 && completion) {
+        completion();
+      }
+    };
+    for (CALayer *layer in sublayers) {
+      if ([layer isKindOfClass:[MDCRippleLayer class]]) {
+        pendingRippleCount += 1;
+      }
+    }
+    if (pendingRippleCount == 0) {
+      if (completion) {
+        completion();
+      }
+      return;
+    }
     for (CALayer *layer in sublayers) {
       if ([layer isKindOfClass:[MDCRippleLayer class]]) {
         MDCRippleLayer *rippleLayer = (MDCRippleLayer *)layer;
@@ -147,18 +173,9 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
           rippleLayer.rippleTouchDownStartTime =
               latestBeginTouchDownRippleTime + kRippleFadeOutDelay;
         }
-        dispatch_group_enter(group);
-        [rippleLayer endRippleAnimated:animated
-                            completion:^{
-                              dispatch_group_leave(group);
-                            }];
+        [rippleLayer endRippleAnimated:animated completion:rippleCompletion];
       }
     }
-    dispatch_group_notify(group, dispatch_get_main_queue(), ^{
-      if (completion) {
-        completion();
-      }
-    });
   } else {
     for (CALayer *layer in sublayers) {
       if ([layer isKindOfClass:[MDCRippleLayer class]]) {
@@ -202,17 +219,41 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   rippleLayer.fillColor = self.rippleColor.CGColor;
 }
 
+/**
+ Returns a ripple layer that is not currently presenting a ripple, reusing one from the pool when
+ possible.
+ */
+- (MDCRippleLayer *)dequeueRippleLayer {
+  for (MDCRippleLayer *rippleLayer in _rippleLayerPool) {
+    if (rippleLayer.superlayer == nil) {
+      [rippleLayer prepareForReuse];
+      return rippleLayer;
+    }
+  }
+  MDCRippleLayer *rippleLayer = [MDCRippleLayer layer];
+  rippleLayer.rippleLayerDelegate = self;
+  if (!_rippleLayerPool) {
+    _rippleLayerPool = [NSMutableArray arrayWithCapacity:kMaxReusableRippleLayers];
+  }
+  if (_rippleLayerPool.count < kMaxReusableRippleLayers) {
+    [_rippleLayerPool addObject:rippleLayer];
+  }
+  return rippleLayer;
+}
+
 - (void)beginRippleTouchDownAtPoint:(CGPoint)point
                            animated:(BOOL)animated
                          completion:(nullable MDCRippleCompletionBlock)completion {
-  MDCRippleLayer *rippleLayer = [MDCRippleLayer layer];
-  rippleLayer.rippleLayerDelegate = self;
+  MDCRippleLayer *rippleLayer = [self dequeueRippleLayer];
   [self updateRippleStyle];
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
   [self setColorForRippleLayer:rippleLayer];
   rippleLayer.frame = self.bounds;
   if (self.rippleStyle == MDCRippleStyleUnbounded) {
     rippleLayer.maximumRadius = self.maximumRadius;
   }
+  [CATransaction commit];
   [self.layer addSublayer:rippleLayer];
   [rippleLayer startRippleAtPoint:point animated:animated completion:completion];
   self.activeRippleLayer = rippleLayer;
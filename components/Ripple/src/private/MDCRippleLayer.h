@@ -93,4 +93,12 @@ typedef void (^MDCRippleCompletionBlock)(void);
  */
 - (void)fadeOutRippleAnimated:(BOOL)animated
                    completion:(nullable MDCRippleCompletionBlock)completion;
+
+/**
+ Returns the layer to the state of a newly created ripple layer so that it can begin another ripple.
+ Any running animations are removed, and completion blocks of ripples already in flight will no
+ longer remove the layer from its superlayer.
+ */
+- (void)prepareForReuse;
+
 @end
@@ -37,7 +37,86 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
   return (CGFloat)(hypot(CGRectGetMidX(rect), CGRectGetMidY(rect)) + kExpandRippleBeyondSurface);
 }
 
-@implementation MDCRippleLayer
+/**
+ Shared animation templates. They are built once and never mutated afterwards; -addAnimation:forKey:
+ copies the animation it is given, so the templates that need no per-ripple values are added
+ directly, and the others are copied once per ripple layer and re-timed for each ripple.
+ */
+static CABasicAnimation *gTouchDownScaleTemplate;
+static CAKeyframeAnimation *gTouchDownPositionTemplate;
+static CABasicAnimation *gTouchDownFadeInTemplate;
+static CAAnimationGroup *gTouchDownTemplate;
+static CABasicAnimation *gTouchUpTemplate;
+static CABasicAnimation *gFadeInTemplate;
+static CABasicAnimation *gFadeOutTemplate;
+static CABasicAnimation *gImmediateFadeInTemplate;
+static CABasicAnimation *gImmediateFadeOutTemplate;
+
+static CABasicAnimation *MakeOpacityAnimation(NSNumber *fromValue,
+                                              NSNumber *toValue,
+                                              CFTimeInterval duration,
+                                              BOOL holdsFinalValue) {
+  CABasicAnimation *animation = [[CABasicAnimation alloc] init];
+  animation.keyPath = kRippleLayerOpacityString;
+  animation.fromValue = fromValue;
+  animation.toValue = toValue;
+  animation.duration = duration;
+  animation.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+  if (holdsFinalValue) {
+    animation.fillMode = kCAFillModeForwards;
+    animation.removedOnCompletion = NO;
+  }
+  return animation;
+}
+
+static void BuildAnimationTemplates(void) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
+    scaleAnim.keyPath = kRippleLayerScaleString;
+    scaleAnim.toValue = @1;
+    scaleAnim.timingFunction =
+        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+    gTouchDownScaleTemplate = scaleAnim;
+
+    CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
+    positionAnim.keyPath = kRippleLayerPositionString;
+    positionAnim.keyTimes = @[ @0, @1 ];
+    positionAnim.values = @[ @0, @1 ];
+    positionAnim.timingFunction =
+        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+    gTouchDownPositionTemplate = positionAnim;
+
+    gTouchDownFadeInTemplate = MakeOpacityAnimation(@0, @1, kRippleFadeInDuration, NO);
+
+    CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
+    animGroup.duration = kRippleTouchDownDuration;
+    gTouchDownTemplate = animGroup;
+
+    gTouchUpTemplate = MakeOpacityAnimation(@1, @0, kRippleTouchUpDuration, YES);
+    gFadeInTemplate = MakeOpacityAnimation(@0, @1, kRippleFadeInDuration, YES);
+    gFadeOutTemplate = MakeOpacityAnimation(@1, @0, kRippleFadeOutDuration, YES);
+    gImmediateFadeInTemplate = MakeOpacityAnimation(@0, @1, 0, YES);
+    gImmediateFadeOutTemplate = MakeOpacityAnimation(@1, @0, 0, YES);
+  });
+}
+
+@implementation MDCRippleLayer {
+  // Per-layer copies of the touch down and touch up templates, re-timed for every ripple.
+  CAAnimationGroup *_touchDownAnimation;
+  CABasicAnimation *_touchDownScaleAnimation;
+  CAKeyframeAnimation *_touchDownPositionAnimation;
+  CABasicAnimation *_touchUpAnimation;
+
+  // The inputs the current path, scale and position values were built from.
+  CGRect _pathOvalRect;
+  CGFloat _touchDownStartingScale;
+  CGPoint _touchDownStartPoint;
+  CGPoint _touchDownEndPoint;
+
+  // Incremented by -prepareForReuse so that completions of earlier ripples can tell they are stale.
+  NSUInteger _rippleGeneration;
+}
 
 - (void)setNeedsLayout {
   [super setNeedsLayout];
@@ -53,67 +132,100 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
 - (void)setPathFromRadii:(CGFloat)radius {
   CGRect ovalRect = CGRectMake(CGRectGetMidX(self.bounds) - radius,
                                CGRectGetMidY(self.bounds) - radius, radius * 2, radius * 2);
-  UIBezierPath *circlePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
-  self.path = circlePath.CGPath;
+  if (self.path && CGRectEqualToRect(ovalRect, _pathOvalRect)) {
+    return;
+  }
+  CGPathRef circlePath = CGPathCreateWithEllipseInRect(ovalRect, NULL);
+  self.path = circlePath;
+  CGPathRelease(circlePath);
+  _pathOvalRect = ovalRect;
 }
 
 - (CGFloat)calculateRadius {
   return self.maximumRadius > 0 ? self.maximumRadius : GetFinalRippleRadius(self.bounds);
 }
 
+- (void)prepareForReuse {
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  [self removeAllAnimations];
+  self.opacity = 1;
+  [CATransaction commit];
+  _startAnimationActive = NO;
+  _rippleTouchDownStartTime = 0;
+  _maximumRadius = 0;
+  _rippleGeneration += 1;
+}
+
+/**
+ Points the per-layer touch down animation at the given scale and center path, copying fresh
+ animations from the templates when this layer has none yet or its last one may still be running.
+ */
+- (CAAnimationGroup *)touchDownAnimationFromScale:(CGFloat)startingScale
+                                       startPoint:(CGPoint)startPoint
+                                         endPoint:(CGPoint)endPoint {
+  if (!_touchDownAnimation || _startAnimationActive) {
+    BuildAnimationTemplates();
+    _touchDownScaleAnimation = [gTouchDownScaleTemplate copy];
+    _touchDownPositionAnimation = [gTouchDownPositionTemplate copy];
+    _touchDownAnimation = [gTouchDownTemplate copy];
+    _touchDownAnimation.animations =
+        @[ _touchDownScaleAnimation, _touchDownPositionAnimation, gTouchDownFadeInTemplate ];
+    _touchDownStartingScale = 0;
+    _touchDownStartPoint = CGPointMake(NAN, NAN);
+  }
+
+  if (startingScale != _touchDownStartingScale) {
+    _touchDownScaleAnimation.fromValue = @(startingScale);
+    _touchDownStartingScale = startingScale;
+  }
+
+  if (!CGPointEqualToPoint(startPoint, _touchDownStartPoint) ||
+      !CGPointEqualToPoint(endPoint, _touchDownEndPoint)) {
+    CGMutablePathRef centerPath = CGPathCreateMutable();
+    CGPathMoveToPoint(centerPath, NULL, startPoint.x, startPoint.y);
+    CGPathAddLineToPoint(centerPath, NULL, endPoint.x, endPoint.y);
+    CGPathCloseSubpath(centerPath);
+    _touchDownPositionAnimation.path = centerPath;
+    CGPathRelease(centerPath);
+    _touchDownStartPoint = startPoint;
+    _touchDownEndPoint = endPoint;
+  }
+  return _touchDownAnimation;
+}
+
 - (void)startRippleAtPoint:(CGPoint)point
                   animated:(BOOL)animated
                 completion:(MDCRippleCompletionBlock)completion {
   [self.rippleLayerDelegate rippleLayerTouchDownAnimationDidBegin:self];
   CGFloat finalRadius = [self calculateRadius];
+  CGPoint center = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
+  // A reused layer has committed values for these properties; they must snap rather than animate
+  // from the previous ripple.
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
   [self setPathFromRadii:finalRadius];
   self.opacity = 1;
-  self.position = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
+  self.position = center;
+  [CATransaction commit];
   if (!animated) {
     if (completion) {
       completion();
     }
     [self.rippleLayerDelegate rippleLayerTouchDownAnimationDidEnd:self];
   } else {
-    _startAnimationActive = YES;
-
     CGFloat startingScale = GetInitialRippleRadius(self.bounds) / finalRadius;
-    CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
-    scaleAnim.keyPath = kRippleLayerScaleString;
-    scaleAnim.fromValue = @(startingScale);
-    scaleAnim.toValue = @1;
-    scaleAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
-
-    UIBezierPath *centerPath = [UIBezierPath bezierPath];
-    CGPoint startPoint = point;
-    CGPoint endPoint = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
-    [centerPath moveToPoint:startPoint];
-    [centerPath addLineToPoint:endPoint];
-    [centerPath closePath];
-
-    CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
-    positionAnim.keyPath = kRippleLayerPositionString;
-    positionAnim.path = centerPath.CGPath;
-    positionAnim.keyTimes = @[ @0, @1 ];
-    positionAnim.values = @[ @0, @1 ];
-    positionAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
-
-    CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-    fadeInAnim.keyPath = kRippleLayerOpacityString;
-    fadeInAnim.fromValue = @0;
-    fadeInAnim.toValue = @1;
-    fadeInAnim.duration = kRippleFadeInDuration;
-    fadeInAnim.timingFunction =
-        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+    CAAnimationGroup *animGroup = [self touchDownAnimationFromScale:startingScale
+                                                         startPoint:point
+                                                           endPoint:center];
+    _startAnimationActive = YES;
 
+    NSUInteger generation = _rippleGeneration;
     [CATransaction begin];
-    CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
-    animGroup.animations = @[ scaleAnim, positionAnim, fadeInAnim ];
-    animGroup.duration = kRippleTouchDownDuration;
     [CATransaction setCompletionBlock:^{
-      self->_startAnimationActive = NO;
+      if (self->_rippleGeneration == generation) {
+        self->_startAnimationActive = NO;
+      }
       if (completion) {
         completion();
       }
@@ -126,40 +238,26 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
 }
 
 - (void)fadeInRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
+  BuildAnimationTemplates();
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
-  fadeInAnim.fromValue = @0;
-  fadeInAnim.toValue = @1;
-  fadeInAnim.duration = animated ? kRippleFadeInDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
     }
   }];
-  [self addAnimation:fadeInAnim forKey:nil];
+  [self addAnimation:animated ? gFadeInTemplate : gImmediateFadeInTemplate forKey:nil];
   [CATransaction commit];
 }
 
 - (void)fadeOutRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
+  BuildAnimationTemplates();
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
-  fadeInAnim.fromValue = @1;
-  fadeInAnim.toValue = @0;
-  fadeInAnim.duration = animated ? kRippleFadeOutDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
     }
   }];
-  [self addAnimation:fadeInAnim forKey:nil];
+  [self addAnimation:animated ? gFadeOutTemplate : gImmediateFadeOutTemplate forKey:nil];
   [CATransaction commit];
 }
 
@@ -169,25 +267,25 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
     delay = kRippleFadeOutDelay;
   }
   [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidBegin:self];
+  if (!_touchUpAnimation) {
+    BuildAnimationTemplates();
+    _touchUpAnimation = [gTouchUpTemplate copy];
+  }
+  _touchUpAnimation.duration = animated ? kRippleTouchUpDuration : 0;
+  _touchUpAnimation.beginTime = [self convertTime:_rippleTouchDownStartTime + delay fromLayer:nil];
+
+  NSUInteger generation = _rippleGeneration;
   [CATransaction begin];
-  CABasicAnimation *fadeOutAnim = [[CABasicAnimation alloc] init];
-  fadeOutAnim.keyPath = kRippleLayerOpacityString;
-  fadeOutAnim.fromValue = @1;
-  fadeOutAnim.toValue = @0;
-  fadeOutAnim.duration = animated ? kRippleTouchUpDuration : 0;
-  fadeOutAnim.beginTime = [self convertTime:_rippleTouchDownStartTime + delay fromLayer:nil];
-  fadeOutAnim.timingFunction =
-      [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeOutAnim.fillMode = kCAFillModeForwards;
-  fadeOutAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
     }
     [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidEnd:self];
-    [self removeFromSuperlayer];
+    if (self->_rippleGeneration == generation) {
+      [self removeFromSuperlayer];
+    }
   }];
-  [self addAnimation:fadeOutAnim forKey:nil];
+  [self addAnimation:_touchUpAnimation forKey:nil];
   [CATransaction commit];
 }
 
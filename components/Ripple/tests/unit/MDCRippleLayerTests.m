@@ -283,4 +283,40 @@
   XCTAssertEqual(rippleLayer.maximumRadius, fakeRadius);
 }
 
+- (void)testPrepareForReuseResetsRippleState {
+  // Given
+  MDCRippleLayer *rippleLayer = [[MDCRippleLayer alloc] init];
+  rippleLayer.bounds = CGRectMake(0, 0, 100, 100);
+  rippleLayer.maximumRadius = 25;
+  [rippleLayer startRippleAtPoint:CGPointMake(10, 10) animated:YES completion:nil];
+
+  // When
+  [rippleLayer prepareForReuse];
+
+  // Then
+  XCTAssertFalse(rippleLayer.isStartAnimationActive);
+  XCTAssertEqual(rippleLayer.maximumRadius, 0);
+  XCTAssertEqualWithAccuracy(rippleLayer.rippleTouchDownStartTime, 0, 0.0001);
+  XCTAssertEqual(rippleLayer.animationKeys.count, 0U);
+}
+
+- (void)testStaleTouchUpDoesNotRemoveReusedLayer {
+  // Given
+  CALayer *superlayer = [CALayer layer];
+  MDCRippleLayer *rippleLayer = [[MDCRippleLayer alloc] init];
+  [superlayer addSublayer:rippleLayer];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completed"];
+  [rippleLayer endRippleAnimated:YES
+                      completion:^{
+                        [expectation fulfill];
+                      }];
+
+  // When
+  [rippleLayer prepareForReuse];
+  [self waitForExpectationsWithTimeout:3 handler:nil];
+
+  // Then
+  XCTAssertEqual(rippleLayer.superlayer, superlayer);
+}
+
 @end
@@ -300,4 +300,111 @@
   XCTAssertEqualObjects(injectedRippleView.superview, firstLevelView);
 }
 
+#pragma mark - Ripple layer reuse
+
+- (void)testRippleLayerIsReusedAfterRippleIsCancelled {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  MDCRippleLayer *firstRippleLayer = rippleView.activeRippleLayer;
+
+  // When
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertNotNil(firstRippleLayer);
+  XCTAssertEqual(rippleView.activeRippleLayer, firstRippleLayer);
+  XCTAssertEqual(rippleView.layer.sublayers.count, 1U);
+}
+
+- (void)testOverlappingRipplesUseDistinctLayers {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  MDCRippleLayer *firstRippleLayer = rippleView.activeRippleLayer;
+
+  // When
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertNotEqual(rippleView.activeRippleLayer, firstRippleLayer);
+  XCTAssertEqual(rippleView.layer.sublayers.count, 2U);
+}
+
+- (void)testReusedRippleLayerDoesNotKeepUnboundedMaximumRadius {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  rippleView.rippleStyle = MDCRippleStyleUnbounded;
+  rippleView.maximumRadius = 10;
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+
+  // When
+  rippleView.rippleStyle = MDCRippleStyleBounded;
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.activeRippleLayer.maximumRadius, 0);
+}
+
+- (void)testSteadyStateRipplesDoNotCreateRippleLayers {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  CGPoint point = CGPointMake(10, 10);
+  [rippleView beginRippleTouchDownAtPoint:point animated:YES completion:nil];
+  MDCRippleLayer *firstRippleLayer = rippleView.activeRippleLayer;
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+
+  // When
+  NSMutableArray<MDCRippleLayer *> *rippleLayers = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 10; ++i) {
+    [rippleView beginRippleTouchDownAtPoint:point animated:YES completion:nil];
+    [rippleLayers addObject:rippleView.activeRippleLayer];
+    [rippleView cancelAllRipplesAnimated:NO completion:nil];
+  }
+
+  // Then
+  XCTAssertNotNil(firstRippleLayer);
+  for (MDCRippleLayer *rippleLayer in rippleLayers) {
+    XCTAssertEqual(rippleLayer, firstRippleLayer);
+  }
+}
+
+#pragma mark - Cancelling ripples
+
+- (void)testCancelAllRipplesAnimatedCallsCompletionOnceAllRipplesEnd {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completed"];
+  expectation.assertForOverFulfill = YES;
+
+  // When
+  [rippleView cancelAllRipplesAnimated:YES
+                            completion:^{
+                              [expectation fulfill];
+                            }];
+  [self waitForExpectationsWithTimeout:3 handler:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.layer.sublayers.count, 0U);
+}
+
+- (void)testCancelAllRipplesAnimatedWithoutRipplesCallsCompletion {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 50, 50)];
+  __block BOOL completionCalled = NO;
+
+  // When
+  [rippleView cancelAllRipplesAnimated:YES
+                            completion:^{
+                              completionCalled = YES;
+                            }];
+
+  // Then
+  XCTAssertTrue(completionCalled);
+}
+
 @end
@@ -108,6 +108,9 @@ __attribute__((objc_subclassing_restricted)) @interface MDCShadowsCollectionBuil
 
  Call this function from your `UIView` subclass's `-layoutSubviews` to update `shadowPath`
  whenever the view's bounds change.
+
+ Properties that already hold the requested value are not written, and `shadowPath` is only rebuilt
+ when the view's bounds or corner radius change.
  */
 FOUNDATION_EXTERN void MDCConfigureShadowForView(UIView *_Nonnull view, MDCShadow *_Nonnull shadow,
                                                  UIColor *_Nonnull shadowColor)
@@ -126,6 +129,8 @@ FOUNDATION_EXTERN void MDCConfigureShadowForView(UIView *_Nonnull view, MDCShado
 
  Call this function from your `UIView` subclass's `-layoutSubviews` to update `shadowPath`
  whenever the view's bounds or shape changes.
+
+ Properties that already hold the requested value are not written.
  */
 FOUNDATION_EXTERN void MDCConfigureShadowForViewWithPath(UIView *_Nonnull view,
                                                          MDCShadow *_Nonnull shadow,
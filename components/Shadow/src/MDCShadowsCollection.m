@@ -14,46 +14,136 @@
 
 #import "MDCShadowsCollection.h"
 
+#import <objc/runtime.h>
+
 #import "MaterialAvailability.h"
 #import "MDCShadow.h"
+#import "private/MDCShadowsCollection+Testing.h"
+
+/**
+ The number of lookup table buckets per point of elevation. Elevations are quantized to quarter
+ points, which keeps every integral Material elevation on a bucket boundary.
+ */
+#define kLookupTableBucketsPerPoint 4
+
+/** The highest elevation covered by the lookup table; Material elevations range from 0 to 24. */
+#define kLookupTableMaxElevation 24
+
+#define kLookupTableCount (kLookupTableMaxElevation * kLookupTableBucketsPerPoint + 1)
+
+/** Marks a lookup table bucket that contains a stored elevation strictly inside it. */
+static const uint16_t kLookupTableBucketNeedsSearch = UINT16_MAX;
 
 @implementation MDCShadowsCollection {
-  NSDictionary<NSNumber *, MDCShadow *> *_shadowValuesForElevation;
-  NSArray<NSNumber *> *_orderedKeys;
+  // Shadows ordered by ascending elevation, and the elevations they are stored for.
+  NSArray<MDCShadow *> *_orderedShadows;
+  CGFloat *_orderedElevations;
+  NSUInteger _count;
+
+  // Unowned views of _orderedShadows so that lookups are a plain array index.
+  __unsafe_unretained MDCShadow **_shadows;
+
+  // For bucket i, which covers elevations in ((i - 1) / kLookupTableBucketsPerPoint,
+  // i / kLookupTableBucketsPerPoint], the index in _shadows of the shadow for every elevation in
+  // the bucket, or kLookupTableBucketNeedsSearch if that depends on the elevation.
+  uint16_t _lookupTable[kLookupTableCount];
 }
 
 - (instancetype)initWithShadowValuesForElevation:
     (NSDictionary<NSNumber *, MDCShadow *> *)shadowValuesForElevation {
   self = [super init];
   if (self) {
-    _shadowValuesForElevation = [shadowValuesForElevation copy];
-    _orderedKeys = [shadowValuesForElevation.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    NSArray<NSNumber *> *orderedKeys =
+        [shadowValuesForElevation.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    _count = orderedKeys.count;
+    // Lookup table entries are uint16_t indexes, with kLookupTableBucketNeedsSearch reserved.
+    NSAssert(_count > 0 && _count < kLookupTableBucketNeedsSearch,
+             @"A shadows collection holds between 1 and %u shadows, not %lu.",
+             (unsigned int)kLookupTableBucketNeedsSearch - 1, (unsigned long)_count);
+    _orderedShadows = [shadowValuesForElevation objectsForKeys:orderedKeys notFoundMarker:@""];
+    _orderedElevations = malloc(_count * sizeof(CGFloat));
+    _shadows = (__unsafe_unretained MDCShadow **)malloc(_count * sizeof(MDCShadow *));
+    for (NSUInteger i = 0; i < _count; i++) {
+      _orderedElevations[i] = (CGFloat)orderedKeys[i].doubleValue;
+      _shadows[i] = _orderedShadows[i];
+    }
+    [self buildLookupTable];
   }
   return self;
 }
 
+- (void)dealloc {
+  free(_orderedElevations);
+  free(_shadows);
+}
+
+- (void)buildLookupTable {
+  for (NSInteger i = 0; i < kLookupTableCount; i++) {
+    CGFloat bucketStart = (CGFloat)(i - 1) / kLookupTableBucketsPerPoint;
+    CGFloat bucketEnd = (CGFloat)i / kLookupTableBucketsPerPoint;
+    // The first stored elevation above the start of the bucket is the answer for the whole bucket,
+    // unless it lies strictly inside the bucket.
+    NSUInteger index = [self indexOfFirstElevationGreaterThan:bucketStart];
+    // Collections that are empty or too large for uint16_t indexes always search.
+    if (_count == 0 || _count >= kLookupTableBucketNeedsSearch ||
+        (index < _count && _orderedElevations[index] < bucketEnd)) {
+      _lookupTable[i] = kLookupTableBucketNeedsSearch;
+    } else {
+      _lookupTable[i] = (uint16_t)MIN(index, _count - 1);
+    }
+  }
+}
+
 - (MDCShadow *)shadowForElevation:(CGFloat)elevation {
-  NSUInteger lookupIndex = [self indexInOrderedKeysOfGivenElevation:elevation];
+  // Elevations in (-1 / kLookupTableBucketsPerPoint, kLookupTableMaxElevation] are served from the
+  // lookup table. NaN fails the comparisons and takes the search path.
+  CGFloat scaledElevation = elevation * kLookupTableBucketsPerPoint;
+  if (scaledElevation > -1 && scaledElevation <= kLookupTableCount - 1) {
+    NSInteger bucket = (NSInteger)ceil(scaledElevation);
+    uint16_t index = _lookupTable[bucket];
+    if (index != kLookupTableBucketNeedsSearch) {
+      return _shadows[index];
+    }
+  }
+
+  if (_count == 0) {
+    [NSException raise:NSRangeException format:@"%@ holds no shadows.", self];
+  }
+  NSUInteger lookupIndex = [self indexOfFirstElevationGreaterThanOrEqualTo:elevation];
   // If the value is larger than the largest value in the array, we will return the highest value in
   // the array.
-  if (lookupIndex >= _orderedKeys.count) {
-    lookupIndex = _orderedKeys.count - 1;
+  if (lookupIndex >= _count) {
+    lookupIndex = _count - 1;
   }
+  return _shadows[lookupIndex];
+}
 
-  NSNumber *key = _orderedKeys[lookupIndex];
-  return [_shadowValuesForElevation objectForKey:key];
+- (NSUInteger)indexOfFirstElevationGreaterThanOrEqualTo:(CGFloat)elevation {
+  NSUInteger low = 0;
+  NSUInteger high = _count;
+  while (low < high) {
+    NSUInteger mid = low + (high - low) / 2;
+    if (_orderedElevations[mid] < elevation) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
 }
 
-- (NSUInteger)indexInOrderedKeysOfGivenElevation:(CGFloat)elevation {
-  NSNumber *num = @(elevation);
-  NSUInteger index =
-      [_orderedKeys indexOfObject:num
-                    inSortedRange:NSMakeRange(0, _orderedKeys.count)
-                          options:NSBinarySearchingInsertionIndex
-                  usingComparator:^NSComparisonResult(NSNumber *num1, NSNumber *num2) {
-                    return [num1 compare:num2];
-                  }];
-  return index;
+- (NSUInteger)indexOfFirstElevationGreaterThan:(CGFloat)elevation {
+  NSUInteger low = 0;
+  NSUInteger high = _count;
+  while (low < high) {
+    NSUInteger mid = low + (high - low) / 2;
+    if (_orderedElevations[mid] <= elevation) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
 }
 
 @end
@@ -141,13 +231,73 @@ MDCShadowsCollection *MDCShadowsCollectionDefault(void) {
   return shadowsCollection;
 }
 
+static NSUInteger gShadowPerformedPropertyWriteCount = 0;
+static NSUInteger gShadowElidedPropertyWriteCount = 0;
+
+NSUInteger MDCShadowPerformedPropertyWriteCount(void) {
+  return gShadowPerformedPropertyWriteCount;
+}
+
+NSUInteger MDCShadowElidedPropertyWriteCount(void) {
+  return gShadowElidedPropertyWriteCount;
+}
+
+void MDCShadowResetPropertyWriteCounts(void) {
+  gShadowPerformedPropertyWriteCount = 0;
+  gShadowElidedPropertyWriteCount = 0;
+}
+
+/**
+ Records the inputs of the last shadow path that MDCConfigureShadowForView committed to a layer, so
+ that the path does not have to be rebuilt while those inputs are unchanged.
+ */
+@interface MDCShadowPathState : NSObject
+@property(nonatomic, assign) CGRect bounds;
+@property(nonatomic, assign) CGFloat cornerRadius;
+@property(nonatomic, strong) UIBezierPath *path;
+@end
+
+@implementation MDCShadowPathState
+@end
+
+static const void *kShadowPathStateKey = &kShadowPathStateKey;
+
+static MDCShadowPathState *ShadowPathStateForLayer(CALayer *layer) {
+  MDCShadowPathState *state = objc_getAssociatedObject(layer, kShadowPathStateKey);
+  if (!state) {
+    state = [[MDCShadowPathState alloc] init];
+    objc_setAssociatedObject(layer, kShadowPathStateKey, state, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  }
+  return state;
+}
+
+static inline BOOL ShadowPropertyNeedsWrite(BOOL differs) {
+#if DEBUG
+  if (differs) {
+    gShadowPerformedPropertyWriteCount += 1;
+  } else {
+    gShadowElidedPropertyWriteCount += 1;
+  }
+#endif
+  return differs;
+}
+
 void MDCConfigureShadowForView(UIView *view, MDCShadow *shadow, UIColor *shadowColor) {
-  // The bezierPathWithRoundedRect API supports both a cornerRadius of 0 (created just a square
-  // path) and also rounded corners where the cornerRadius is >0.
-  UIBezierPath *path = [UIBezierPath bezierPathWithRoundedRect:view.bounds
-                                                  cornerRadius:view.layer.cornerRadius];
+  CALayer *layer = view.layer;
+  CGRect bounds = view.bounds;
+  CGFloat cornerRadius = layer.cornerRadius;
+  MDCShadowPathState *state = ShadowPathStateForLayer(layer);
+  // Only rebuild the path if its inputs changed or something else replaced the layer's shadowPath.
+  if (!state.path || layer.shadowPath != state.path.CGPath ||
+      !CGRectEqualToRect(state.bounds, bounds) || state.cornerRadius != cornerRadius) {
+    // The bezierPathWithRoundedRect API supports both a cornerRadius of 0 (created just a square
+    // path) and also rounded corners where the cornerRadius is >0.
+    state.path = [UIBezierPath bezierPathWithRoundedRect:bounds cornerRadius:cornerRadius];
+    state.bounds = bounds;
+    state.cornerRadius = cornerRadius;
+  }
 
-  MDCConfigureShadowForViewWithPath(view, shadow, shadowColor, path.CGPath);
+  MDCConfigureShadowForViewWithPath(view, shadow, shadowColor, state.path.CGPath);
 }
 
 void MDCConfigureShadowForViewWithPath(UIView *view, MDCShadow *shadow, UIColor *shadowColor,
@@ -157,9 +307,25 @@ void MDCConfigureShadowForViewWithPath(UIView *view, MDCShadow *shadow, UIColor
     shadowColor = [shadowColor resolvedColorWithTraitCollection:view.traitCollection];
   }
 #endif  // MDC_AVAILABLE_SDK_IOS(13_0)
-  view.layer.shadowColor = shadowColor.CGColor;
-  view.layer.shadowOpacity = (float)shadow.opacity;
-  view.layer.shadowRadius = shadow.radius;
-  view.layer.shadowOffset = shadow.offset;
-  view.layer.shadowPath = path;
+  // Each write can invalidate the layer's shadow, so only write properties whose values differ.
+  CALayer *layer = view.layer;
+  CGColorRef cgShadowColor = shadowColor.CGColor;
+  if (ShadowPropertyNeedsWrite(!CGColorEqualToColor(layer.shadowColor, cgShadowColor))) {
+    layer.shadowColor = cgShadowColor;
+  }
+  float opacity = (float)shadow.opacity;
+  if (ShadowPropertyNeedsWrite(layer.shadowOpacity != opacity)) {
+    layer.shadowOpacity = opacity;
+  }
+  if (ShadowPropertyNeedsWrite(layer.shadowRadius != shadow.radius)) {
+    layer.shadowRadius = shadow.radius;
+  }
+  if (ShadowPropertyNeedsWrite(!CGSizeEqualToSize(layer.shadowOffset, shadow.offset))) {
+    layer.shadowOffset = shadow.offset;
+  }
+  CGPathRef currentPath = layer.shadowPath;
+  if (ShadowPropertyNeedsWrite(currentPath != path &&
+                               !(currentPath && path && CGPathEqualToPath(currentPath, path)))) {
+    layer.shadowPath = path;
+  }
 }
@@ -0,0 +1,34 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+/**
+ The number of shadow layer property writes performed by @c MDCConfigureShadowForView and
+ @c MDCConfigureShadowForViewWithPath since launch or the last call to
+ @c MDCShadowResetPropertyWriteCounts. Writes are only counted in debug builds.
+ */
+FOUNDATION_EXTERN NSUInteger MDCShadowPerformedPropertyWriteCount(void);
+
+/**
+ The number of shadow layer property writes skipped by @c MDCConfigureShadowForView and
+ @c MDCConfigureShadowForViewWithPath because the layer already held the value, since launch or the
+ last call to @c MDCShadowResetPropertyWriteCounts. Writes are only counted in debug builds.
+ */
+FOUNDATION_EXTERN NSUInteger MDCShadowElidedPropertyWriteCount(void);
+
+/**
+ Resets the shadow property write counters to zero.
+ */
+FOUNDATION_EXTERN void MDCShadowResetPropertyWriteCounts(void);
@@ -0,0 +1,104 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShadow.h"
+#import "../../src/private/MDCShadowsCollection+Testing.h"
+
+@interface MDCConfigureShadowTests : XCTestCase
+@property(nonatomic, strong) UIView *view;
+@property(nonatomic, strong) MDCShadow *shadow;
+@end
+
+@implementation MDCConfigureShadowTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.view = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 100, 40)];
+  self.shadow = [[MDCShadowBuilder builderWithOpacity:0.4 radius:3 offset:CGSizeMake(0, 1)] build];
+  MDCShadowResetPropertyWriteCounts();
+}
+
+- (void)tearDown {
+  self.view = nil;
+  self.shadow = nil;
+  MDCShadowResetPropertyWriteCounts();
+
+  [super tearDown];
+}
+
+- (void)testFirstConfigurationWritesAllProperties {
+  // When
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+
+  // Then
+  XCTAssertEqual(MDCShadowPerformedPropertyWriteCount(), 5U);
+  XCTAssertEqual(MDCShadowElidedPropertyWriteCount(), 0U);
+  XCTAssertEqualWithAccuracy(self.view.layer.shadowOpacity, 0.4, 0.0001);
+  XCTAssertEqual(self.view.layer.shadowRadius, 3);
+  XCTAssertTrue(CGSizeEqualToSize(self.view.layer.shadowOffset, CGSizeMake(0, 1)));
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(self.view.layer.shadowPath),
+                                  self.view.bounds));
+}
+
+- (void)testRepeatedConfigurationElidesAllWrites {
+  // Given
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+  CGPathRef shadowPath = self.view.layer.shadowPath;
+  MDCShadowResetPropertyWriteCounts();
+
+  // When
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+
+  // Then
+  XCTAssertEqual(MDCShadowPerformedPropertyWriteCount(), 0U);
+  XCTAssertEqual(MDCShadowElidedPropertyWriteCount(), 5U);
+  XCTAssertTrue(self.view.layer.shadowPath == shadowPath);
+}
+
+- (void)testBoundsChangeOnlyWritesShadowPath {
+  // Given
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+  MDCShadowResetPropertyWriteCounts();
+
+  // When
+  self.view.bounds = CGRectMake(0, 0, 200, 40);
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+
+  // Then
+  XCTAssertEqual(MDCShadowPerformedPropertyWriteCount(), 1U);
+  XCTAssertEqual(MDCShadowElidedPropertyWriteCount(), 4U);
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(self.view.layer.shadowPath),
+                                  self.view.bounds));
+}
+
+- (void)testExternallyChangedPropertyIsWrittenAgain {
+  // Given
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+  MDCShadowResetPropertyWriteCounts();
+
+  // When
+  self.view.layer.shadowRadius = 10;
+  self.view.layer.shadowPath = nil;
+  MDCConfigureShadowForView(self.view, self.shadow, UIColor.blackColor);
+
+  // Then
+  XCTAssertEqual(MDCShadowPerformedPropertyWriteCount(), 2U);
+  XCTAssertEqual(self.view.layer.shadowRadius, 3);
+  XCTAssertTrue(self.view.layer.shadowPath != NULL);
+}
+
+@end
@@ -0,0 +1,108 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShadow.h"
+
+static const NSInteger kIterations = 100000;
+
+static MDCShadow *ShadowWithRadius(CGFloat radius) {
+  return [[MDCShadowBuilder builderWithOpacity:0.5 radius:radius offset:CGSizeZero] build];
+}
+
+@interface MDCShadowsCollectionLookupTests : XCTestCase
+@end
+
+@implementation MDCShadowsCollectionLookupTests
+
+- (MDCShadowsCollection *)fractionalShadowsCollection {
+  MDCShadowsCollectionBuilder *builder =
+      [MDCShadowsCollectionBuilder builderWithShadow:ShadowWithRadius(0) forElevation:0];
+  [builder addShadowsForElevations:@{
+    @1.1 : ShadowWithRadius(1),
+    @1.2 : ShadowWithRadius(2),
+    @3 : ShadowWithRadius(3),
+    @30 : ShadowWithRadius(30),
+  }];
+  return [builder build];
+}
+
+- (void)testIntegralElevationsReturnNearestStoredElevationAbove {
+  // Given
+  MDCShadowsCollection *collection = [self fractionalShadowsCollection];
+
+  // Then
+  XCTAssertEqual([collection shadowForElevation:0].radius, 0);
+  XCTAssertEqual([collection shadowForElevation:1].radius, 1);
+  XCTAssertEqual([collection shadowForElevation:2].radius, 3);
+  XCTAssertEqual([collection shadowForElevation:3].radius, 3);
+  XCTAssertEqual([collection shadowForElevation:24].radius, 30);
+}
+
+- (void)testFractionalElevationsInsideABucketWithStoredElevations {
+  // Given
+  MDCShadowsCollection *collection = [self fractionalShadowsCollection];
+
+  // Then
+  XCTAssertEqual([collection shadowForElevation:(CGFloat)1.05].radius, 1);
+  XCTAssertEqual([collection shadowForElevation:(CGFloat)1.1].radius, 1);
+  XCTAssertEqual([collection shadowForElevation:(CGFloat)1.15].radius, 2);
+  XCTAssertEqual([collection shadowForElevation:(CGFloat)1.21].radius, 3);
+  XCTAssertEqual([collection shadowForElevation:(CGFloat)2.9].radius, 3);
+}
+
+- (void)testElevationsOutsideTheLookupTable {
+  // Given
+  MDCShadowsCollection *collection = [self fractionalShadowsCollection];
+
+  // Then
+  XCTAssertEqual([collection shadowForElevation:-5].radius, 0);
+  XCTAssertEqual([collection shadowForElevation:25].radius, 30);
+  XCTAssertEqual([collection shadowForElevation:100].radius, 30);
+}
+
+- (void)testPerformanceShadowForElevation {
+  // Given
+  MDCShadowsCollection *collection = MDCShadowsCollectionDefault();
+
+  // Then
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kIterations; i++) {
+      [collection shadowForElevation:(CGFloat)(i % 97) / 4];
+    }
+  }];
+}
+
+// Measures the boxed binary search that shadowForElevation: used before the lookup table, as a
+// baseline for testPerformanceShadowForElevation.
+- (void)testPerformanceBoxedBinarySearchBaseline {
+  // Given
+  NSArray<NSNumber *> *orderedKeys = @[ @0, @1, @3, @6, @8, @12 ];
+
+  // Then
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kIterations; i++) {
+      NSNumber *num = @((CGFloat)(i % 97) / 4);
+      [orderedKeys indexOfObject:num
+                   inSortedRange:NSMakeRange(0, orderedKeys.count)
+                         options:NSBinarySearchingInsertionIndex
+                 usingComparator:^NSComparisonResult(NSNumber *num1, NSNumber *num2) {
+                   return [num1 compare:num2];
+                 }];
+    }
+  }];
+}
+
+@end
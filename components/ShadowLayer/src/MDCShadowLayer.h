@@ -76,6 +76,20 @@
  */
 @property(nonatomic, getter=isShadowMaskEnabled, assign) BOOL shadowMaskEnabled;
 
+/**
+ Whether the key and ambient shadows are approximated by a single shadow sublayer.
+
+ By default the Material shadow is rendered with two shadow sublayers, each with its own mask. When
+ enabled, a single sublayer renders a precomputed shadow that blends both, halving the number of
+ shadow layers and offscreen passes. Useful on screens with many elevated views.
+
+ Shadow sublayers are only created once the elevation is above zero, in either mode.
+
+ Default is NO. Not animatable.
+ */
+@property(nonatomic, getter=isSingleLayerShadowApproximationEnabled, assign)
+    BOOL singleLayerShadowApproximationEnabled;
+
 /**
  Animates the layer's corner radius
 
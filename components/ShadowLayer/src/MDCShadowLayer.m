@@ -81,8 +81,38 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 @end
 
+/**
+ Computes a single shadow that approximates the combined key and ambient shadows of @c metrics.
+
+ The opacities are composited and the radius and offset are opacity-weighted averages of the two
+ shadows, which keeps the approximation's extent and darkness close to the pair it replaces.
+ */
+static void MDCSingleShadowApproximationFromMetrics(MDCShadowMetrics *metrics, CGFloat *radius,
+                                                    CGSize *offset, float *opacity) {
+  float keyOpacity = metrics.bottomShadowOpacity;
+  float ambientOpacity = metrics.topShadowOpacity;
+  float totalOpacity = keyOpacity + ambientOpacity;
+  if (totalOpacity <= 0) {
+    *radius = 0;
+    *offset = CGSizeZero;
+    *opacity = 0;
+    return;
+  }
+  CGFloat keyWeight = keyOpacity / totalOpacity;
+  CGFloat ambientWeight = ambientOpacity / totalOpacity;
+  *radius = keyWeight * metrics.bottomShadowRadius + ambientWeight * metrics.topShadowRadius;
+  *offset = CGSizeMake(
+      keyWeight * metrics.bottomShadowOffset.width + ambientWeight * metrics.topShadowOffset.width,
+      keyWeight * metrics.bottomShadowOffset.height +
+          ambientWeight * metrics.topShadowOffset.height);
+  *opacity = 1 - (1 - keyOpacity) * (1 - ambientOpacity);
+}
+
 @interface MDCShadowLayer ()
 
+// The shadow sublayers and their masks are created the first time the layer has a nonzero
+// elevation. When the elevation returns to zero they are removed from the layer tree but kept so
+// that they can be reattached without being recreated.
 @property(nonatomic, strong) CAShapeLayer *topShadow;
 @property(nonatomic, strong) CAShapeLayer *bottomShadow;
 @property(nonatomic, strong) CAShapeLayer *topShadowMask;
@@ -120,11 +150,21 @@ static const float kAmbientShadowOpacity = (float)0.08;
       MDCShadowLayer *otherLayer = (MDCShadowLayer *)layer;
       _elevation = otherLayer.elevation;
       _shadowMaskEnabled = otherLayer.isShadowMaskEnabled;
-      _bottomShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadow];
-      _topShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadow];
-      _topShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadowMask];
-      _bottomShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadowMask];
-      [self commonMDCShadowLayerInit];
+      _singleLayerShadowApproximationEnabled =
+          otherLayer.isSingleLayerShadowApproximationEnabled;
+      if (otherLayer.bottomShadow) {
+        _bottomShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadow];
+      }
+      if (otherLayer.topShadow) {
+        _topShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadow];
+      }
+      if (otherLayer.topShadowMask) {
+        _topShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadowMask];
+      }
+      if (otherLayer.bottomShadowMask) {
+        _bottomShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadowMask];
+      }
+      [self applyShadowMetrics];
     }
   }
   return self;
@@ -135,47 +175,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
  _shadowMaskEnabled.
  */
 - (void)commonMDCShadowLayerInit {
-  if (!_bottomShadow) {
-    _bottomShadow = [CAShapeLayer layer];
-    _bottomShadow.backgroundColor = [UIColor clearColor].CGColor;
-    _bottomShadow.shadowColor = [UIColor blackColor].CGColor;
-    _bottomShadow.delegate = self;
-    [self addSublayer:_bottomShadow];
-  }
-
-  if (!_topShadow) {
-    _topShadow = [CAShapeLayer layer];
-    _topShadow.backgroundColor = [UIColor clearColor].CGColor;
-    _topShadow.shadowColor = [UIColor blackColor].CGColor;
-    _topShadow.delegate = self;
-    [self addSublayer:_topShadow];
-  }
-
-  // Setup shadow layer state based off _elevation and _shadowMaskEnabled
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:_elevation];
-  _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
-  _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
-  _topShadow.shadowOpacity = shadowMetrics.topShadowOpacity;
-  _bottomShadow.shadowOffset = shadowMetrics.bottomShadowOffset;
-  _bottomShadow.shadowRadius = shadowMetrics.bottomShadowRadius;
-  _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
-
-  if (!_topShadowMask) {
-    _topShadowMask = [CAShapeLayer layer];
-    _topShadowMask.delegate = self;
-  }
-  if (!_bottomShadowMask) {
-    _bottomShadowMask = [CAShapeLayer layer];
-    _bottomShadowMask.delegate = self;
-  }
-
-  // TODO(#1021): We shouldn't be calling property accessors in an init method.
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
-    _topShadow.mask = _topShadowMask;
-    _bottomShadow.mask = _bottomShadowMask;
-  }
+  [self updateShadowSublayers];
 }
 
 - (void)layoutSublayers {
@@ -198,6 +198,112 @@ static const float kAmbientShadowOpacity = (float)0.08;
   // This method is meant to be overriden by its subclasses.
 }
 
+#pragma mark - Shadow sublayers
+
+- (CAShapeLayer *)makeShadowSublayer {
+  CAShapeLayer *shadowLayer = [CAShapeLayer layer];
+  shadowLayer.backgroundColor = [UIColor clearColor].CGColor;
+  shadowLayer.shadowColor = self.shadowColor;
+  shadowLayer.cornerRadius = self.cornerRadius;
+  shadowLayer.shouldRasterize = self.shouldRasterize;
+  shadowLayer.delegate = self;
+  return shadowLayer;
+}
+
+- (CAShapeLayer *)makeShadowMaskLayer {
+  CAShapeLayer *maskLayer = [CAShapeLayer layer];
+  maskLayer.delegate = self;
+  return maskLayer;
+}
+
+/** Attaches or detaches the shadow sublayers to match the elevation and approximation mode. */
+- (void)updateShadowSublayers {
+  BOOL needsShadow = _elevation > 0;
+  BOOL needsTopShadow = needsShadow && !_singleLayerShadowApproximationEnabled;
+
+  if (needsShadow) {
+    if (!_bottomShadow) {
+      _bottomShadow = [self makeShadowSublayer];
+    }
+    if (!_bottomShadow.superlayer) {
+      [self insertSublayer:_bottomShadow atIndex:0];
+      _shadowPathIsInvalid = YES;
+      [self setNeedsLayout];
+    }
+  } else {
+    [_bottomShadow removeFromSuperlayer];
+  }
+
+  if (needsTopShadow) {
+    if (!_topShadow) {
+      _topShadow = [self makeShadowSublayer];
+    }
+    if (!_topShadow.superlayer) {
+      [self insertSublayer:_topShadow above:_bottomShadow];
+      _shadowPathIsInvalid = YES;
+      [self setNeedsLayout];
+    }
+  } else {
+    [_topShadow removeFromSuperlayer];
+  }
+
+  [self updateShadowMasks];
+  [self applyShadowMetrics];
+}
+
+- (void)applyShadowMetrics {
+  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:_elevation];
+  if (_singleLayerShadowApproximationEnabled) {
+    CGFloat radius;
+    CGSize offset;
+    float opacity;
+    MDCSingleShadowApproximationFromMetrics(shadowMetrics, &radius, &offset, &opacity);
+    _bottomShadow.shadowOffset = offset;
+    _bottomShadow.shadowRadius = radius;
+    _bottomShadow.shadowOpacity = opacity;
+    return;
+  }
+
+  _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
+  _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
+  _topShadow.shadowOpacity = shadowMetrics.topShadowOpacity;
+  _bottomShadow.shadowOffset = shadowMetrics.bottomShadowOffset;
+  _bottomShadow.shadowRadius = shadowMetrics.bottomShadowRadius;
+  _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
+}
+
+/** Configures the masks of the attached shadow sublayers, creating them if needed. */
+- (void)updateShadowMasks {
+  if (!_shadowMaskEnabled) {
+    _topShadow.mask = nil;
+    _bottomShadow.mask = nil;
+    return;
+  }
+
+  if (_bottomShadow.superlayer) {
+    if (!_bottomShadowMask) {
+      _bottomShadowMask = [self makeShadowMaskLayer];
+    }
+    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+    _bottomShadow.mask = _bottomShadowMask;
+  }
+  if (_topShadow.superlayer) {
+    if (!_topShadowMask) {
+      _topShadowMask = [self makeShadowMaskLayer];
+    }
+    [self configureShadowLayerMaskForLayer:_topShadowMask];
+    _topShadow.mask = _topShadowMask;
+  }
+}
+
+- (void)setSingleLayerShadowApproximationEnabled:(BOOL)singleLayerShadowApproximationEnabled {
+  if (_singleLayerShadowApproximationEnabled == singleLayerShadowApproximationEnabled) {
+    return;
+  }
+  _singleLayerShadowApproximationEnabled = singleLayerShadowApproximationEnabled;
+  [self updateShadowSublayers];
+}
+
 #pragma mark - CALayer change monitoring.
 
 /** Returns a shadowPath based on the layer properties. */
@@ -214,22 +320,14 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
   _topShadow.cornerRadius = cornerRadius;
   _bottomShadow.cornerRadius = cornerRadius;
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
-    _topShadow.mask = _topShadowMask;
-    _bottomShadow.mask = _bottomShadowMask;
-  }
+  [self updateShadowMasks];
 }
 
 - (void)setShadowPath:(CGPathRef)shadowPath {
   super.shadowPath = shadowPath;
   _topShadow.shadowPath = shadowPath;
   _bottomShadow.shadowPath = shadowPath;
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
-  }
+  [self updateShadowMasks];
 }
 
 - (void)setShadowColor:(CGColorRef)shadowColor {
@@ -265,15 +363,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 - (void)setShadowMaskEnabled:(BOOL)shadowMaskEnabled {
   _shadowMaskEnabled = shadowMaskEnabled;
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
-    _topShadow.mask = _topShadowMask;
-    _bottomShadow.mask = _bottomShadowMask;
-  } else {
-    _topShadow.mask = nil;
-    _bottomShadow.mask = nil;
-  }
+  [self updateShadowMasks];
 }
 
 // Creates a layer mask that has a hole cut inside so that the original contents
@@ -312,14 +402,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
 - (void)setElevation:(CGFloat)elevation {
   _elevation = elevation;
 
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:elevation];
-
-  _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
-  _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
-  _topShadow.shadowOpacity = shadowMetrics.topShadowOpacity;
-  _bottomShadow.shadowOffset = shadowMetrics.bottomShadowOffset;
-  _bottomShadow.shadowRadius = shadowMetrics.bottomShadowRadius;
-  _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
+  [self updateShadowSublayers];
 }
 
 #pragma mark - CALayerDelegate
@@ -342,32 +425,29 @@ static const float kAmbientShadowOpacity = (float)0.08;
 #pragma mark - Private
 
 - (void)commonLayoutSublayers {
+  if (!_bottomShadow.superlayer) {
+    // Nothing casts a shadow at zero elevation.
+    return;
+  }
   CGRect bounds = self.bounds;
+  CGPoint center = CGPointMake(CGRectGetMidX(bounds), CGRectGetMidY(bounds));
 
-  _bottomShadow.position = CGPointMake(CGRectGetMidX(bounds), CGRectGetMidY(bounds));
+  _bottomShadow.position = center;
   _bottomShadow.bounds = bounds;
-  _topShadow.position = CGPointMake(CGRectGetMidX(bounds), CGRectGetMidY(bounds));
-  _topShadow.bounds = bounds;
-
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+  if (_topShadow.superlayer) {
+    _topShadow.position = center;
+    _topShadow.bounds = bounds;
   }
+
+  [self updateShadowMasks];
   // Enforce shadowPaths because otherwise no shadows can be drawn. If a shadowPath
   // is already set, use that, otherwise fallback to just a regular rect because path.
+  CGPathRef shadowPath = self.shadowPath;
   if (!_bottomShadow.shadowPath || _shadowPathIsInvalid) {
-    if (self.shadowPath) {
-      _bottomShadow.shadowPath = self.shadowPath;
-    } else {
-      _bottomShadow.shadowPath = [self defaultShadowPath].CGPath;
-    }
+    _bottomShadow.shadowPath = shadowPath ?: [self defaultShadowPath].CGPath;
   }
-  if (!_topShadow.shadowPath || _shadowPathIsInvalid) {
-    if (self.shadowPath) {
-      _topShadow.shadowPath = self.shadowPath;
-    } else {
-      _topShadow.shadowPath = [self defaultShadowPath].CGPath;
-    }
+  if (_topShadow.superlayer && (!_topShadow.shadowPath || _shadowPathIsInvalid)) {
+    _topShadow.shadowPath = shadowPath ?: [self defaultShadowPath].CGPath;
   }
   _shadowPathIsInvalid = NO;
 }
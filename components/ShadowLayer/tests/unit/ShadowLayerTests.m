@@ -93,4 +93,81 @@
   }
 }
 
+- (void)testNoShadowSublayersAtZeroElevation {
+  // Given
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+
+  // When
+  shadowLayer.elevation = 0;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.count, 0U);
+}
+
+- (void)testShadowSublayersAreAttachedAtNonZeroElevationAndDetachedAtZeroElevation {
+  // Given
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 50);
+
+  // When
+  shadowLayer.elevation = 8;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.count, 2U);
+  NSArray<CALayer *> *shadowSublayers = [shadowLayer.sublayers copy];
+  for (CALayer *sublayer in shadowSublayers) {
+    XCTAssertNotNil(sublayer.mask);
+    XCTAssertGreaterThan(sublayer.shadowRadius, 0);
+  }
+
+  // When
+  shadowLayer.elevation = 0;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.count, 0U);
+
+  // When
+  shadowLayer.elevation = 2;
+
+  // Then
+  XCTAssertEqualObjects(shadowLayer.sublayers, shadowSublayers);
+}
+
+- (void)testShadowSublayersAreBelowExistingSublayers {
+  // Given
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+  CALayer *contentLayer = [CALayer layer];
+  [shadowLayer addSublayer:contentLayer];
+
+  // When
+  shadowLayer.elevation = 4;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.lastObject, contentLayer);
+}
+
+- (void)testSingleLayerShadowApproximationUsesOneSublayer {
+  // Given
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 50);
+  MDCShadowMetrics *metrics = [MDCShadowMetrics metricsWithElevation:6];
+
+  // When
+  shadowLayer.singleLayerShadowApproximationEnabled = YES;
+  shadowLayer.elevation = 6;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.count, 1U);
+  CALayer *sublayer = shadowLayer.sublayers.firstObject;
+  XCTAssertGreaterThan(sublayer.shadowOpacity, metrics.bottomShadowOpacity);
+  XCTAssertGreaterThan(sublayer.shadowRadius, metrics.bottomShadowRadius);
+  XCTAssertLessThan(sublayer.shadowRadius, metrics.topShadowRadius);
+
+  // When
+  shadowLayer.singleLayerShadowApproximationEnabled = NO;
+
+  // Then
+  XCTAssertEqual(shadowLayer.sublayers.count, 2U);
+}
+
 @end
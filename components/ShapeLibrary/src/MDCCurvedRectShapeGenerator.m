@@ -65,4 +65,8 @@
   return [_rectGenerator pathForSize:size];
 }
 
+- (NSArray *)pathsForSizes:(NSArray<NSValue *> *)sizes {
+  return [_rectGenerator pathsForSizes:sizes];
+}
+
 @end
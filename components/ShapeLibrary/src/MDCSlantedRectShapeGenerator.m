@@ -50,4 +50,8 @@
   return [_rectangleGenerator pathForSize:size];
 }
 
+- (NSArray *)pathsForSizes:(NSArray<NSValue *> *)sizes {
+  return [_rectangleGenerator pathsForSizes:sizes];
+}
+
 @end
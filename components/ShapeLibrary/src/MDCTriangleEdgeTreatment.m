@@ -40,4 +40,19 @@
   return [[[self class] alloc] initWithSize:_size style:_style];
 }
 
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (!object || ![[object class] isEqual:[self class]]) {
+    return NO;
+  }
+  MDCTriangleEdgeTreatment *otherTriangleEdge = (MDCTriangleEdgeTreatment *)object;
+  return self.size == otherTriangleEdge.size && self.style == otherTriangleEdge.style;
+}
+
+- (NSUInteger)hash {
+  return @(self.size).hash ^ (NSUInteger)self.style;
+}
+
 @end
@@ -0,0 +1,229 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapeLibrary.h"
+#import "MaterialShapes.h"
+
+static const NSInteger kIterations = 10000;
+
+#pragma mark - Object-per-operation baseline
+
+// A copy of the object-per-operation recording model that MDCPathGenerator used before it moved to
+// a flat command buffer. It is kept here only as a baseline for the benchmarks below.
+
+@interface LegacyPathCommand : NSObject
+- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform;
+@end
+
+@implementation LegacyPathCommand
+- (void)applyToCGPath:(CGMutablePathRef)__unused cgPath
+            transform:(CGAffineTransform *)__unused transform {
+}
+@end
+
+@interface LegacyPathLineCommand : LegacyPathCommand
+@property(nonatomic, assign) CGPoint point;
+@end
+
+@implementation LegacyPathLineCommand
+- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
+  CGPathAddLineToPoint(cgPath, transform, self.point.x, self.point.y);
+}
+@end
+
+@interface LegacyPathArcToCommand : LegacyPathCommand
+@property(nonatomic, assign) CGPoint start;
+@property(nonatomic, assign) CGPoint end;
+@property(nonatomic, assign) CGFloat radius;
+@end
+
+@implementation LegacyPathArcToCommand
+- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
+  CGPathAddArcToPoint(cgPath, transform, self.start.x, self.start.y, self.end.x, self.end.y,
+                      self.radius);
+}
+@end
+
+@interface LegacyPathQuadCurveCommand : LegacyPathCommand
+@property(nonatomic, assign) CGPoint control;
+@property(nonatomic, assign) CGPoint end;
+@end
+
+@implementation LegacyPathQuadCurveCommand
+- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
+  CGPathAddQuadCurveToPoint(cgPath, transform, self.control.x, self.control.y, self.end.x,
+                            self.end.y);
+}
+@end
+
+@interface LegacyPathGenerator : NSObject
+@property(nonatomic, strong) NSMutableArray<LegacyPathCommand *> *operations;
+@end
+
+@implementation LegacyPathGenerator
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _operations = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)addLineToPoint:(CGPoint)point {
+  LegacyPathLineCommand *op = [[LegacyPathLineCommand alloc] init];
+  op.point = point;
+  [_operations addObject:op];
+}
+
+- (void)addArcWithTangentPoint:(CGPoint)tangentPoint
+                       toPoint:(CGPoint)toPoint
+                        radius:(CGFloat)radius {
+  LegacyPathArcToCommand *op = [[LegacyPathArcToCommand alloc] init];
+  op.start = tangentPoint;
+  op.end = toPoint;
+  op.radius = radius;
+  [_operations addObject:op];
+}
+
+- (void)addQuadCurveWithControlPoint:(CGPoint)controlPoint toPoint:(CGPoint)toPoint {
+  LegacyPathQuadCurveCommand *op = [[LegacyPathQuadCurveCommand alloc] init];
+  op.control = controlPoint;
+  op.end = toPoint;
+  [_operations addObject:op];
+}
+
+- (void)appendToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
+  for (LegacyPathCommand *op in _operations) {
+    [op applyToCGPath:cgPath transform:transform];
+  }
+}
+
+@end
+
+#pragma mark - Benchmarks
+
+@interface ShapeLibraryPathGenerationBenchmarkTests : XCTestCase
+@end
+
+@implementation ShapeLibraryPathGenerationBenchmarkTests
+
+- (void)measureCornerTreatment:(MDCCornerTreatment *)corner {
+  [self measureBlock:^{
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGPathMoveToPoint(path, NULL, 0, 0);
+    for (NSInteger i = 0; i < kIterations; i++) {
+      MDCPathGenerator *generator = [corner pathGeneratorForCornerWithAngle:(CGFloat)M_PI_2];
+      [generator appendToCGPath:path transform:NULL];
+    }
+    CGPathRelease(path);
+  }];
+}
+
+- (void)measureEdgeTreatment:(MDCEdgeTreatment *)edge {
+  [self measureBlock:^{
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGPathMoveToPoint(path, NULL, 0, 0);
+    for (NSInteger i = 0; i < kIterations; i++) {
+      MDCPathGenerator *generator = [edge pathGeneratorForEdgeWithLength:100];
+      [generator appendToCGPath:path transform:NULL];
+    }
+    CGPathRelease(path);
+  }];
+}
+
+- (void)measureLegacyRecording:(void (^)(LegacyPathGenerator *generator))record {
+  [self measureBlock:^{
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGPathMoveToPoint(path, NULL, 0, 0);
+    for (NSInteger i = 0; i < kIterations; i++) {
+      LegacyPathGenerator *generator = [[LegacyPathGenerator alloc] init];
+      record(generator);
+      [generator appendToCGPath:path transform:NULL];
+    }
+    CGPathRelease(path);
+  }];
+}
+
+// Each treatment is measured twice: recording its operations into the legacy object-per-operation
+// model, and generating it through MDCPathGenerator's command buffer.
+
+- (void)testPerformanceLegacyRoundedCornerTreatment {
+  [self measureLegacyRecording:^(LegacyPathGenerator *generator) {
+    [generator addArcWithTangentPoint:CGPointZero toPoint:CGPointMake(8, 0) radius:8];
+  }];
+}
+
+- (void)testPerformanceRoundedCornerTreatment {
+  [self measureCornerTreatment:[[MDCRoundedCornerTreatment alloc] initWithRadius:8]];
+}
+
+- (void)testPerformanceLegacyCutCornerTreatment {
+  [self measureLegacyRecording:^(LegacyPathGenerator *generator) {
+    [generator addLineToPoint:CGPointMake(8, 0)];
+  }];
+}
+
+- (void)testPerformanceCutCornerTreatment {
+  [self measureCornerTreatment:[[MDCCutCornerTreatment alloc] initWithCut:8]];
+}
+
+- (void)testPerformanceLegacyCurvedCornerTreatment {
+  [self measureLegacyRecording:^(LegacyPathGenerator *generator) {
+    [generator addQuadCurveWithControlPoint:CGPointZero toPoint:CGPointMake(8, 0)];
+  }];
+}
+
+- (void)testPerformanceCurvedCornerTreatment {
+  [self measureCornerTreatment:[[MDCCurvedCornerTreatment alloc] initWithSize:CGSizeMake(8, 4)]];
+}
+
+- (void)testPerformanceLegacyTriangleEdgeTreatment {
+  [self measureLegacyRecording:^(LegacyPathGenerator *generator) {
+    [generator addLineToPoint:CGPointMake(42, 0)];
+    [generator addLineToPoint:CGPointMake(50, 8)];
+    [generator addLineToPoint:CGPointMake(58, 0)];
+    [generator addLineToPoint:CGPointMake(100, 0)];
+  }];
+}
+
+- (void)testPerformanceTriangleEdgeTreatment {
+  [self measureEdgeTreatment:[[MDCTriangleEdgeTreatment alloc]
+                                 initWithSize:8
+                                        style:MDCTriangleEdgeStyleHandle]];
+}
+
+- (void)testPerformanceRectangleShapeGeneratorWithAllTreatments {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  generator.topLeftCorner = [[MDCRoundedCornerTreatment alloc] initWithRadius:8];
+  generator.topRightCorner = [[MDCCutCornerTreatment alloc] initWithCut:8];
+  generator.bottomRightCorner = [[MDCCurvedCornerTreatment alloc] initWithSize:CGSizeMake(8, 4)];
+  generator.bottomLeftCorner = [[MDCRoundedCornerTreatment alloc] initWithRadius:4];
+  [generator setEdges:[[MDCTriangleEdgeTreatment alloc] initWithSize:4
+                                                                style:MDCTriangleEdgeStyleCut]];
+
+  // Then
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kIterations / 10; i++) {
+      @autoreleasepool {
+        [generator pathForSize:CGSizeMake(100 + i % 10, 50)];
+      }
+    }
+  }];
+}
+
+@end
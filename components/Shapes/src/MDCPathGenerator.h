@@ -20,6 +20,10 @@
  lineTo and addArc... methods, then call appendToCGPath to append them to a
  CGPath.
 
+ Operations are recorded into a flat buffer of fixed-size commands rather than as individual
+ objects, and are replayed into the CGPath in a single loop. Generators with a handful of operations
+ do not allocate beyond the generator itself.
+
  @note MDCPathGenerators always start at (0, 0) and end at @c endPoint.
  */
 @interface MDCPathGenerator : NSObject
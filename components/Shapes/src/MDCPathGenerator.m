@@ -14,42 +14,44 @@
 
 #import "MDCPathGenerator.h"
 
-
-@interface MDCPathCommand : NSObject
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform;
-@end
-
-@interface MDCPathLineCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint point;
-@end
-
-@interface MDCPathArcCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint point;
-@property(nonatomic, assign) CGFloat radius;
-@property(nonatomic, assign) CGFloat startAngle;
-@property(nonatomic, assign) CGFloat endAngle;
-@property(nonatomic, assign) BOOL clockwise;
-@end
-
-@interface MDCPathArcToCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint start;
-@property(nonatomic, assign) CGPoint end;
-@property(nonatomic, assign) CGFloat radius;
-@end
-
-@interface MDCPathCurveCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint control1;
-@property(nonatomic, assign) CGPoint control2;
-@property(nonatomic, assign) CGPoint end;
-@end
-
-@interface MDCPathQuadCurveCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint control;
-@property(nonatomic, assign) CGPoint end;
-@end
+#include <stdlib.h>
+#include <string.h>
+
+/** The operations that can be recorded by an MDCPathGenerator. */
+typedef NS_ENUM(uint8_t, MDCPathOpcode) {
+  MDCPathOpcodeLine,
+  MDCPathOpcodeArc,
+  MDCPathOpcodeArcTo,
+  MDCPathOpcodeCurve,
+  MDCPathOpcodeQuadCurve,
+};
+
+/**
+ A single recorded path operation. The meaning of @c values depends on @c opcode:
+
+ - Line:      x, y
+ - Arc:       centerX, centerY, radius, startAngle, endAngle
+ - ArcTo:     tangentX, tangentY, toX, toY, radius
+ - Curve:     control1X, control1Y, control2X, control2Y, toX, toY
+ - QuadCurve: controlX, controlY, toX, toY
+ */
+typedef struct {
+  MDCPathOpcode opcode;
+  bool clockwise;
+  CGFloat values[6];
+} MDCPathCommand;
+
+/**
+ The number of commands stored inline before spilling to the heap. Every treatment in
+ MaterialShapeLibrary records at most this many operations.
+ */
+#define kInlineCommandCapacity 4
 
 @implementation MDCPathGenerator {
-  NSMutableArray *_operations;
+  MDCPathCommand _inlineCommands[kInlineCommandCapacity];
+  MDCPathCommand *_commands;
+  NSUInteger _commandCount;
+  NSUInteger _commandCapacity;
   CGPoint _startPoint;
   CGPoint _endPoint;
 }
@@ -64,7 +66,8 @@
 
 - (instancetype)initWithStartPoint:(CGPoint)start {
   if (self = [super init]) {
-    _operations = [NSMutableArray array];
+    _commands = _inlineCommands;
+    _commandCapacity = kInlineCommandCapacity;
 
     _startPoint = start;
     _endPoint = start;
@@ -72,10 +75,48 @@
   return self;
 }
 
+- (void)dealloc {
+  if (_commands != _inlineCommands) {
+    free(_commands);
+  }
+}
+
+/**
+ Returns a new command at the end of the buffer, or NULL if the buffer could not grow, in which case
+ the buffer is left as it was.
+ */
+- (MDCPathCommand *)appendCommandWithOpcode:(MDCPathOpcode)opcode {
+  if (_commandCount == _commandCapacity) {
+    NSUInteger newCapacity = _commandCapacity * 2;
+    MDCPathCommand *newCommands;
+    if (_commands == _inlineCommands) {
+      newCommands = malloc(newCapacity * sizeof(MDCPathCommand));
+      if (newCommands == NULL) {
+        return NULL;
+      }
+      memcpy(newCommands, _inlineCommands, _commandCount * sizeof(MDCPathCommand));
+    } else {
+      newCommands = realloc(_commands, newCapacity * sizeof(MDCPathCommand));
+      if (newCommands == NULL) {
+        return NULL;
+      }
+    }
+    _commands = newCommands;
+    _commandCapacity = newCapacity;
+  }
+  MDCPathCommand *command = &_commands[_commandCount++];
+  command->opcode = opcode;
+  command->clockwise = false;
+  return command;
+}
+
 - (void)addLineToPoint:(CGPoint)point {
-  MDCPathLineCommand *op = [[MDCPathLineCommand alloc] init];
-  op.point = point;
-  [_operations addObject:op];
+  MDCPathCommand *command = [self appendCommandWithOpcode:MDCPathOpcodeLine];
+  if (command == NULL) {
+    return;
+  }
+  command->values[0] = point.x;
+  command->values[1] = point.y;
 
   _endPoint = point;
 }
@@ -85,13 +126,16 @@
               startAngle:(CGFloat)startAngle
                 endAngle:(CGFloat)endAngle
                clockwise:(BOOL)clockwise {
-  MDCPathArcCommand *op = [[MDCPathArcCommand alloc] init];
-  op.point = center;
-  op.radius = radius;
-  op.startAngle = startAngle;
-  op.endAngle = endAngle;
-  op.clockwise = clockwise;
-  [_operations addObject:op];
+  MDCPathCommand *command = [self appendCommandWithOpcode:MDCPathOpcodeArc];
+  if (command == NULL) {
+    return;
+  }
+  command->values[0] = center.x;
+  command->values[1] = center.y;
+  command->values[2] = radius;
+  command->values[3] = startAngle;
+  command->values[4] = endAngle;
+  command->clockwise = clockwise;
 
   _endPoint =
       CGPointMake(center.x + radius * cos(endAngle), center.y + radius * sin(endAngle));
@@ -100,11 +144,15 @@
 - (void)addArcWithTangentPoint:(CGPoint)tangentPoint
                        toPoint:(CGPoint)toPoint
                         radius:(CGFloat)radius {
-  MDCPathArcToCommand *op = [[MDCPathArcToCommand alloc] init];
-  op.start = tangentPoint;
-  op.end = toPoint;
-  op.radius = radius;
-  [_operations addObject:op];
+  MDCPathCommand *command = [self appendCommandWithOpcode:MDCPathOpcodeArcTo];
+  if (command == NULL) {
+    return;
+  }
+  command->values[0] = tangentPoint.x;
+  command->values[1] = tangentPoint.y;
+  command->values[2] = toPoint.x;
+  command->values[3] = toPoint.y;
+  command->values[4] = radius;
 
   _endPoint = toPoint;
 }
@@ -112,79 +160,55 @@
 - (void)addCurveWithControlPoint1:(CGPoint)controlPoint1
                     controlPoint2:(CGPoint)controlPoint2
                           toPoint:(CGPoint)toPoint {
-  MDCPathCurveCommand *op = [[MDCPathCurveCommand alloc] init];
-  op.control1 = controlPoint1;
-  op.control2 = controlPoint2;
-  op.end = toPoint;
-  [_operations addObject:op];
+  MDCPathCommand *command = [self appendCommandWithOpcode:MDCPathOpcodeCurve];
+  if (command == NULL) {
+    return;
+  }
+  command->values[0] = controlPoint1.x;
+  command->values[1] = controlPoint1.y;
+  command->values[2] = controlPoint2.x;
+  command->values[3] = controlPoint2.y;
+  command->values[4] = toPoint.x;
+  command->values[5] = toPoint.y;
 
   _endPoint = toPoint;
 }
 
 - (void)addQuadCurveWithControlPoint:(CGPoint)controlPoint toPoint:(CGPoint)toPoint {
-  MDCPathQuadCurveCommand *op = [[MDCPathQuadCurveCommand alloc] init];
-  op.control = controlPoint;
-  op.end = toPoint;
-  [_operations addObject:op];
+  MDCPathCommand *command = [self appendCommandWithOpcode:MDCPathOpcodeQuadCurve];
+  if (command == NULL) {
+    return;
+  }
+  command->values[0] = controlPoint.x;
+  command->values[1] = controlPoint.y;
+  command->values[2] = toPoint.x;
+  command->values[3] = toPoint.y;
 
   _endPoint = toPoint;
 }
 
 - (void)appendToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  for (MDCPathCommand *op in _operations) {
-    [op applyToCGPath:cgPath transform:transform];
+  const MDCPathCommand *commands = _commands;
+  for (NSUInteger i = 0; i < _commandCount; i++) {
+    const CGFloat *v = commands[i].values;
+    switch (commands[i].opcode) {
+      case MDCPathOpcodeLine:
+        CGPathAddLineToPoint(cgPath, transform, v[0], v[1]);
+        break;
+      case MDCPathOpcodeArc:
+        CGPathAddArc(cgPath, transform, v[0], v[1], v[2], v[3], v[4], commands[i].clockwise);
+        break;
+      case MDCPathOpcodeArcTo:
+        CGPathAddArcToPoint(cgPath, transform, v[0], v[1], v[2], v[3], v[4]);
+        break;
+      case MDCPathOpcodeCurve:
+        CGPathAddCurveToPoint(cgPath, transform, v[0], v[1], v[2], v[3], v[4], v[5]);
+        break;
+      case MDCPathOpcodeQuadCurve:
+        CGPathAddQuadCurveToPoint(cgPath, transform, v[0], v[1], v[2], v[3]);
+        break;
+    }
   }
 }
 
 @end
-
-@implementation MDCPathCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)__unused cgPath
-            transform:(CGAffineTransform *)__unused transform {
-  // no-op
-}
-
-@end
-
-@implementation MDCPathLineCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddLineToPoint(cgPath, transform, self.point.x, self.point.y);
-}
-
-@end
-
-@implementation MDCPathArcCommand
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddArc(cgPath, transform, self.point.x, self.point.y, self.radius, self.startAngle,
-               self.endAngle, self.clockwise);
-}
-@end
-
-@implementation MDCPathArcToCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddArcToPoint(cgPath, transform, self.start.x, self.start.y, self.end.x, self.end.y,
-                      self.radius);
-}
-
-@end
-
-@implementation MDCPathCurveCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddCurveToPoint(cgPath, transform, self.control1.x, self.control1.y, self.control2.x,
-                        self.control2.y, self.end.x, self.end.y);
-}
-
-@end
-
-@implementation MDCPathQuadCurveCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddQuadCurveToPoint(cgPath, transform, self.control.x, self.control.y, self.end.x,
-                            self.end.y);
-}
-
-@end
@@ -51,6 +51,31 @@
 @property(nonatomic, strong) MDCEdgeTreatment *bottomEdge;
 @property(nonatomic, strong) MDCEdgeTreatment *leftEdge;
 
+/**
+ Whether generated paths are stored in and served from @c MDCShapePathCache.sharedCache.
+
+ When enabled, sizes are rounded to the main screen's scale and the generator's treatments and
+ offsets are compared by value, so equal shapes generated by different generators share one
+ immutable path. Treatments must implement @c -isEqual: and @c -hash over all of the state that
+ affects their generated paths; the treatments in MaterialShapeLibrary do. Paths are not cached
+ while any treatment's class inherits its @c -isEqual: rather than implementing it.
+
+ Defaults to NO.
+ */
+@property(nonatomic, assign) BOOL cachesGeneratedPaths;
+
+/**
+ Creates CGPaths for each of the given sizes.
+
+ Corner angles, edge angles and the path generators of absolute-valued corners are computed once for
+ the whole batch when no corner offsets are set; only the size-dependent transforms, edges and
+ percentage-valued corners are recomputed per size. Honors @c cachesGeneratedPaths.
+
+ @param sizes An array of CGSize values wrapped in NSValue.
+ @return An array with one CGPathRef bridged to @c id per size, in order.
+ */
+- (nonnull NSArray *)pathsForSizes:(nonnull NSArray<NSValue *> *)sizes;
+
 /**
  Convenience to set all corners to the same MDCCornerTreatment instance.
  */
@@ -14,14 +14,33 @@
 
 #import "MDCRectangleShapeGenerator.h"
 
+#import <os/lock.h>
+
 #import "MDCCornerTreatment.h"
 #import "MDCEdgeTreatment.h"
 #import "MDCPathGenerator.h"
+#import "MDCShapePathCache.h"
 
 static inline CGFloat CGPointDistanceToPoint(CGPoint a, CGPoint b) {
   return hypot(a.x - b.x, a.y - b.y);
 }
 
+static inline CGFloat MDCRoundToScale(CGFloat value, CGFloat scale) {
+  return round(value * scale) / scale;
+}
+
+static CGFloat MDCShapePathCacheScale(void) {
+  static CGFloat scale;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    scale = [UIScreen mainScreen].scale;
+    if (scale <= 0) {
+      scale = 1;
+    }
+  });
+  return scale;
+}
+
 // Edges in clockwise order
 typedef enum : NSUInteger {
   MDCShapeEdgeTop = 0,
@@ -38,10 +57,119 @@ typedef enum : NSUInteger {
   MDCShapeCornerBottomLeft,
 } MDCShapeCornerPosition;
 
-@implementation MDCRectangleShapeGenerator
+/**
+ Returns the object that stands for @c treatment in a path cache key, or nil if paths generated with
+ @c treatment can not be cached.
+
+ A treatment can only be told apart from another by value if its own class implements -isEqual:.
+ Inherited equality might ignore state the subclass adds, so such treatments are not cached. The
+ base MDCEdgeTreatment is stateless and always draws a straight line, so it is represented by its
+ class.
+ */
+static id MDCShapePathCacheKeyTreatment(id treatment) {
+  if (!treatment) {
+    // Unset treatments are represented by NSNull so that the key stays positional.
+    return [NSNull null];
+  }
+  Class treatmentClass = [treatment class];
+  if (treatmentClass == [MDCEdgeTreatment class]) {
+    return treatmentClass;
+  }
+  SEL isEqualSelector = @selector(isEqual:);
+  if ([treatmentClass instanceMethodForSelector:isEqualSelector] ==
+      [[treatmentClass superclass] instanceMethodForSelector:isEqualSelector]) {
+    return nil;
+  }
+  return treatment;
+}
+
+/**
+ Identifies a generated path by everything that affects its geometry.
+
+ Each generator reuses a single key for its lookups, so that a cache hit does not allocate. The copy
+ stored by the cache snapshots the treatments so that later mutations of a treatment can not alias a
+ stale path.
+ */
+@interface MDCRectangleShapePathCacheKey : NSObject <NSCopying> {
+ @public
+  Class _generatorClass;
+  CGSize _size;
+  CGPoint _cornerOffsets[4];
+  // Corners in clockwise order from the top left, followed by edges clockwise from the top.
+  id _treatments[8];
+  // The hash of everything but the size.
+  NSUInteger _shapeHash;
+  NSUInteger _hash;
+}
+@end
+
+@implementation MDCRectangleShapePathCacheKey
+
+- (id)copyWithZone:(NSZone *)zone {
+  MDCRectangleShapePathCacheKey *copy = [[MDCRectangleShapePathCacheKey alloc] init];
+  copy->_generatorClass = _generatorClass;
+  copy->_size = _size;
+  for (NSInteger i = 0; i < 4; i++) {
+    copy->_cornerOffsets[i] = _cornerOffsets[i];
+  }
+  for (NSInteger i = 0; i < 8; i++) {
+    id treatment = _treatments[i];
+    BOOL isPlaceholder = treatment == [NSNull null] || treatment == [MDCEdgeTreatment class];
+    copy->_treatments[i] = isPlaceholder ? treatment : [treatment copyWithZone:zone];
+  }
+  copy->_shapeHash = _shapeHash;
+  copy->_hash = _hash;
+  return copy;
+}
+
+- (void)setSize:(CGSize)size {
+  _size = size;
+  _hash = _shapeHash ^ (NSUInteger)lround(size.width * 64) ^
+          ((NSUInteger)lround(size.height * 64) << 16);
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCRectangleShapePathCacheKey class]]) {
+    return NO;
+  }
+  MDCRectangleShapePathCacheKey *other = (MDCRectangleShapePathCacheKey *)object;
+  if (_hash != other->_hash || _generatorClass != other->_generatorClass ||
+      !CGSizeEqualToSize(_size, other->_size)) {
+    return NO;
+  }
+  for (NSInteger i = 0; i < 4; i++) {
+    if (!CGPointEqualToPoint(_cornerOffsets[i], other->_cornerOffsets[i])) {
+      return NO;
+    }
+  }
+  for (NSInteger i = 0; i < 8; i++) {
+    if (_treatments[i] != other->_treatments[i] &&
+        ![_treatments[i] isEqual:other->_treatments[i]]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+@end
+
+@implementation MDCRectangleShapeGenerator {
+  // Guards _pathCacheLookupKey, which is refilled for every cached lookup.
+  os_unfair_lock _pathCacheLookupLock;
+  MDCRectangleShapePathCacheKey *_pathCacheLookupKey;
+}
 
 - (instancetype)init {
   if (self = [super init]) {
+    _pathCacheLookupLock = OS_UNFAIR_LOCK_INIT;
+    _pathCacheLookupKey = [[MDCRectangleShapePathCacheKey alloc] init];
     [self setEdges:[[MDCEdgeTreatment alloc] init]];
     [self setCorners:[[MDCCornerTreatment alloc] init]];
   }
@@ -66,6 +194,8 @@ typedef enum : NSUInteger {
   copy.bottomEdge = [copy.bottomEdge copyWithZone:zone];
   copy.leftEdge = [copy.leftEdge copyWithZone:zone];
 
+  copy.cachesGeneratedPaths = self.cachesGeneratedPaths;
+
   return copy;
 }
 
@@ -123,25 +253,186 @@ typedef enum : NSUInteger {
 }
 
 - (CGPathRef)pathForSize:(CGSize)size {
-  CGMutablePathRef path = CGPathCreateMutable();
+  if (!self.cachesGeneratedPaths) {
+    return [self generatePathForSize:size];
+  }
+
+  CGSize roundedSize = [self pathCacheSizeForSize:size];
+  MDCRectangleShapePathCacheKey *missedKey = nil;
+  CGPathRef cachedPath = NULL;
+  os_unfair_lock_lock(&_pathCacheLookupLock);
+  BOOL cacheable = [self preparePathCacheLookupKey];
+  if (cacheable) {
+    cachedPath = [self cachedPathForSize:roundedSize missedKey:&missedKey];
+  }
+  os_unfair_lock_unlock(&_pathCacheLookupLock);
+
+  if (!cacheable) {
+    return [self generatePathForSize:size];
+  }
+  if (cachedPath) {
+    return cachedPath;
+  }
+  return [MDCShapePathCache.sharedCache setPath:[self generatePathForSize:roundedSize]
+                                         forKey:missedKey];
+}
+
+- (NSArray *)pathsForSizes:(NSArray<NSValue *> *)sizes {
+  NSMutableArray *paths = [NSMutableArray arrayWithCapacity:sizes.count];
+
+  // Without corner offsets every corner of a non-empty rectangle is a right angle and the edge
+  // angles are fixed, so the angles and the absolute-valued corner paths do not depend on size.
+  BOOL hasSizeIndependentAngles = YES;
+  for (NSInteger i = 0; i < 4; i++) {
+    if (!CGPointEqualToPoint([self cornerOffsetForPosition:i], CGPointZero)) {
+      hasSizeIndependentAngles = NO;
+      break;
+    }
+  }
+  CGFloat cornerAngles[4];
+  CGFloat edgeAngles[4];
+  MDCPathGenerator *sharedCornerPaths[4] = {nil, nil, nil, nil};
+  if (hasSizeIndependentAngles) {
+    CGSize referenceSize = CGSizeMake(1, 1);
+    for (NSInteger i = 0; i < 4; i++) {
+      cornerAngles[i] = [self angleOfCorner:i forViewSize:referenceSize];
+      edgeAngles[i] = [self angleOfEdge:i forViewSize:referenceSize];
+      MDCCornerTreatment *cornerShape = [self cornerTreatmentForPosition:i];
+      if (cornerShape.valueType == MDCCornerTreatmentValueTypeAbsolute) {
+        sharedCornerPaths[i] = [cornerShape pathGeneratorForCornerWithAngle:cornerAngles[i]];
+      }
+    }
+  }
+
+  BOOL cachesGeneratedPaths = self.cachesGeneratedPaths;
+  if (cachesGeneratedPaths) {
+    os_unfair_lock_lock(&_pathCacheLookupLock);
+    cachesGeneratedPaths = [self preparePathCacheLookupKey];
+    os_unfair_lock_unlock(&_pathCacheLookupLock);
+  }
+  for (NSValue *sizeValue in sizes) {
+    CGSize size = sizeValue.CGSizeValue;
+    MDCRectangleShapePathCacheKey *key = nil;
+    if (cachesGeneratedPaths) {
+      size = [self pathCacheSizeForSize:size];
+      // The key's treatments and offsets were filled in once for the whole batch.
+      os_unfair_lock_lock(&_pathCacheLookupLock);
+      CGPathRef cachedPath = [self cachedPathForSize:size missedKey:&key];
+      os_unfair_lock_unlock(&_pathCacheLookupLock);
+      if (cachedPath) {
+        [paths addObject:(__bridge id)cachedPath];
+        continue;
+      }
+    }
+
+    CGPathRef path;
+    if (hasSizeIndependentAngles && size.width > 0 && size.height > 0) {
+      MDCPathGenerator *cornerPaths[4];
+      for (NSInteger i = 0; i < 4; i++) {
+        cornerPaths[i] = sharedCornerPaths[i];
+        if (!cornerPaths[i]) {
+          cornerPaths[i] = [self cornerPathGeneratorForPosition:i angle:cornerAngles[i] size:size];
+        }
+      }
+      path = [self generatePathForSize:size cornerPaths:cornerPaths edgeAngles:edgeAngles];
+    } else {
+      path = [self generatePathForSize:size];
+    }
+    if (key) {
+      path = [MDCShapePathCache.sharedCache setPath:path forKey:key];
+    }
+    [paths addObject:(__bridge id)path];
+  }
+  return paths;
+}
+
+- (CGSize)pathCacheSizeForSize:(CGSize)size {
+  CGFloat scale = MDCShapePathCacheScale();
+  return CGSizeMake(MDCRoundToScale(size.width, scale), MDCRoundToScale(size.height, scale));
+}
+
+/**
+ Fills the lookup key with the generator's class, corner offsets and treatments.
+
+ Must be called with _pathCacheLookupLock held.
+
+ @return NO if the generator's paths can not be cached.
+ */
+- (BOOL)preparePathCacheLookupKey {
+  MDCRectangleShapePathCacheKey *key = _pathCacheLookupKey;
+  key->_generatorClass = [self class];
+  NSUInteger hash = [[self class] hash];
+  for (NSInteger i = 0; i < 4; i++) {
+    CGPoint offset = [self cornerOffsetForPosition:i];
+    key->_cornerOffsets[i] = offset;
+    hash = hash * 31 + (NSUInteger)lround(offset.x * 64) + ((NSUInteger)lround(offset.y * 64) << 8);
+  }
+  id treatments[8] = {
+      self.topLeftCorner, self.topRightCorner, self.bottomRightCorner, self.bottomLeftCorner,
+      self.topEdge,       self.rightEdge,      self.bottomEdge,        self.leftEdge,
+  };
+  for (NSInteger i = 0; i < 8; i++) {
+    id treatment = MDCShapePathCacheKeyTreatment(treatments[i]);
+    if (!treatment) {
+      return NO;
+    }
+    key->_treatments[i] = treatment;
+    hash = hash * 31 + [treatment hash];
+  }
+  key->_shapeHash = hash;
+  return YES;
+}
+
+/**
+ Looks up the path for @c size with the prepared lookup key. On a miss, @c missedKey is set to a
+ copy of the key that the generated path can be stored under.
+
+ Must be called with _pathCacheLookupLock held.
+ */
+- (CGPathRef)cachedPathForSize:(CGSize)size
+                     missedKey:(MDCRectangleShapePathCacheKey **)missedKey {
+  [_pathCacheLookupKey setSize:size];
+  CGPathRef cachedPath = [MDCShapePathCache.sharedCache pathForKey:_pathCacheLookupKey];
+  if (!cachedPath) {
+    *missedKey = [_pathCacheLookupKey copy];
+  }
+  return cachedPath;
+}
+
+- (MDCPathGenerator *)cornerPathGeneratorForPosition:(MDCShapeCornerPosition)position
+                                               angle:(CGFloat)cornerAngle
+                                                size:(CGSize)size {
+  MDCCornerTreatment *cornerShape = [self cornerTreatmentForPosition:position];
+  if (cornerShape.valueType == MDCCornerTreatmentValueTypeAbsolute) {
+    return [cornerShape pathGeneratorForCornerWithAngle:cornerAngle];
+  } else if (cornerShape.valueType == MDCCornerTreatmentValueTypePercentage) {
+    return [cornerShape pathGeneratorForCornerWithAngle:cornerAngle forViewSize:size];
+  }
+  return nil;
+}
+
+- (CGPathRef)generatePathForSize:(CGSize)size {
   MDCPathGenerator *cornerPaths[4];
-  CGAffineTransform cornerTransforms[4];
-  CGAffineTransform edgeTransforms[4];
   CGFloat edgeAngles[4];
-  CGFloat edgeLengths[4];
 
   // Start by getting the path of each corner and calculating edge angles.
   for (NSInteger i = 0; i < 4; i++) {
-    MDCCornerTreatment *cornerShape = [self cornerTreatmentForPosition:i];
     CGFloat cornerAngle = [self angleOfCorner:i forViewSize:size];
-    if (cornerShape.valueType == MDCCornerTreatmentValueTypeAbsolute) {
-      cornerPaths[i] = [cornerShape pathGeneratorForCornerWithAngle:cornerAngle];
-    } else if (cornerShape.valueType == MDCCornerTreatmentValueTypePercentage) {
-      cornerPaths[i] = [cornerShape pathGeneratorForCornerWithAngle:cornerAngle forViewSize:size];
-    }
+    cornerPaths[i] = [self cornerPathGeneratorForPosition:i angle:cornerAngle size:size];
     edgeAngles[i] = [self angleOfEdge:i forViewSize:size];
   }
 
+  return [self generatePathForSize:size cornerPaths:cornerPaths edgeAngles:edgeAngles];
+}
+
+- (CGPathRef)generatePathForSize:(CGSize)size
+                     cornerPaths:(MDCPathGenerator *__strong *)cornerPaths
+                      edgeAngles:(const CGFloat *)edgeAngles {
+  CGMutablePathRef path = CGPathCreateMutable();
+  CGAffineTransform cornerTransforms[4];
+  CGAffineTransform edgeTransforms[4];
+  CGFloat edgeLengths[4];
+
   // Create transformation matrices for each corner and edge
   for (NSInteger i = 0; i < 4; i++) {
     CGPoint cornerCoords = [self cornerCoordsForPosition:i forViewSize:size];
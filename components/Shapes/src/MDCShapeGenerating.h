@@ -27,4 +27,32 @@
  */
 - (nullable CGPathRef)pathForSize:(CGSize)size;
 
+@optional
+
+/**
+ Creates CGPaths for each of the given sizes in a single call.
+
+ Implementations should perform size-independent work once for the whole batch. Callers that do not
+ know whether a generator implements this method should use MDCShapeGeneratorPathsForSizes.
+
+ @param sizes An array of CGSize values wrapped in NSValue.
+ @return An array with one entry per size, in order. Each entry is either a CGPathRef bridged to
+ @c id, or NSNull if no path was generated for that size.
+ */
+- (nonnull NSArray *)pathsForSizes:(nonnull NSArray<NSValue *> *)sizes;
+
 @end
+
+/**
+ Creates CGPaths for each of the given sizes using @c shapeGenerator.
+
+ Calls @c -pathsForSizes: if the generator implements it, and falls back to calling
+ @c -pathForSize: once per size otherwise.
+
+ @param shapeGenerator The shape generator to create the paths with.
+ @param sizes An array of CGSize values wrapped in NSValue.
+ @return An array with one entry per size, in order. Each entry is either a CGPathRef bridged to
+ @c id, or NSNull if no path was generated for that size.
+ */
+FOUNDATION_EXTERN NSArray *_Nonnull MDCShapeGeneratorPathsForSizes(
+    id<MDCShapeGenerating> _Nonnull shapeGenerator, NSArray<NSValue *> *_Nonnull sizes);
@@ -0,0 +1,96 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A bounded, thread-safe, least-recently-used cache of immutable CGPaths.
+
+ Shape generators that opt in to caching store the paths they generate here so that repeated
+ requests for an equal shape at an equal size cost a hash lookup rather than a path rebuild.
+ Cached paths are immutable and may be shared between any number of layers.
+ */
+@interface MDCShapePathCache : NSObject
+
+/**
+ The process-wide cache used by MDCRectangleShapeGenerator when @c cachesGeneratedPaths is enabled.
+ */
+@property(class, nonatomic, readonly) MDCShapePathCache *sharedCache;
+
+/**
+ The maximum number of paths held by the cache. When exceeded, the least recently used path is
+ evicted.
+
+ Setting a lower value immediately evicts paths until the limit is met.
+
+ Defaults to 256.
+ */
+@property(nonatomic, assign) NSUInteger countLimit;
+
+/** The number of paths currently held by the cache. */
+@property(nonatomic, readonly) NSUInteger count;
+
+/** The number of lookups that returned a cached path. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of lookups that did not find a cached path. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns an initialized cache with the given count limit.
+ */
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/**
+ Returns an initialized cache with the default count limit.
+ */
+- (instancetype)init;
+
+/**
+ Returns the path stored for @c key, marking it as most recently used, or NULL if there is none.
+
+ Every call counts towards either @c hitCount or @c missCount.
+
+ @param key The key the path was stored under.
+ @return An immutable, autoreleased path, or NULL.
+ */
+- (nullable CGPathRef)pathForKey:(id<NSCopying>)key CF_RETURNS_NOT_RETAINED;
+
+/**
+ Stores an immutable copy of @c path under @c key, evicting the least recently used path if the
+ count limit is exceeded.
+
+ @param path The path to store. A NULL path is ignored.
+ @param key The key to store the path under. The key is copied.
+ @return The immutable path now held by the cache, autoreleased.
+ */
+- (nullable CGPathRef)setPath:(nullable CGPathRef)path
+                       forKey:(id<NSCopying>)key CF_RETURNS_NOT_RETAINED;
+
+/**
+ Removes all paths from the cache. Hit and miss counts are not affected.
+ */
+- (void)removeAllPaths;
+
+/**
+ Resets @c hitCount and @c missCount to zero.
+ */
+- (void)resetCounters;
+
+@end
+
+NS_ASSUME_NONNULL_END
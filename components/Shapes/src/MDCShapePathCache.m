@@ -0,0 +1,216 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShapePathCache.h"
+
+#import <os/lock.h>
+
+static const NSUInteger kDefaultCountLimit = 256;
+
+/** A node of the cache's recency list. The list's head is the most recently used entry. */
+@interface MDCShapePathCacheEntry : NSObject {
+ @public
+  id<NSCopying> _key;
+  CGPathRef _path;
+  __unsafe_unretained MDCShapePathCacheEntry *_previous;
+  MDCShapePathCacheEntry *_next;
+}
+@end
+
+@implementation MDCShapePathCacheEntry
+
+- (void)dealloc {
+  CGPathRelease(_path);
+}
+
+@end
+
+@implementation MDCShapePathCache {
+  os_unfair_lock _lock;
+  NSMutableDictionary<id<NSCopying>, MDCShapePathCacheEntry *> *_entries;
+  MDCShapePathCacheEntry *_head;
+  __unsafe_unretained MDCShapePathCacheEntry *_tail;
+  NSUInteger _countLimit;
+  NSUInteger _hitCount;
+  NSUInteger _missCount;
+}
+
++ (MDCShapePathCache *)sharedCache {
+  static MDCShapePathCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCShapePathCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  return [self initWithCountLimit:kDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+  self = [super init];
+  if (self) {
+    _lock = OS_UNFAIR_LOCK_INIT;
+    _entries = [NSMutableDictionary dictionary];
+    _countLimit = countLimit;
+  }
+  return self;
+}
+
+#pragma mark - Public
+
+- (NSUInteger)countLimit {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger countLimit = _countLimit;
+  os_unfair_lock_unlock(&_lock);
+  return countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit {
+  os_unfair_lock_lock(&_lock);
+  _countLimit = countLimit;
+  [self evictEntriesOverLimit];
+  os_unfair_lock_unlock(&_lock);
+}
+
+- (NSUInteger)count {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger count = _entries.count;
+  os_unfair_lock_unlock(&_lock);
+  return count;
+}
+
+- (NSUInteger)hitCount {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger hitCount = _hitCount;
+  os_unfair_lock_unlock(&_lock);
+  return hitCount;
+}
+
+- (NSUInteger)missCount {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger missCount = _missCount;
+  os_unfair_lock_unlock(&_lock);
+  return missCount;
+}
+
+- (CGPathRef)pathForKey:(id<NSCopying>)key {
+  CGPathRef path = NULL;
+  os_unfair_lock_lock(&_lock);
+  MDCShapePathCacheEntry *entry = _entries[key];
+  if (entry) {
+    _hitCount += 1;
+    [self moveEntryToHead:entry];
+    path = CGPathRetain(entry->_path);
+  } else {
+    _missCount += 1;
+  }
+  os_unfair_lock_unlock(&_lock);
+  return path ? (CGPathRef)CFAutorelease(path) : NULL;
+}
+
+- (CGPathRef)setPath:(CGPathRef)path forKey:(id<NSCopying>)key {
+  if (!path) {
+    return NULL;
+  }
+  // Copying outside of the lock keeps the critical section short; CGPathCreateCopy of an
+  // immutable path is a retain.
+  CGPathRef immutablePath = CGPathCreateCopy(path);
+  id<NSCopying> keyCopy = [(id)key copy];
+
+  os_unfair_lock_lock(&_lock);
+  MDCShapePathCacheEntry *entry = _entries[keyCopy];
+  if (entry) {
+    // Another thread stored an equal path first; keep the existing one so callers share it.
+    CGPathRelease(immutablePath);
+    [self moveEntryToHead:entry];
+  } else {
+    entry = [[MDCShapePathCacheEntry alloc] init];
+    entry->_key = keyCopy;
+    entry->_path = immutablePath;
+    _entries[keyCopy] = entry;
+    [self insertEntryAtHead:entry];
+    [self evictEntriesOverLimit];
+  }
+  CGPathRef result = CGPathRetain(entry->_path);
+  os_unfair_lock_unlock(&_lock);
+  return (CGPathRef)CFAutorelease(result);
+}
+
+- (void)removeAllPaths {
+  os_unfair_lock_lock(&_lock);
+  [_entries removeAllObjects];
+  _head = nil;
+  _tail = nil;
+  os_unfair_lock_unlock(&_lock);
+}
+
+- (void)resetCounters {
+  os_unfair_lock_lock(&_lock);
+  _hitCount = 0;
+  _missCount = 0;
+  os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Recency list
+
+// The following methods must be called with _lock held.
+
+- (void)insertEntryAtHead:(MDCShapePathCacheEntry *)entry {
+  entry->_previous = nil;
+  entry->_next = _head;
+  if (_head) {
+    _head->_previous = entry;
+  }
+  _head = entry;
+  if (!_tail) {
+    _tail = entry;
+  }
+}
+
+- (void)removeEntryFromList:(MDCShapePathCacheEntry *)entry {
+  if (entry->_previous) {
+    entry->_previous->_next = entry->_next;
+  } else {
+    _head = entry->_next;
+  }
+  if (entry->_next) {
+    entry->_next->_previous = entry->_previous;
+  } else {
+    _tail = entry->_previous;
+  }
+  entry->_previous = nil;
+  entry->_next = nil;
+}
+
+- (void)moveEntryToHead:(MDCShapePathCacheEntry *)entry {
+  if (entry == _head) {
+    return;
+  }
+  // Keep the entry alive while it is briefly unlinked from the list.
+  MDCShapePathCacheEntry *strongEntry = entry;
+  [self removeEntryFromList:strongEntry];
+  [self insertEntryAtHead:strongEntry];
+}
+
+- (void)evictEntriesOverLimit {
+  while (_entries.count > _countLimit && _tail) {
+    MDCShapePathCacheEntry *evicted = _tail;
+    [self removeEntryFromList:evicted];
+    [_entries removeObjectForKey:evicted->_key];
+  }
+}
+
+@end
@@ -17,6 +17,7 @@
 #import "MDCPathGenerator.h"  // IWYU pragma: keep
 #import "MDCRectangleShapeGenerator.h"  // IWYU pragma: keep
 #import "MDCShapeGenerating.h"  // IWYU pragma: keep
+#import "MDCShapePathCache.h"  // IWYU pragma: keep
 #import "MDCShapeMediator.h"  // IWYU pragma: keep
 #import "MDCShapedShadowLayer.h"  // IWYU pragma: keep
 #import "MDCShapedView.h"  // IWYU pragma: keep
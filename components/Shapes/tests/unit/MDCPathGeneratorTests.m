@@ -0,0 +1,57 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapes.h"
+
+@interface MDCPathGeneratorTests : XCTestCase
+@end
+
+@implementation MDCPathGeneratorTests
+
+- (void)testAppendedPathMatchesEquivalentCGPathOperations {
+  // Given
+  MDCPathGenerator *generator = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointMake(0, 10)];
+  CGMutablePathRef expectedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(expectedPath, NULL, 0, 10);
+  CGMutablePathRef path = CGPathCreateMutable();
+  CGPathMoveToPoint(path, NULL, 0, 10);
+
+  // When
+  [generator addArcWithTangentPoint:CGPointZero toPoint:CGPointMake(10, 0) radius:10];
+  CGPathAddArcToPoint(expectedPath, NULL, 0, 0, 10, 0, 10);
+  [generator addLineToPoint:CGPointMake(20, 0)];
+  CGPathAddLineToPoint(expectedPath, NULL, 20, 0);
+  [generator addArcWithCenter:CGPointMake(20, 10) radius:10 startAngle:0 endAngle:1 clockwise:YES];
+  CGPathAddArc(expectedPath, NULL, 20, 10, 10, 0, 1, true);
+  [generator addCurveWithControlPoint1:CGPointMake(30, 30)
+                         controlPoint2:CGPointMake(40, 30)
+                               toPoint:CGPointMake(50, 20)];
+  CGPathAddCurveToPoint(expectedPath, NULL, 30, 30, 40, 30, 50, 20);
+  // Exceeds the inline command capacity.
+  [generator addQuadCurveWithControlPoint:CGPointMake(60, 10) toPoint:CGPointMake(70, 20)];
+  CGPathAddQuadCurveToPoint(expectedPath, NULL, 60, 10, 70, 20);
+  [generator addLineToPoint:CGPointMake(80, 20)];
+  CGPathAddLineToPoint(expectedPath, NULL, 80, 20);
+  [generator appendToCGPath:path transform:NULL];
+
+  // Then
+  XCTAssertTrue(CGPathEqualToPath(path, expectedPath));
+  XCTAssertTrue(CGPointEqualToPoint(generator.endPoint, CGPointMake(80, 20)));
+  CGPathRelease(path);
+  CGPathRelease(expectedPath);
+}
+
+@end
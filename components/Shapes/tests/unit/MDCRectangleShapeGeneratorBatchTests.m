@@ -0,0 +1,97 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapes.h"
+
+/** A shape generator that only implements the required MDCShapeGenerating method. */
+@interface FakeSingleSizeShapeGenerator : NSObject <MDCShapeGenerating>
+@end
+
+@implementation FakeSingleSizeShapeGenerator
+
+- (id)copyWithZone:(NSZone *)__unused zone {
+  return [[FakeSingleSizeShapeGenerator alloc] init];
+}
+
+- (CGPathRef)pathForSize:(CGSize)size {
+  if (CGSizeEqualToSize(size, CGSizeZero)) {
+    return NULL;
+  }
+  return [UIBezierPath bezierPathWithRect:(CGRect){CGPointZero, size}].CGPath;
+}
+
+@end
+
+@interface MDCRectangleShapeGeneratorBatchTests : XCTestCase
+@end
+
+@implementation MDCRectangleShapeGeneratorBatchTests
+
+- (NSArray<NSValue *> *)sizes {
+  return @[
+    [NSValue valueWithCGSize:CGSizeMake(100, 40)], [NSValue valueWithCGSize:CGSizeMake(32, 32)],
+    [NSValue valueWithCGSize:CGSizeZero], [NSValue valueWithCGSize:CGSizeMake(300, 12)]
+  ];
+}
+
+- (void)assertBatchPathsOfGenerator:(MDCRectangleShapeGenerator *)generator {
+  // When
+  NSArray *paths = [generator pathsForSizes:[self sizes]];
+
+  // Then
+  XCTAssertEqual(paths.count, [self sizes].count);
+  [[self sizes] enumerateObjectsUsingBlock:^(NSValue *size, NSUInteger idx, BOOL *stop) {
+    CGPathRef expectedPath = [generator pathForSize:size.CGSizeValue];
+    XCTAssertTrue(CGPathEqualToPath((__bridge CGPathRef)paths[idx], expectedPath), @"%@", size);
+  }];
+}
+
+- (void)testBatchPathsMatchSingleSizePaths {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  MDCCornerTreatment *percentageCorner = [[MDCCornerTreatment alloc] init];
+  percentageCorner.valueType = MDCCornerTreatmentValueTypePercentage;
+  generator.bottomRightCorner = percentageCorner;
+
+  // Then
+  [self assertBatchPathsOfGenerator:generator];
+}
+
+- (void)testBatchPathsMatchSingleSizePathsWithCornerOffsets {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  generator.topLeftCornerOffset = CGPointMake(8, 0);
+  generator.bottomRightCornerOffset = CGPointMake(-8, 0);
+
+  // Then
+  [self assertBatchPathsOfGenerator:generator];
+}
+
+- (void)testFallbackUsesSingleSizePaths {
+  // Given
+  FakeSingleSizeShapeGenerator *generator = [[FakeSingleSizeShapeGenerator alloc] init];
+
+  // When
+  NSArray *paths = MDCShapeGeneratorPathsForSizes(generator, [self sizes]);
+
+  // Then
+  XCTAssertEqual(paths.count, [self sizes].count);
+  XCTAssertEqualObjects(paths[2], [NSNull null]);
+  XCTAssertTrue(CGPathEqualToPath((__bridge CGPathRef)paths[1],
+                                  [generator pathForSize:CGSizeMake(32, 32)]));
+}
+
+@end
@@ -0,0 +1,191 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapes.h"
+
+/** An edge treatment with state that it does not compare in -isEqual:. */
+@interface FakeNotchEdgeTreatment : MDCEdgeTreatment
+@property(nonatomic, assign) CGFloat depth;
+@end
+
+@implementation FakeNotchEdgeTreatment
+
+- (MDCPathGenerator *)pathGeneratorForEdgeWithLength:(CGFloat)length {
+  MDCPathGenerator *path = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointZero];
+  [path addLineToPoint:CGPointMake(length / 2, self.depth)];
+  [path addLineToPoint:CGPointMake(length, 0)];
+  return path;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  FakeNotchEdgeTreatment *copy = [super copyWithZone:zone];
+  copy.depth = self.depth;
+  return copy;
+}
+
+@end
+
+@interface MDCShapePathCacheTests : XCTestCase
+@end
+
+@implementation MDCShapePathCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  [MDCShapePathCache.sharedCache removeAllPaths];
+  [MDCShapePathCache.sharedCache resetCounters];
+}
+
+- (void)tearDown {
+  [MDCShapePathCache.sharedCache removeAllPaths];
+  [MDCShapePathCache.sharedCache resetCounters];
+
+  [super tearDown];
+}
+
+- (void)testCacheEvictsLeastRecentlyUsedPath {
+  // Given
+  MDCShapePathCache *cache = [[MDCShapePathCache alloc] initWithCountLimit:2];
+  UIBezierPath *path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 10, 10)];
+
+  // When
+  [cache setPath:path.CGPath forKey:@"a"];
+  [cache setPath:path.CGPath forKey:@"b"];
+  [cache pathForKey:@"a"];
+  [cache setPath:path.CGPath forKey:@"c"];
+
+  // Then
+  XCTAssertEqual(cache.count, 2U);
+  XCTAssertTrue([cache pathForKey:@"a"] != NULL);
+  XCTAssertTrue([cache pathForKey:@"b"] == NULL);
+  XCTAssertTrue([cache pathForKey:@"c"] != NULL);
+  XCTAssertEqual(cache.hitCount, 3U);
+  XCTAssertEqual(cache.missCount, 1U);
+}
+
+- (void)testGeneratorWithoutCachingDoesNotTouchCache {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+
+  // When
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 0U);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.missCount, 0U);
+}
+
+- (void)testEqualGeneratorsShareCachedPath {
+  // Given
+  MDCRectangleShapeGenerator *generator1 = [[MDCRectangleShapeGenerator alloc] init];
+  generator1.cachesGeneratedPaths = YES;
+  generator1.topLeftCornerOffset = CGPointMake(2, 2);
+  MDCRectangleShapeGenerator *generator2 = [generator1 copy];
+  generator2.topLeftCornerOffset = CGPointMake(2, 2);
+
+  // When
+  CGPathRef path1 = [generator1 pathForSize:CGSizeMake(100, 50)];
+  CGPathRef path2 = [generator2 pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertTrue(path1 == path2);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 1U);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.missCount, 1U);
+}
+
+- (void)testCachedPathMatchesUncachedPath {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  generator.bottomRightCornerOffset = CGPointMake(-4, 3);
+
+  // When
+  CGPathRef uncachedPath = CGPathRetain([generator pathForSize:CGSizeMake(80, 40)]);
+  generator.cachesGeneratedPaths = YES;
+  [generator pathForSize:CGSizeMake(80, 40)];
+  CGPathRef cachedPath = [generator pathForSize:CGSizeMake(80, 40)];
+
+  // Then
+  XCTAssertTrue(CGPathEqualToPath(uncachedPath, cachedPath));
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 1U);
+  CGPathRelease(uncachedPath);
+}
+
+- (void)testChangingTreatmentMissesCache {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  generator.cachesGeneratedPaths = YES;
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  generator.topLeftCorner.valueType = MDCCornerTreatmentValueTypePercentage;
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 0U);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.missCount, 2U);
+}
+
+- (void)testEdgeTreatmentsUseIdentityEquality {
+  // Given
+  MDCEdgeTreatment *edge1 = [[MDCEdgeTreatment alloc] init];
+  MDCEdgeTreatment *edge2 = [[MDCEdgeTreatment alloc] init];
+
+  // Then
+  XCTAssertNotEqualObjects(edge1, edge2);
+  XCTAssertEqualObjects(edge1, edge1);
+}
+
+- (void)testTreatmentWithoutValueEqualityIsNotCached {
+  // Given
+  FakeNotchEdgeTreatment *shallowEdge = [[FakeNotchEdgeTreatment alloc] init];
+  shallowEdge.depth = 2;
+  FakeNotchEdgeTreatment *deepEdge = [[FakeNotchEdgeTreatment alloc] init];
+  deepEdge.depth = 8;
+  MDCRectangleShapeGenerator *shallowGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  shallowGenerator.cachesGeneratedPaths = YES;
+  shallowGenerator.topEdge = shallowEdge;
+  MDCRectangleShapeGenerator *deepGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  deepGenerator.cachesGeneratedPaths = YES;
+  deepGenerator.topEdge = deepEdge;
+
+  // When
+  CGPathRef shallowPath = [shallowGenerator pathForSize:CGSizeMake(100, 50)];
+  CGPathRef deepPath = [deepGenerator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertFalse(CGPathEqualToPath(shallowPath, deepPath));
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 0U);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.missCount, 0U);
+}
+
+- (void)testDefaultEdgesOfDifferentGeneratorsShareCachedPath {
+  // Given
+  MDCRectangleShapeGenerator *generator1 = [[MDCRectangleShapeGenerator alloc] init];
+  generator1.cachesGeneratedPaths = YES;
+  MDCRectangleShapeGenerator *generator2 = [[MDCRectangleShapeGenerator alloc] init];
+  generator2.cachesGeneratedPaths = YES;
+
+  // When
+  CGPathRef path1 = [generator1 pathForSize:CGSizeMake(100, 50)];
+  CGPathRef path2 = [generator2 pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertTrue(path1 == path2);
+  XCTAssertEqual(MDCShapePathCache.sharedCache.hitCount, 1U);
+}
+
+@end
@@ -805,24 +805,19 @@ static const CGFloat kMaximumHeightLegacy = 80;
                             duration:(NSTimeInterval)duration
                                curve:(UIViewAnimationCurve)curve
                       timingFunction:(CAMediaTimingFunction *)timingFunction {
-  NSMutableDictionary *userInfo = [NSMutableDictionary dictionaryWithDictionary:@{
-    MDCOverlayIdentifierKey : MDCSnackbarOverlayIdentifier,
-    MDCOverlayFrameKey : [NSValue valueWithCGRect:frame],
-    MDCOverlayTransitionDurationKey : @(duration),
-  }];
-
-  if (duration > 0) {
-    if (timingFunction != nil) {
-      userInfo[MDCOverlayTransitionTimingFunctionKey] = timingFunction;
-    } else {
-      userInfo[MDCOverlayTransitionCurveKey] = @(curve);
-    }
-  }
+  MDCOverlayFrameChange change = {
+      .frame = frame,
+      .specifiesAnimation = YES,
+      .duration = duration,
+      .curve = curve,
+      .runsImmediately = NO,
+  };
 
   // Notify the overlay system that a change is happening
-  [[NSNotificationCenter defaultCenter] postNotificationName:MDCOverlayDidChangeNotification
-                                                      object:nil
-                                                    userInfo:userInfo];
+  MDCOverlayObserver *overlayObserver = [MDCOverlayObserver observerForScreen:nil];
+  [overlayObserver applyFrameChange:change
+            toOverlayWithIdentifier:MDCSnackbarOverlayIdentifier
+                     timingFunction:duration > 0 ? timingFunction : nil];
 }
 
 #pragma mark - UIAccessibilityAction
@@ -22,6 +22,7 @@
 #import "MDCTabBarItemCustomViewing.h"
 #import "MDCTabBarViewCustomViewable.h"
 #import "MDCTabBarViewDelegate.h"
+#import "MDCTabBarItemObserver.h"
 #import "MDCTabBarViewIndicatorTemplate.h"
 #import "MDCTabBarViewUnderlineIndicatorTemplate.h"
 
@@ -29,9 +30,6 @@
 #import <QuartzCore/QuartzCore.h>
 #import "MaterialAnimationTiming.h"  // ComponentImport
 
-// KVO contexts
-static char *const kKVOContextMDCTabBarView = "kKVOContextMDCTabBarView";
-
 /** Minimum (typical) height of a Material Tab bar. */
 static const CGFloat kMinHeight = 48;
 
@@ -62,16 +60,6 @@ static const CGFloat kBottomDividerHeight = 1;
 /// Default duration in seconds for selection change animations.
 static const NSTimeInterval kSelectionChangeAnimationDuration = 0.3;
 
-static NSString *const kSelectedImageKeyPath = @"selectedImage";
-static NSString *const kImageKeyPath = @"image";
-static NSString *const kTitleKeyPath = @"title";
-static NSString *const kAccessibilityLabelKeyPath = @"accessibilityLabel";
-static NSString *const kAccessibilityHintKeyPath = @"accessibilityHint";
-static NSString *const kAccessibilityIdentifierKeyPath = @"accessibilityIdentifier";
-static NSString *const kAccessibilityTraitsKeyPath = @"accessibilityTraits";
-static NSString *const kTitlePositionAdjustment = @"titlePositionAdjustment";
-static NSString *const kLargeContentSizeImage = @"largeContentSizeImage";
-static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageInsets";
 
 #ifdef __IPHONE_13_4
 @interface MDCTabBarView (PointerInteractions) <UIPointerInteractionDelegate,
@@ -115,6 +103,12 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
 
 @property(nonatomic) BOOL useDefaultItemViewContentInsets;
 
+/** Observes the properties of @c items and applies their changes to @c itemViews. */
+@property(nonnull, nonatomic, strong) MDCTabBarItemObserver *itemObserver;
+
+/** Whether an item view's content size changed since @c itemObserver last flushed. */
+@property(nonatomic, assign) BOOL itemViewContentSizeChanged;
+
 #if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
 /**
  The last large content viewer item displayed by the content viewer while the interaction is
@@ -163,6 +157,20 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
       [NSValue valueWithUIEdgeInsets:UIEdgeInsetsMake(0, kScrollableTabsLeadingEdgeInset, 0, 0)];
   _minItemWidth = kDefaultMinItemWidth;
   _useDefaultItemViewContentInsets = YES;
+  _itemObserver = [[MDCTabBarItemObserver alloc]
+         initWithOwner:self
+      propertyHandlers:[MDCTabBarView itemPropertyHandlers]
+          flushHandler:^(id owner) {
+            // Item views invalidate themselves as they change; the bar only needs to do so once,
+            // and only if a change could have resized an item view.
+            MDCTabBarView *tabBarView = (MDCTabBarView *)owner;
+            if (!tabBarView.itemViewContentSizeChanged) {
+              return;
+            }
+            tabBarView.itemViewContentSizeChanged = NO;
+            [tabBarView invalidateIntrinsicContentSize];
+            [tabBarView setNeedsLayout];
+          }];
   self.backgroundColor = UIColor.whiteColor;
   self.showsHorizontalScrollIndicator = NO;
 
@@ -202,10 +210,6 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
 #endif  // defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
 }
 
-- (void)dealloc {
-  [self removeObserversFromTabBarItems];
-}
-
 #pragma mark - Properties
 
 - (void)setBarTintColor:(UIColor *)barTintColor {
@@ -262,7 +266,6 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
     return;
   }
 
-  [self removeObserversFromTabBarItems];
   for (UIView *view in self.itemViews) {
     [view removeFromSuperview];
   }
@@ -336,7 +339,7 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
   _needsScrollToSelectedItem = YES;
 
   [self setSelectedItem:newSelectedItem animated:NO];
-  [self addObserversToTabBarItems];
+  self.itemObserver.items = self.items;
   [self updateTitleFontForAllViews];
 
   [self invalidateIntrinsicContentSize];
@@ -601,144 +604,106 @@ static NSString *const kLargeContentSizeImageInsets = @"largeContentSizeImageIns
 
 #pragma mark - Key-Value Observing (KVO)
 
-- (void)addObserversToTabBarItems {
-  for (UITabBarItem *item in self.items) {
-    [item addObserver:self
-           forKeyPath:kImageKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kSelectedImageKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kTitleKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kAccessibilityLabelKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kAccessibilityHintKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kAccessibilityIdentifierKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kAccessibilityTraitsKeyPath
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kTitlePositionAdjustment
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kLargeContentSizeImage
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-    [item addObserver:self
-           forKeyPath:kLargeContentSizeImageInsets
-              options:NSKeyValueObservingOptionNew
-              context:kKVOContextMDCTabBarView];
-  }
-}
-
-- (void)removeObserversFromTabBarItems {
-  for (UITabBarItem *item in self.items) {
-    [item removeObserver:self forKeyPath:kImageKeyPath context:kKVOContextMDCTabBarView];
-    [item removeObserver:self forKeyPath:kSelectedImageKeyPath context:kKVOContextMDCTabBarView];
-    [item removeObserver:self forKeyPath:kTitleKeyPath context:kKVOContextMDCTabBarView];
-    [item removeObserver:self
-              forKeyPath:kAccessibilityLabelKeyPath
-                 context:kKVOContextMDCTabBarView];
-    [item removeObserver:self
-              forKeyPath:kAccessibilityHintKeyPath
-                 context:kKVOContextMDCTabBarView];
-    [item removeObserver:self
-              forKeyPath:kAccessibilityIdentifierKeyPath
-                 context:kKVOContextMDCTabBarView];
-    [item removeObserver:self
-              forKeyPath:kAccessibilityTraitsKeyPath
-                 context:kKVOContextMDCTabBarView];
-    [item removeObserver:self forKeyPath:kTitlePositionAdjustment context:kKVOContextMDCTabBarView];
-    [item removeObserver:self forKeyPath:kLargeContentSizeImage context:kKVOContextMDCTabBarView];
-    [item removeObserver:self
-              forKeyPath:kLargeContentSizeImageInsets
-                 context:kKVOContextMDCTabBarView];
-  }
-}
-
-- (void)observeValueForKeyPath:(NSString *)keyPath
-                      ofObject:(id)object
-                        change:(NSDictionary<NSKeyValueChangeKey, id> *)change
-                       context:(void *)context {
-  if (context == kKVOContextMDCTabBarView) {
-    if (!object) {
-      return;
-    }
-    NSUInteger indexOfObject = [self.items indexOfObject:object];
-    if (indexOfObject == NSNotFound) {
-      return;
-    }
-    // Don't try to update custom views
-    UIView *updatedItemView = self.itemViews[indexOfObject];
-    if (![updatedItemView isKindOfClass:[MDCTabBarViewItemView class]]) {
-      return;
-    }
-    MDCTabBarViewItemView *tabBarItemView = (MDCTabBarViewItemView *)updatedItemView;
-    id newValue = [object valueForKey:keyPath];
-    if (newValue == [NSNull null]) {
-      newValue = nil;
-    }
-    if ([keyPath isEqualToString:kImageKeyPath]) {
-      tabBarItemView.image = newValue;
-      [self markIntrinsicContentSizeAndLayoutNeedingUpdateForSelfAndItemView:tabBarItemView];
-    } else if ([keyPath isEqualToString:kSelectedImageKeyPath]) {
-      tabBarItemView.selectedImage = newValue;
-      [self markIntrinsicContentSizeAndLayoutNeedingUpdateForSelfAndItemView:tabBarItemView];
-    } else if ([keyPath isEqualToString:kTitleKeyPath]) {
-      tabBarItemView.titleLabel.text = newValue;
-      [self markIntrinsicContentSizeAndLayoutNeedingUpdateForSelfAndItemView:tabBarItemView];
-    } else if ([keyPath isEqualToString:kAccessibilityLabelKeyPath]) {
-      tabBarItemView.accessibilityLabel = newValue;
-    } else if ([keyPath isEqualToString:kAccessibilityHintKeyPath]) {
-      tabBarItemView.accessibilityHint = newValue;
-    } else if ([keyPath isEqualToString:kAccessibilityIdentifierKeyPath]) {
-      tabBarItemView.accessibilityIdentifier = newValue;
-    } else if ([keyPath isEqualToString:kAccessibilityTraitsKeyPath]) {
-      tabBarItemView.accessibilityTraits = [change[NSKeyValueChangeNewKey] unsignedLongLongValue];
-      if (tabBarItemView.accessibilityTraits == UIAccessibilityTraitNone) {
-        tabBarItemView.accessibilityTraits = UIAccessibilityTraitButton;
-      }
-      if (object == self.selectedItem) {
-        tabBarItemView.accessibilityTraits =
-            (tabBarItemView.accessibilityTraits | UIAccessibilityTraitSelected);
-      }
-#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
-    } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(largeContentSizeImage))]) {
-      if (@available(iOS 13.0, *)) {
-        tabBarItemView.largeContentImage = newValue;
-      }
-    } else if ([keyPath
-                   isEqualToString:NSStringFromSelector(@selector(largeContentSizeImageInsets))]) {
-      if (@available(iOS 13.0, *)) {
-        tabBarItemView.largeContentImageInsets = [newValue UIEdgeInsetsValue];
-      }
-    }
-#endif  // defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
-  } else {
-    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+/**
+ Returns the view of the item at @c itemIndex, or nil if it is a custom view, which is never updated
+ from its item.
+ */
+static MDCTabBarViewItemView *_Nullable MDCTabBarViewItemViewAtIndex(MDCTabBarView *tabBarView,
+                                                                     NSUInteger itemIndex) {
+  NSArray<UIView *> *itemViews = tabBarView.itemViews;
+  if (itemIndex >= itemViews.count) {
+    return nil;
+  }
+  UIView *itemView = itemViews[itemIndex];
+  if (![itemView isKindOfClass:[MDCTabBarViewItemView class]]) {
+    return nil;
   }
+  return (MDCTabBarViewItemView *)itemView;
 }
 
-- (void)markIntrinsicContentSizeAndLayoutNeedingUpdateForSelfAndItemView:(UIView *)itemView {
+/** Invalidates an item view whose content size changed. The bar itself is invalidated on flush. */
+static void MDCTabBarViewMarkItemViewNeedingUpdate(MDCTabBarView *tabBarView,
+                                                   UIView *_Nullable itemView) {
+  if (!itemView) {
+    return;
+  }
   [itemView invalidateIntrinsicContentSize];
   [itemView setNeedsLayout];
-  [self invalidateIntrinsicContentSize];
-  [self setNeedsLayout];
+  tabBarView.itemViewContentSizeChanged = YES;
+}
+
+/** Maps each observed UITabBarItem key path to the item view property it updates. */
++ (NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *)itemPropertyHandlers {
+  static NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *handlers;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    NSMutableDictionary<NSString *, MDCTabBarItemPropertyHandler> *mutableHandlers =
+        [NSMutableDictionary dictionary];
+    mutableHandlers[NSStringFromSelector(@selector(image))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemView *itemView = MDCTabBarViewItemViewAtIndex(owner, itemIndex);
+          itemView.image = item.image;
+          MDCTabBarViewMarkItemViewNeedingUpdate(owner, itemView);
+        };
+    mutableHandlers[NSStringFromSelector(@selector(selectedImage))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemView *itemView = MDCTabBarViewItemViewAtIndex(owner, itemIndex);
+          itemView.selectedImage = item.selectedImage;
+          MDCTabBarViewMarkItemViewNeedingUpdate(owner, itemView);
+        };
+    mutableHandlers[NSStringFromSelector(@selector(title))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemView *itemView = MDCTabBarViewItemViewAtIndex(owner, itemIndex);
+          itemView.titleLabel.text = item.title;
+          MDCTabBarViewMarkItemViewNeedingUpdate(owner, itemView);
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityLabel))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemViewAtIndex(owner, itemIndex).accessibilityLabel =
+              item.accessibilityLabel;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityHint))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemViewAtIndex(owner, itemIndex).accessibilityHint = item.accessibilityHint;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityIdentifier))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarViewItemViewAtIndex(owner, itemIndex).accessibilityIdentifier =
+              item.accessibilityIdentifier;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(accessibilityTraits))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          MDCTabBarView *tabBarView = (MDCTabBarView *)owner;
+          MDCTabBarViewItemView *itemView = MDCTabBarViewItemViewAtIndex(tabBarView, itemIndex);
+          UIAccessibilityTraits traits = item.accessibilityTraits == UIAccessibilityTraitNone
+                                             ? UIAccessibilityTraitButton
+                                             : item.accessibilityTraits;
+          if (item == tabBarView.selectedItem) {
+            traits |= UIAccessibilityTraitSelected;
+          }
+          itemView.accessibilityTraits = traits;
+        };
+    mutableHandlers[NSStringFromSelector(@selector(largeContentSizeImage))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+          if (@available(iOS 13.0, *)) {
+            MDCTabBarViewItemViewAtIndex(owner, itemIndex).largeContentImage =
+                item.largeContentSizeImage;
+          }
+#endif  // defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+        };
+    mutableHandlers[NSStringFromSelector(@selector(largeContentSizeImageInsets))] =
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+          if (@available(iOS 13.0, *)) {
+            MDCTabBarViewItemViewAtIndex(owner, itemIndex).largeContentImageInsets =
+                item.largeContentSizeImageInsets;
+          }
+#endif  // defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+        };
+    handlers = [mutableHandlers copy];
+  });
+  return handlers;
 }
 
 #pragma mark - UIView
@@ -26,6 +26,7 @@
 #import "MDCItemBarStyle.h"
 #import "MDCTabBarIndicatorView.h"
 #import "MDCTabBarPrivateIndicatorContext.h"
+#import "MDCTabBarItemObserver.h"
 
 /// Cell reuse identifier for item bar cells.
 static NSString *const kItemReuseID = @"MDCItem";
@@ -42,9 +43,6 @@ static const CGFloat kRegularInset = 56;
 /// Horizontal insets in compact size class layouts.
 static const CGFloat kCompactInset = 8;
 
-/// KVO context pointer identifying changes in MDCItemBarItem properties.
-static void *kItemPropertyContext = &kItemPropertyContext;
-
 /// Custom flow layout for item content. Selectively works around bugs with RTL and flow layout:
 /// Radar 22828797: "UICollectionView with variable-sized items does not reverse item order in RTL."
 /// - On iOS 9.0 and later when a UICollectionViewFlow layout has custom-sized items via
@@ -70,6 +68,8 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 @property(nonatomic, strong, nullable) MDCItemBarStyle *style;
 // Collection view for items.
 @property(nonatomic, strong, nullable) UICollectionView *collectionView;
+// Observes the properties of items and reconfigures their cells.
+@property(nonatomic, strong, nonnull) MDCTabBarItemObserver *itemObserver;
 
 @end
 
@@ -147,9 +147,6 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 }
 
 - (void)dealloc {
-  // Clear out item observations.
-  [self stopObservingItems];
-
   _collectionView.delegate = nil;
 }
 
@@ -174,11 +171,11 @@ static void *kItemPropertyContext = &kItemPropertyContext;
   NSParameterAssert(items != nil);
 
   if (_items != items && ![_items isEqual:items]) {
-    // Stop observing old items.
-    [self stopObservingItems];
-
     _items = [items copy];
 
+    // Observe the new items for changes, and stop observing the old ones.
+    self.itemObserver.items = _items;
+
     // Determine new selected item, defaulting to the first item.
     UITabBarItem *newSelectedItem = _items.firstObject;
     if (_selectedItem && [_items containsObject:_selectedItem]) {
@@ -194,9 +191,6 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 
     // Select tab for current item.
     [self selectItemAtIndex:[self indexForItem:_selectedItem] animated:NO];
-
-    // Start observing new items for changes.
-    [self startObservingItems];
   }
 }
 
@@ -250,36 +244,6 @@ static void *kItemPropertyContext = &kItemPropertyContext;
   return nil;
 }
 
-#pragma mark - NSObject
-
-- (void)observeValueForKeyPath:(NSString *)keyPath
-                      ofObject:(id)object
-                        change:(NSDictionary *)change
-                       context:(void *)context {
-  if (context == kItemPropertyContext) {
-    // MDCItemBarItem change, must be on the main thread.
-    NSAssert([NSThread isMainThread], @"Item bar items may only be updated on the main thread.");
-    NSAssert([object isKindOfClass:[UITabBarItem class]], @"Change in unexpected object type");
-
-    UITabBarItem *item = object;
-    NSInteger itemIndex = [_items indexOfObject:item];
-    NSAssert(itemIndex != NSNotFound, @"Inconsistency: Change in unowned item bar item.");
-
-    // Update the cell for the given item if it's visible.
-    if (itemIndex != NSNotFound) {
-      NSIndexPath *indexPath = [self indexPathForItemAtIndex:itemIndex];
-      UICollectionViewCell *cell = [_collectionView cellForItemAtIndexPath:indexPath];
-      if (cell) {
-        NSAssert([cell isKindOfClass:[MDCItemBarCell class]], @"All cells must be MDCItemBarCell");
-        MDCItemBarCell *itemCell = (MDCItemBarCell *)cell;
-        [itemCell updateWithItem:item atIndex:itemIndex count:_items.count];
-      }
-    }
-  } else {
-    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
-  }
-}
-
 #pragma mark - UIView
 
 - (void)layoutSubviews {
@@ -482,12 +446,19 @@ static void *kItemPropertyContext = &kItemPropertyContext;
   return CGRectGetWidth(_collectionView.bounds);
 }
 
-+ (NSArray *)observableItemKeys {
+/**
+ Maps each observed UITabBarItem key path to its handler. Cells show every observed property, so a
+ change to any of them reconfigures the item's cell if it is visible.
+ */
++ (NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *)itemPropertyHandlers {
   static dispatch_once_t onceToken;
-  static NSArray *s_keys = nil;
-  // clang-format off
+  static NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *s_handlers = nil;
   dispatch_once(&onceToken, ^{
-    s_keys = @[
+    MDCTabBarItemPropertyHandler updateCell = ^(id owner, UITabBarItem *item,
+                                                NSUInteger itemIndex) {
+      [(MDCItemBar *)owner updateVisibleCellWithItem:item atIndex:itemIndex];
+    };
+    NSArray<NSString *> *keys = @[
       NSStringFromSelector(@selector(title)),
       NSStringFromSelector(@selector(image)),
       NSStringFromSelector(@selector(selectedImage)),
@@ -496,28 +467,37 @@ static void *kItemPropertyContext = &kItemPropertyContext;
       NSStringFromSelector(@selector(accessibilityIdentifier)),
       NSStringFromSelector(@selector(accessibilityLabel))
     ];
+    NSMutableDictionary<NSString *, MDCTabBarItemPropertyHandler> *handlers =
+        [NSMutableDictionary dictionary];
+    for (NSString *key in keys) {
+      handlers[key] = updateCell;
+    }
+    s_handlers = [handlers copy];
   });
-  // clang-format on
-  return s_keys;
+  return s_handlers;
 }
 
-- (void)startObservingItems {
-  NSAssert([NSThread isMainThread], @"Main thread required for KVO registration");
-
-  for (UITabBarItem *item in _items) {
-    for (NSString *key in [[self class] observableItemKeys]) {
-      [item addObserver:self forKeyPath:key options:0 context:kItemPropertyContext];
-    }
+- (MDCTabBarItemObserver *)itemObserver {
+  if (!_itemObserver) {
+    _itemObserver =
+        [[MDCTabBarItemObserver alloc] initWithOwner:self
+                                    propertyHandlers:[[self class] itemPropertyHandlers]
+                                        flushHandler:nil];
   }
+  return _itemObserver;
 }
 
-- (void)stopObservingItems {
-  NSAssert([NSThread isMainThread], @"Main thread required for KVO unregistration");
+- (void)updateVisibleCellWithItem:(UITabBarItem *)item atIndex:(NSUInteger)itemIndex {
+  // MDCItemBarItem change, must be on the main thread.
+  NSAssert([NSThread isMainThread], @"Item bar items may only be updated on the main thread.");
 
-  for (UITabBarItem *item in _items) {
-    for (NSString *key in [[self class] observableItemKeys]) {
-      [item removeObserver:self forKeyPath:key context:kItemPropertyContext];
-    }
+  // Update the cell for the given item if it's visible.
+  NSIndexPath *indexPath = [self indexPathForItemAtIndex:itemIndex];
+  UICollectionViewCell *cell = [_collectionView cellForItemAtIndexPath:indexPath];
+  if (cell) {
+    NSAssert([cell isKindOfClass:[MDCItemBarCell class]], @"All cells must be MDCItemBarCell");
+    MDCItemBarCell *itemCell = (MDCItemBarCell *)cell;
+    [itemCell updateWithItem:item atIndex:itemIndex count:_items.count];
   }
 }
 
@@ -554,7 +534,7 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 
 - (NSInteger)indexForItem:(nullable UITabBarItem *)item {
   if (item) {
-    return [_items indexOfObject:item];
+    return [self.itemObserver indexOfItem:item];
   }
   return NSNotFound;
 }
@@ -93,6 +93,7 @@ static UIImage *fakeImage(CGSize size) {
 @interface MDCTabBarView (UnitTestingExposesPrivateMethods)
 @property(nonnull, nonatomic, copy) NSArray<UIView *> *itemViews;
 @property(nonatomic, assign) BOOL needsScrollToSelectedItem;
+@property(nonatomic, assign) BOOL itemViewContentSizeChanged;
 - (void)didTapItemView:(UITapGestureRecognizer *)tap;
 @end
 
@@ -1202,6 +1203,28 @@ static UIImage *fakeImage(CGSize size) {
   XCTAssertNoThrow([self.tabBarView layoutIfNeeded]);
 }
 
+- (void)testTitleChangeInvalidatesItemContentSize {
+  // Given
+  self.tabBarView.items = @[ self.itemA ];
+
+  // When
+  self.itemA.title = @"Changed";
+
+  // Then
+  XCTAssertTrue(self.tabBarView.itemViewContentSizeChanged);
+}
+
+- (void)testAccessibilityLabelChangeDoesNotInvalidateItemContentSize {
+  // Given
+  self.tabBarView.items = @[ self.itemA ];
+
+  // When
+  self.itemA.accessibilityLabel = @"Changed";
+
+  // Then
+  XCTAssertFalse(self.tabBarView.itemViewContentSizeChanged);
+}
+
 #pragma mark - UIAccessibility
 
 - (void)testTabBarViewNotAccessibilityElement {
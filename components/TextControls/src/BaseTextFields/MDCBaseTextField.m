@@ -26,11 +26,118 @@
 
 static char *const kKVOContextMDCBaseTextField = "kKVOContextMDCBaseTextField";
 
+static BOOL MDCBaseTextFieldObjectsEqual(id lhs, id rhs) {
+  return lhs == rhs || [lhs isEqual:rhs];
+}
+
+/**
+ A snapshot of everything @c MDCBaseTextFieldLayout reads when it is calculated. Two snapshots that
+ are equal produce identical layouts, so a layout can be reused for as long as the snapshot taken
+ for the next request equals the one it was calculated from.
+
+ The text only contributes whether it is empty, since that is all the layout reads from it. Labels
+ contribute their attributed text, which carries any per-range fonts, as well as their own font.
+ Side views and the container style are compared by identity, with the side views' sizes captured
+ separately.
+ */
+@interface MDCBaseTextFieldLayoutInputs : NSObject
+@property(nonatomic, assign) CGFloat width;
+@property(nonatomic, strong) id<MDCTextControlStyle> containerStyle;
+@property(nonatomic, strong) UIFont *normalFont;
+@property(nonatomic, strong) UIFont *floatingFont;
+@property(nonatomic, assign) BOOL hasText;
+@property(nonatomic, copy) NSAttributedString *labelAttributedText;
+@property(nonatomic, assign) MDCTextControlLabelPosition labelPosition;
+@property(nonatomic, assign) MDCTextControlLabelBehavior labelBehavior;
+@property(nonatomic, assign) MDCTextControlTextFieldSideViewAlignment sideViewAlignment;
+@property(nonatomic, strong) UIView *leadingView;
+@property(nonatomic, assign) CGSize leadingViewSize;
+@property(nonatomic, assign) UITextFieldViewMode leadingViewMode;
+@property(nonatomic, strong) UIView *trailingView;
+@property(nonatomic, assign) CGSize trailingViewSize;
+@property(nonatomic, assign) UITextFieldViewMode trailingViewMode;
+@property(nonatomic, assign) CGFloat clearButtonSideLength;
+@property(nonatomic, assign) UITextFieldViewMode clearButtonMode;
+@property(nonatomic, copy) NSAttributedString *leadingAssistiveLabelAttributedText;
+@property(nonatomic, strong) UIFont *leadingAssistiveLabelFont;
+@property(nonatomic, assign) NSInteger leadingAssistiveLabelNumberOfLines;
+@property(nonatomic, assign) BOOL leadingAssistiveLabelHidden;
+@property(nonatomic, copy) NSAttributedString *trailingAssistiveLabelAttributedText;
+@property(nonatomic, strong) UIFont *trailingAssistiveLabelFont;
+@property(nonatomic, assign) NSInteger trailingAssistiveLabelNumberOfLines;
+@property(nonatomic, assign) BOOL trailingAssistiveLabelHidden;
+@property(nonatomic, assign) MDCTextControlAssistiveLabelDrawPriority assistiveLabelDrawPriority;
+@property(nonatomic, assign) CGFloat customAssistiveLabelDrawPriority;
+@property(nonatomic, assign) CGFloat verticalDensity;
+@property(nonatomic, assign) CGFloat preferredContainerHeight;
+@property(nonatomic, assign) CGFloat numberOfLinesOfVisibleText;
+@property(nonatomic, strong) NSNumber *leadingEdgePaddingOverride;
+@property(nonatomic, strong) NSNumber *trailingEdgePaddingOverride;
+@property(nonatomic, strong) NSNumber *horizontalInterItemSpacingOverride;
+@property(nonatomic, assign) BOOL isRTL;
+@property(nonatomic, assign) BOOL isEditing;
+@end
+
+@implementation MDCBaseTextFieldLayoutInputs
+
+- (BOOL)isEqualToLayoutInputs:(MDCBaseTextFieldLayoutInputs *)other {
+  // Scalars are compared first so that the common mismatches (width, editing, label position) are
+  // found before any string or font comparison.
+  return self.width == other.width && self.hasText == other.hasText &&
+         self.labelPosition == other.labelPosition &&
+         self.labelBehavior == other.labelBehavior &&
+         self.sideViewAlignment == other.sideViewAlignment &&
+         self.leadingView == other.leadingView &&
+         CGSizeEqualToSize(self.leadingViewSize, other.leadingViewSize) &&
+         self.leadingViewMode == other.leadingViewMode && self.trailingView == other.trailingView &&
+         CGSizeEqualToSize(self.trailingViewSize, other.trailingViewSize) &&
+         self.trailingViewMode == other.trailingViewMode &&
+         self.clearButtonSideLength == other.clearButtonSideLength &&
+         self.clearButtonMode == other.clearButtonMode &&
+         self.leadingAssistiveLabelNumberOfLines == other.leadingAssistiveLabelNumberOfLines &&
+         self.leadingAssistiveLabelHidden == other.leadingAssistiveLabelHidden &&
+         self.trailingAssistiveLabelNumberOfLines == other.trailingAssistiveLabelNumberOfLines &&
+         self.trailingAssistiveLabelHidden == other.trailingAssistiveLabelHidden &&
+         self.assistiveLabelDrawPriority == other.assistiveLabelDrawPriority &&
+         self.customAssistiveLabelDrawPriority == other.customAssistiveLabelDrawPriority &&
+         self.verticalDensity == other.verticalDensity &&
+         self.preferredContainerHeight == other.preferredContainerHeight &&
+         self.numberOfLinesOfVisibleText == other.numberOfLinesOfVisibleText &&
+         self.isRTL == other.isRTL && self.isEditing == other.isEditing &&
+         self.containerStyle == other.containerStyle &&
+         MDCBaseTextFieldObjectsEqual(self.leadingEdgePaddingOverride,
+                                      other.leadingEdgePaddingOverride) &&
+         MDCBaseTextFieldObjectsEqual(self.trailingEdgePaddingOverride,
+                                      other.trailingEdgePaddingOverride) &&
+         MDCBaseTextFieldObjectsEqual(self.horizontalInterItemSpacingOverride,
+                                      other.horizontalInterItemSpacingOverride) &&
+         MDCBaseTextFieldObjectsEqual(self.normalFont, other.normalFont) &&
+         MDCBaseTextFieldObjectsEqual(self.floatingFont, other.floatingFont) &&
+         MDCBaseTextFieldObjectsEqual(self.labelAttributedText, other.labelAttributedText) &&
+         MDCBaseTextFieldObjectsEqual(self.leadingAssistiveLabelAttributedText,
+                                      other.leadingAssistiveLabelAttributedText) &&
+         MDCBaseTextFieldObjectsEqual(self.leadingAssistiveLabelFont,
+                                      other.leadingAssistiveLabelFont) &&
+         MDCBaseTextFieldObjectsEqual(self.trailingAssistiveLabelAttributedText,
+                                      other.trailingAssistiveLabelAttributedText) &&
+         MDCBaseTextFieldObjectsEqual(self.trailingAssistiveLabelFont,
+                                      other.trailingAssistiveLabelFont);
+}
+
+@end
+
 @interface MDCBaseTextField () <MDCTextControlTextField>
 
 @property(strong, nonatomic) UILabel *label;
 @property(nonatomic, strong) MDCTextControlAssistiveLabelView *assistiveLabelView;
 @property(strong, nonatomic) MDCBaseTextFieldLayout *layout;
+/**
+ The most recently calculated layout and the inputs it was calculated from. Both @c -layoutSubviews
+ and @c -preferredSizeWithWidth: reuse this layout while their inputs are unchanged, so Auto Layout
+ asking for the intrinsic content size several times per pass only pays for one calculation.
+ */
+@property(strong, nonatomic) MDCBaseTextFieldLayout *memoizedLayout;
+@property(strong, nonatomic) MDCBaseTextFieldLayoutInputs *memoizedLayoutInputs;
 @property(nonatomic, assign) MDCTextControlState textControlState;
 @property(nonatomic, assign) MDCTextControlLabelPosition labelPosition;
 @property(nonatomic, assign) CGRect floatingLabelFrame;
@@ -201,7 +308,7 @@ static char *const kKVOContextMDCBaseTextField = "kKVOContextMDCBaseTextField";
       [self textControlColorViewModelForState:self.textControlState];
   [self applyColorViewModel:colorViewModel withLabelPosition:self.labelPosition];
   CGSize fittingSize = CGSizeMake(CGRectGetWidth(self.bounds), CGFLOAT_MAX);
-  self.layout = [self calculateLayoutWithTextFieldSize:fittingSize];
+  self.layout = [self layoutWithTextFieldSize:fittingSize];
   self.normalLabelFrame = self.layout.labelFrameNormal;
   self.floatingLabelFrame = self.layout.labelFrameFloating;
 }
@@ -280,10 +387,67 @@ static char *const kKVOContextMDCBaseTextField = "kKVOContextMDCBaseTextField";
   return CGRectMake(CGRectGetMinX(textRect), minY, CGRectGetWidth(textRect), systemDefinedHeight);
 }
 
-- (MDCBaseTextFieldLayout *)calculateLayoutWithTextFieldSize:(CGSize)textFieldSize {
+- (MDCBaseTextFieldLayout *)layoutWithTextFieldSize:(CGSize)textFieldSize {
+  CGFloat clearButtonSideLength = [self clearButtonSideLengthWithTextFieldSize:textFieldSize];
+  MDCBaseTextFieldLayoutInputs *inputs =
+      [self layoutInputsWithTextFieldSize:textFieldSize
+                    clearButtonSideLength:clearButtonSideLength];
+  if (self.memoizedLayout && [inputs isEqualToLayoutInputs:self.memoizedLayoutInputs]) {
+    return self.memoizedLayout;
+  }
+  self.memoizedLayout = [self calculateLayoutWithTextFieldSize:textFieldSize
+                                         clearButtonSideLength:clearButtonSideLength];
+  self.memoizedLayoutInputs = inputs;
+  return self.memoizedLayout;
+}
+
+- (MDCBaseTextFieldLayoutInputs *)layoutInputsWithTextFieldSize:(CGSize)textFieldSize
+                                          clearButtonSideLength:(CGFloat)clearButtonSideLength {
+  MDCBaseTextFieldLayoutInputs *inputs = [[MDCBaseTextFieldLayoutInputs alloc] init];
+  inputs.width = textFieldSize.width;
+  inputs.containerStyle = self.containerStyle;
+  inputs.normalFont = self.normalFont;
+  inputs.floatingFont = self.floatingFont;
+  inputs.hasText = self.text.length > 0;
+  inputs.labelAttributedText = self.label.attributedText;
+  inputs.labelPosition = self.labelPosition;
+  inputs.labelBehavior = self.labelBehavior;
+  inputs.sideViewAlignment = self.sideViewAlignment;
+  inputs.leadingView = self.leadingView;
+  inputs.leadingViewSize = self.leadingView.frame.size;
+  inputs.leadingViewMode = self.leadingViewMode;
+  inputs.trailingView = self.trailingView;
+  inputs.trailingViewSize = self.trailingView.frame.size;
+  inputs.trailingViewMode = self.trailingViewMode;
+  inputs.clearButtonSideLength = clearButtonSideLength;
+  inputs.clearButtonMode = self.clearButtonMode;
+  UILabel *leadingAssistiveLabel = self.assistiveLabelView.leadingAssistiveLabel;
+  inputs.leadingAssistiveLabelAttributedText = leadingAssistiveLabel.attributedText;
+  inputs.leadingAssistiveLabelFont = leadingAssistiveLabel.font;
+  inputs.leadingAssistiveLabelNumberOfLines = leadingAssistiveLabel.numberOfLines;
+  inputs.leadingAssistiveLabelHidden = leadingAssistiveLabel.hidden;
+  UILabel *trailingAssistiveLabel = self.assistiveLabelView.trailingAssistiveLabel;
+  inputs.trailingAssistiveLabelAttributedText = trailingAssistiveLabel.attributedText;
+  inputs.trailingAssistiveLabelFont = trailingAssistiveLabel.font;
+  inputs.trailingAssistiveLabelNumberOfLines = trailingAssistiveLabel.numberOfLines;
+  inputs.trailingAssistiveLabelHidden = trailingAssistiveLabel.hidden;
+  inputs.assistiveLabelDrawPriority = self.assistiveLabelDrawPriority;
+  inputs.customAssistiveLabelDrawPriority = self.customAssistiveLabelDrawPriority;
+  inputs.verticalDensity = self.verticalDensity;
+  inputs.preferredContainerHeight = self.preferredContainerHeight;
+  inputs.numberOfLinesOfVisibleText = self.numberOfLinesOfVisibleText;
+  inputs.leadingEdgePaddingOverride = self.leadingEdgePaddingOverride;
+  inputs.trailingEdgePaddingOverride = self.trailingEdgePaddingOverride;
+  inputs.horizontalInterItemSpacingOverride = self.horizontalInterItemSpacingOverride;
+  inputs.isRTL = self.shouldLayoutForRTL;
+  inputs.isEditing = self.isEditing;
+  return inputs;
+}
+
+- (MDCBaseTextFieldLayout *)calculateLayoutWithTextFieldSize:(CGSize)textFieldSize
+                                       clearButtonSideLength:(CGFloat)clearButtonSideLength {
   CGFloat clampedCustomAssistiveLabelDrawPriority =
       [self clampedCustomAssistiveLabelDrawPriority:self.customAssistiveLabelDrawPriority];
-  CGFloat clearButtonSideLength = [self clearButtonSideLengthWithTextFieldSize:textFieldSize];
   id<MDCTextControlVerticalPositioningReference> verticalPositioningReference =
       [self createVerticalPositioningReference];
   id<MDCTextControlHorizontalPositioning> horizontalPositioningReference =
@@ -360,7 +524,7 @@ static char *const kKVOContextMDCBaseTextField = "kKVOContextMDCBaseTextField";
 
 - (CGSize)preferredSizeWithWidth:(CGFloat)width {
   CGSize fittingSize = CGSizeMake(width, CGFLOAT_MAX);
-  MDCBaseTextFieldLayout *layout = [self calculateLayoutWithTextFieldSize:fittingSize];
+  MDCBaseTextFieldLayout *layout = [self layoutWithTextFieldSize:fittingSize];
   return CGSizeMake(width, layout.calculatedHeight);
 }
 
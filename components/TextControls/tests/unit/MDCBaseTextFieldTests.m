@@ -17,6 +17,7 @@
 #import "MaterialTextControls+BaseTextFields.h"
 #import "MaterialTextControls+Enums.h"
 #import "MaterialTextControlsPrivate+BaseStyle.h"
+#import "MaterialTextControlsPrivate+TextFields.h"
 
 @interface MDCBaseTextField (Private)
 - (BOOL)shouldLayoutForRTL;
@@ -448,4 +449,137 @@
   XCTAssertEqual(textField.intrinsicContentSize.height, 150);
 }
 
+#pragma mark Layout Memoization
+
+- (void)testRepeatedIntrinsicContentSizeCalculatesLayoutOnce {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  textField.label.text = @"Label";
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+
+  // When
+  CGSize firstSize = textField.intrinsicContentSize;
+  CGSize secondSize = textField.intrinsicContentSize;
+  CGSize fittingSize = [textField sizeThatFits:CGSizeMake(100, 60)];
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 0U);
+  XCTAssertTrue(CGSizeEqualToSize(firstSize, secondSize));
+  XCTAssertTrue(CGSizeEqualToSize(firstSize, fittingSize));
+}
+
+- (void)testChangingLayoutInputRecalculatesLayout {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  CGFloat initialHeight = textField.intrinsicContentSize.height;
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+
+  // When
+  textField.leadingAssistiveLabel.text = @"Assistive";
+  CGFloat heightWithAssistiveText = textField.intrinsicContentSize.height;
+  CGFloat repeatedHeight = textField.intrinsicContentSize.height;
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 1U);
+  XCTAssertGreaterThan(heightWithAssistiveText, initialHeight);
+  XCTAssertEqual(heightWithAssistiveText, repeatedHeight);
+}
+
+- (void)testChangingAssistiveLabelAttributedTextFontRecalculatesLayout {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  textField.leadingAssistiveLabel.text = @"Assistive";
+  CGFloat initialHeight = textField.intrinsicContentSize.height;
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+
+  // When
+  textField.leadingAssistiveLabel.attributedText = [[NSAttributedString alloc]
+      initWithString:@"Assistive"
+          attributes:@{NSFontAttributeName : [UIFont systemFontOfSize:40]}];
+  CGFloat heightWithLargeAssistiveText = textField.intrinsicContentSize.height;
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 1U);
+  XCTAssertGreaterThan(heightWithLargeAssistiveText, initialHeight);
+}
+
+- (void)testChangingAssistiveLabelTextColorDoesNotRecalculateLayout {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  textField.leadingAssistiveLabel.text = @"Assistive";
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+  [textField layoutIfNeeded];
+
+  // When
+  textField.leadingAssistiveLabel.textColor = UIColor.redColor;
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 1U);
+}
+
+- (void)testTypingDoesNotRecalculateLayoutOnceTextIsPresent {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  textField.text = @"a";
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+
+  // When
+  textField.text = @"ab";
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+  [textField invalidateIntrinsicContentSize];
+  CGSize size = textField.intrinsicContentSize;
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 0U);
+  XCTAssertGreaterThan(size.height, 0);
+}
+
+- (void)testDifferentWidthsRecalculateLayout {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 100, 60)];
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayoutResetCalculationCounts();
+
+  // When
+  [textField sizeThatFits:CGSizeMake(200, 60)];
+  [textField sizeThatFits:CGSizeMake(200, 60)];
+
+  // Then
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCount(), 1U);
+  XCTAssertEqual(MDCBaseTextFieldLayoutCalculationCountInCurrentRunLoopTurn(), 1U);
+}
+
+#pragma mark Performance
+
+- (void)testPerformanceIntrinsicContentSizeForLargeForm {
+  // Given
+  NSMutableArray<MDCBaseTextField *> *textFields = [NSMutableArray array];
+  for (NSInteger i = 0; i < 30; i++) {
+    MDCBaseTextField *textField =
+        [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 320, 60)];
+    textField.label.text = [NSString stringWithFormat:@"Field %ld", (long)i];
+    textField.leadingAssistiveLabel.text = @"Helper text";
+    [textFields addObject:textField];
+  }
+
+  // Then
+  // Auto Layout asks each field for its intrinsic content size several times per pass.
+  [self measureBlock:^{
+    for (NSInteger pass = 0; pass < 100; pass++) {
+      for (MDCBaseTextField *textField in textFields) {
+        (void)textField.intrinsicContentSize;
+        (void)textField.intrinsicContentSize;
+        (void)textField.intrinsicContentSize;
+      }
+    }
+  }];
+}
+
 @end
@@ -43,21 +43,13 @@ static const CGFloat kButtonFontOpacity = 0.54f;
 #pragma mark - Clear Button Customization
 
 - (UIImage *)drawnClearButtonImage:(UIColor *)color {
-  CGSize clearButtonSize =
-      CGSizeMake(MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight,
-                 MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight);
-
   CGFloat scale = [UIScreen mainScreen].scale;
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width * scale, clearButtonSize.height * scale);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
-  [color setFill];
-
-  [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  // The image has always been drawn at its size multiplied by the screen scale.
+  CGFloat sideLength =
+      MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight * scale;
+  CGSize clearButtonSize = CGSizeMake(sideLength, sideLength);
+  return MDCTextInputLegacyClearButtonImage(clearButtonSize, CGColorGetAlpha(color.CGColor),
+                                            scale);
 }
 
 @end
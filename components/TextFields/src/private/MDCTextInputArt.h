@@ -14,6 +14,7 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MaterialIcons.h"
 
 static const CGFloat MDCTextInputClearButtonImageBuiltInPadding = 2;
 
@@ -188,3 +189,43 @@ static inline UIBezierPath *MDCPathForClearButtonLegacyImageFrame(CGRect frame)
 
   return ic_clear_path;
 }
+
+#pragma mark - Shared images
+
+static NSString *const MDCTextInputClearButtonIconName = @"MDCTextInputClearButton";
+static NSString *const MDCTextInputLegacyClearButtonIconName = @"MDCTextInputLegacyClearButton";
+
+/**
+ Returns the clear button icon as a shared template image, drawing it only the first time a given
+ size, opacity and scale is requested.
+ */
+static inline UIImage *MDCTextInputClearButtonImage(CGSize size, CGFloat opacity, CGFloat scale) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    [MDCIcons registerProceduralIconNamed:MDCTextInputClearButtonIconName
+                             pathProvider:^UIBezierPath *(CGRect frame) {
+                               return MDCPathForClearButtonImageFrame(frame);
+                             }];
+  });
+  return [MDCIcons templateImageForProceduralIconNamed:MDCTextInputClearButtonIconName
+                                                  size:size
+                                               opacity:opacity
+                                                 scale:scale];
+}
+
+/** Like @c MDCTextInputClearButtonImage, for the clear button of the legacy controllers. */
+static inline UIImage *MDCTextInputLegacyClearButtonImage(CGSize size,
+                                                          CGFloat opacity,
+                                                          CGFloat scale) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    [MDCIcons registerProceduralIconNamed:MDCTextInputLegacyClearButtonIconName
+                             pathProvider:^UIBezierPath *(CGRect frame) {
+                               return MDCPathForClearButtonLegacyImageFrame(frame);
+                             }];
+  });
+  return [MDCIcons templateImageForProceduralIconNamed:MDCTextInputLegacyClearButtonIconName
+                                                  size:size
+                                               opacity:opacity
+                                                 scale:scale];
+}
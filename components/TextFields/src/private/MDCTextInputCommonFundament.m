@@ -626,17 +626,7 @@ static inline UIColor *MDCTextInputUnderlineColor() {
 - (UIImage *)drawnClearButtonImage {
   CGSize clearButtonSize = CGSizeMake(MDCTextInputClearButtonImageSquareWidthHeight,
                                       MDCTextInputClearButtonImageSquareWidthHeight);
-
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  return MDCTextInputClearButtonImage(clearButtonSize, 1, 0);
 }
 
 - (void)clearButtonDidTouch {
@@ -14,9 +14,8 @@
 
 #import "MDCFontScaler.h"
 
-#import <objc/runtime.h>
-
 #import "UIFont+MaterialScalable.h"
+#import "MDCFontScalingCurve.h"
 #import "MDCTypographyUtilities.h"
 
 MDCTextStyle const MDCTextStyleHeadline1 = @"MDC.TextStyle.Headline1";
@@ -33,8 +32,70 @@ MDCTextStyle const MDCTextStyleButton = @"MDC.TextStyle.Button";
 MDCTextStyle const MDCTextStyleCaption = @"MDC.TextStyle.Caption";
 MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
 
+// Point sizes of each text style, ordered from UIContentSizeCategoryExtraSmall to
+// UIContentSizeCategoryAccessibilityExtraExtraExtraLarge.
+//
+// NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory
+// values. This values must not decrease as the category size increases. To put it another
+// way, the value for UIContentSizeCategoryLarge must not be smaller than the value for
+// UIContentSizeCategoryMedium.
+static const CGFloat kHeadline1ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108};
+static const CGFloat kHeadline2ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    54, 56, 58, 60, 62, 64, 66, 66, 66, 66, 66, 66};
+static const CGFloat kHeadline3ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    42, 44, 46, 48, 50, 52, 54, 54, 54, 54, 54, 54};
+static const CGFloat kHeadline4ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    28, 30, 32, 34, 36, 38, 40, 42, 42, 42, 42, 42};
+static const CGFloat kHeadline5ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    21, 22, 23, 24, 26, 28, 30, 32, 32, 32, 32, 32};
+static const CGFloat kHeadline6ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    17, 18, 19, 20, 22, 24, 26, 28, 28, 28, 28, 28};
+static const CGFloat kSubtitle1ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    13, 14, 15, 16, 18, 20, 22, 25, 30, 37, 44, 52};
+static const CGFloat kSubtitle2ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42};
+static const CGFloat kBody1ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    13, 14, 15, 16, 18, 20, 22, 26, 30, 34, 38, 42};
+static const CGFloat kBody2ScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42};
+static const CGFloat kButtonScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    11, 12, 13, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+static const CGFloat kCaptionScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    11, 11, 11, 12, 14, 16, 18, 20, 22, 24, 26, 28};
+static const CGFloat kOverlineScalingCurve[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    8, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24, 26};
+
+static MDCFontScalingCurve *CurveWithTable(const CGFloat *pointSizes) {
+  return [[MDCFontScalingCurve alloc] initWithPointSizeTable:pointSizes];
+}
+
+/** Returns the shared scaling curves of all Material text styles, keyed by text style. */
+static NSDictionary<MDCTextStyle, MDCFontScalingCurve *> *MDCFontScalerCurves(void) {
+  static NSDictionary<MDCTextStyle, MDCFontScalingCurve *> *curves;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    curves = @{
+      MDCTextStyleHeadline1 : CurveWithTable(kHeadline1ScalingCurve),
+      MDCTextStyleHeadline2 : CurveWithTable(kHeadline2ScalingCurve),
+      MDCTextStyleHeadline3 : CurveWithTable(kHeadline3ScalingCurve),
+      MDCTextStyleHeadline4 : CurveWithTable(kHeadline4ScalingCurve),
+      MDCTextStyleHeadline5 : CurveWithTable(kHeadline5ScalingCurve),
+      MDCTextStyleHeadline6 : CurveWithTable(kHeadline6ScalingCurve),
+      MDCTextStyleSubtitle1 : CurveWithTable(kSubtitle1ScalingCurve),
+      MDCTextStyleSubtitle2 : CurveWithTable(kSubtitle2ScalingCurve),
+      MDCTextStyleBody1 : CurveWithTable(kBody1ScalingCurve),
+      MDCTextStyleBody2 : CurveWithTable(kBody2ScalingCurve),
+      MDCTextStyleButton : CurveWithTable(kButtonScalingCurve),
+      MDCTextStyleCaption : CurveWithTable(kCaptionScalingCurve),
+      MDCTextStyleOverline : CurveWithTable(kOverlineScalingCurve),
+    };
+  });
+  return curves;
+}
+
 @implementation MDCFontScaler {
-  NSDictionary<UIContentSizeCategory, NSNumber *> *_scalingCurve;
+  MDCFontScalingCurve *_scalingCurve;
   MDCTextStyle _textStyle;
 }
 
@@ -46,221 +107,11 @@ MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
   self = [super init];
   if (self) {
     _textStyle = [textStyle copy];
-
-    // NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory
-    // values. This values must not decrease as the category size increases. To put it another
-    // way, the value for UIContentSizeCategoryLarge must not be smaller than the value for
-    // UIContentSizeCategoryMedium.
-    if ([MDCTextStyleHeadline1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @84,
-        UIContentSizeCategorySmall : @88,
-        UIContentSizeCategoryMedium : @92,
-        UIContentSizeCategoryLarge : @96,
-        UIContentSizeCategoryExtraLarge : @100,
-        UIContentSizeCategoryExtraExtraLarge : @104,
-        UIContentSizeCategoryExtraExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityMedium : @108,
-        UIContentSizeCategoryAccessibilityLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @108
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @54,
-        UIContentSizeCategorySmall : @56,
-        UIContentSizeCategoryMedium : @58,
-        UIContentSizeCategoryLarge : @60,
-        UIContentSizeCategoryExtraLarge : @62,
-        UIContentSizeCategoryExtraExtraLarge : @64,
-        UIContentSizeCategoryExtraExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityMedium : @66,
-        UIContentSizeCategoryAccessibilityLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @66
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline3 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @42,
-        UIContentSizeCategorySmall : @44,
-        UIContentSizeCategoryMedium : @46,
-        UIContentSizeCategoryLarge : @48,
-        UIContentSizeCategoryExtraLarge : @50,
-        UIContentSizeCategoryExtraExtraLarge : @52,
-        UIContentSizeCategoryExtraExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityMedium : @54,
-        UIContentSizeCategoryAccessibilityLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @54
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline4 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @28,
-        UIContentSizeCategorySmall : @30,
-        UIContentSizeCategoryMedium : @32,
-        UIContentSizeCategoryLarge : @34,
-        UIContentSizeCategoryExtraLarge : @36,
-        UIContentSizeCategoryExtraExtraLarge : @38,
-        UIContentSizeCategoryExtraExtraExtraLarge : @40,
-        UIContentSizeCategoryAccessibilityMedium : @42,
-        UIContentSizeCategoryAccessibilityLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline5 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @21,
-        UIContentSizeCategorySmall : @22,
-        UIContentSizeCategoryMedium : @23,
-        UIContentSizeCategoryLarge : @24,
-        UIContentSizeCategoryExtraLarge : @26,
-        UIContentSizeCategoryExtraExtraLarge : @28,
-        UIContentSizeCategoryExtraExtraExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityMedium : @32,
-        UIContentSizeCategoryAccessibilityLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @32
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline6 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @17,
-        UIContentSizeCategorySmall : @18,
-        UIContentSizeCategoryMedium : @19,
-        UIContentSizeCategoryLarge : @20,
-        UIContentSizeCategoryExtraLarge : @22,
-        UIContentSizeCategoryExtraExtraLarge : @24,
-        UIContentSizeCategoryExtraExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityMedium : @28,
-        UIContentSizeCategoryAccessibilityLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @25,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @37,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @44,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @52
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleBody2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleButton isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @30
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleCaption isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @11,
-        UIContentSizeCategoryMedium : @11,
-        UIContentSizeCategoryLarge : @12,
-        UIContentSizeCategoryExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraExtraLarge : @18,
-        UIContentSizeCategoryAccessibilityMedium : @20,
-        UIContentSizeCategoryAccessibilityLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleOverline isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @8,
-        UIContentSizeCategorySmall : @8,
-        UIContentSizeCategoryMedium : @9,
-        UIContentSizeCategoryLarge : @10,
-        UIContentSizeCategoryExtraLarge : @12,
-        UIContentSizeCategoryExtraExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraExtraLarge : @16,
-        UIContentSizeCategoryAccessibilityMedium : @18,
-        UIContentSizeCategoryAccessibilityLarge : @20,
-        UIContentSizeCategoryAccessibilityExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @26
-      };
-      _scalingCurve = scalingCurve;
-    } else {
+    _scalingCurve = MDCFontScalerCurves()[textStyle];
+    if (!_scalingCurve) {
       // If nothing matches, return the metrics for MDCTextStyleBody1
       _textStyle = [MDCTextStyleBody1 copy];
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @26,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @34,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @38,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
+      _scalingCurve = MDCFontScalerCurves()[MDCTextStyleBody1];
     }
   }
 
@@ -274,7 +125,7 @@ MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
   // We create a new font to ensure we have a complete set of font traits.
   // They we apply our new scaling curve before returning a scaled font.
   UIFont *templateFont = [UIFont fontWithDescriptor:font.fontDescriptor size:0.0];
-  templateFont.mdc_scalingCurve = _scalingCurve;
+  templateFont.mdc_fontScalingCurve = _scalingCurve;
   UIFont *scaledFont = [templateFont mdc_scaledFontForSizeCategory:sizeCategory];
 
   return scaledFont;
@@ -14,45 +14,34 @@
 
 #import "UIFont+MaterialScalable.h"
 
-#import <objc/runtime.h>
-
 #import "MaterialApplication.h"
 
+#import "private/MDCFontScalingCurve.h"
 #import "private/MDCTypographyUtilities.h"
 
-static char MDCFontScaleObjectKey;
-
 @implementation UIFont (MaterialScalable)
 
 - (UIFont *)mdc_scaledFontForSizeCategory:(UIContentSizeCategory)sizeCategory {
-  if (!self.mdc_scalingCurve) {
-    return self;
-  }
-
-  NSNumber *fontSizeNumber;
-  if (sizeCategory) {
-    // Pick the correct font size from the pre-attached scaling curve that
-    // fits the specific size category. The scaling curve is attached based on
-    // the type of font, so a button font has a different scaling curve than
-    // a headline font, and the two will therefore see different font size numbers
-    // for the same size category.
-    fontSizeNumber = self.mdc_scalingCurve[sizeCategory];
-  }
-
-  // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
-  if (fontSizeNumber == nil) {
+  MDCFontScalingCurve *scalingCurve = self.mdc_fontScalingCurve;
+  if (!scalingCurve) {
     return self;
   }
 
-  CGFloat fontSize = (CGFloat)fontSizeNumber.doubleValue;
+  // Pick the correct font size from the pre-attached scaling curve that
+  // fits the specific size category. The scaling curve is attached based on
+  // the type of font, so a button font has a different scaling curve than
+  // a headline font, and the two will therefore see different font size numbers
+  // for the same size category.
+  CGFloat fontSize = [scalingCurve pointSizeForSizeCategory:sizeCategory];
 
-  // Guard against broken scaling curves encoded with 0.0 or negative values
+  // Guard against broken / incomplete scaling curves, which yield a font size of 0.0, and scaling
+  // curves encoded with 0.0 or negative values by returning self.
   if (fontSize <= 0.0) {
     return self;
   }
 
   UIFont *scaledFont = [UIFont fontWithDescriptor:self.fontDescriptor size:fontSize];
-  scaledFont.mdc_scalingCurve = self.mdc_scalingCurve;
+  scaledFont.mdc_fontScalingCurve = scalingCurve;
 
   return scaledFont;
 }
@@ -74,13 +63,12 @@ static char MDCFontScaleObjectKey;
 }
 
 - (NSDictionary<UIContentSizeCategory, NSNumber *> *)mdc_scalingCurve {
-  return (NSDictionary<UIContentSizeCategory, NSNumber *> *)objc_getAssociatedObject(
-      self, &MDCFontScaleObjectKey);
+  return self.mdc_fontScalingCurve.dictionary;
 }
 
 - (void)mdc_setScalingCurve:(NSDictionary<UIContentSizeCategory, NSNumber *> *)scalingCurve {
-  objc_setAssociatedObject(self, &MDCFontScaleObjectKey, scalingCurve,
-                           OBJC_ASSOCIATION_COPY_NONATOMIC);
+  self.mdc_fontScalingCurve =
+      scalingCurve ? [[MDCFontScalingCurve alloc] initWithDictionary:scalingCurve] : nil;
 }
 
 @end
@@ -14,8 +14,48 @@
 
 #import "UIFont+MaterialTypography.h"
 
+#import <os/lock.h>
+
 #import "MDCTypography.h"
 #import "UIFontDescriptor+MaterialTypography.h"
+#import "private/MDCFontScalingCurve.h"
+#import "private/MDCTypographyUtilities.h"
+
+// The number of MDCFontTextStyle values.
+#define kFontTextStyleCount (MDCFontTextStyleButton + 1)
+
+@interface UIFontDescriptor (MaterialTypographyPreferredFontCache)
++ (nonnull UIFontDescriptor *)mdc_fontDescriptorForMaterialTextStyle:(MDCFontTextStyle)style
+                                                        sizeCategory:(NSString *)sizeCategory;
+@end
+
+// Preferred fonts, indexed by MDCFontTextStyle and content size category. Emptied whenever the
+// content size category changes, since most of the table is then no longer needed.
+static UIFont *gPreferredFonts[kFontTextStyleCount][MDC_CONTENT_SIZE_CATEGORY_COUNT];
+static os_unfair_lock gPreferredFontsLock = OS_UNFAIR_LOCK_INIT;
+
+static void MDCRemoveAllPreferredFonts(void) {
+  os_unfair_lock_lock(&gPreferredFontsLock);
+  for (NSUInteger style = 0; style < kFontTextStyleCount; style++) {
+    for (NSUInteger category = 0; category < MDC_CONTENT_SIZE_CATEGORY_COUNT; category++) {
+      gPreferredFonts[style][category] = nil;
+    }
+  }
+  os_unfair_lock_unlock(&gPreferredFontsLock);
+}
+
+static void MDCObserveContentSizeCategoryChanges(void) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    [[NSNotificationCenter defaultCenter]
+        addObserverForName:UIContentSizeCategoryDidChangeNotification
+                    object:nil
+                     queue:nil
+                usingBlock:^(__unused NSNotification *notification) {
+                  MDCRemoveAllPreferredFonts();
+                }];
+  });
+}
 
 @implementation UIFont (MaterialTypography)
 
@@ -27,12 +67,30 @@
     NSLog(@"MaterialTypography : Custom font loaders are not compatible with Dynamic Type.");
   }
 
+  UIContentSizeCategory sizeCategory = GetPreferredSizeCategory();
+  NSUInteger category = MDCContentSizeCategoryIndex(sizeCategory);
+  BOOL isCacheable = style >= 0 && style < kFontTextStyleCount && category != NSNotFound;
+  if (isCacheable) {
+    os_unfair_lock_lock(&gPreferredFontsLock);
+    UIFont *font = gPreferredFonts[style][category];
+    os_unfair_lock_unlock(&gPreferredFontsLock);
+    if (font) {
+      return font;
+    }
+  }
+
   UIFontDescriptor *fontDescriptor =
-      [UIFontDescriptor mdc_preferredFontDescriptorForMaterialTextStyle:style];
+      [UIFontDescriptor mdc_fontDescriptorForMaterialTextStyle:style sizeCategory:sizeCategory];
 
   // Size is included in the fontDescriptor, so we pass in 0.0 in the parameter.
   UIFont *font = [UIFont fontWithDescriptor:fontDescriptor size:0.0];
 
+  if (isCacheable) {
+    MDCObserveContentSizeCategoryChanges();
+    os_unfair_lock_lock(&gPreferredFontsLock);
+    gPreferredFonts[style][category] = font;
+    os_unfair_lock_unlock(&gPreferredFontsLock);
+  }
   return font;
 }
 
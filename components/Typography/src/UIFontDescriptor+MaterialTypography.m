@@ -14,9 +14,8 @@
 
 #import "UIFontDescriptor+MaterialTypography.h"
 
-#import "MaterialApplication.h"
-
 #import "private/MDCFontTraits.h"
+#import "private/MDCTypographyUtilities.h"
 
 @implementation UIFontDescriptor (MaterialTypography)
 
@@ -58,15 +57,7 @@
 
 + (nonnull UIFontDescriptor *)mdc_preferredFontDescriptorForMaterialTextStyle:
     (MDCFontTextStyle)style {
-  // iOS' default UIContentSizeCategory is Large.
-  NSString *sizeCategory = UIContentSizeCategoryLarge;
-
-  // If we are within an application, query the preferredContentSizeCategory.
-  if ([UIApplication mdc_safeSharedApplication]) {
-    sizeCategory = [UIApplication mdc_safeSharedApplication].preferredContentSizeCategory;
-  } else {
-    sizeCategory = UIScreen.mainScreen.traitCollection.preferredContentSizeCategory;
-  }
+  NSString *sizeCategory = GetPreferredSizeCategory();
 
   return [UIFontDescriptor mdc_fontDescriptorForMaterialTextStyle:style sizeCategory:sizeCategory];
 }
@@ -0,0 +1,78 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "UIFont+MaterialScalable.h"
+
+/** The number of UIContentSizeCategory values covered by a scaling curve. */
+#define MDC_CONTENT_SIZE_CATEGORY_COUNT 12
+
+/**
+ Returns the position of a content size category in a scaling curve, from 0 for
+ UIContentSizeCategoryExtraSmall to 11 for UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+ or NSNotFound for any other category.
+
+ The most recently resolved category is remembered, so resolving the category of a trait
+ collection repeatedly only compares strings when the category changes.
+ */
+FOUNDATION_EXTERN NSUInteger MDCContentSizeCategoryIndex(UIContentSizeCategory _Nullable category);
+
+/**
+ An immutable font scaling curve.
+
+ Curves for Material text styles are backed by static tables of point sizes and are shared by all
+ font scalers and the fonts they scale. Curves created from a dictionary, e.g. through
+ @c -[UIFont mdc_setScalingCurve:], look up point sizes in that dictionary.
+ */
+@interface MDCFontScalingCurve : NSObject
+
+/**
+ Returns a curve backed by a table of point sizes, ordered as by MDCContentSizeCategoryIndex.
+
+ The table is not copied and must outlive the curve, e.g. by being a static constant.
+ */
+- (nonnull instancetype)initWithPointSizeTable:(nonnull const CGFloat *)pointSizes;
+
+/** Returns a curve that reads point sizes from a copy of the given dictionary. */
+- (nonnull instancetype)initWithDictionary:(nonnull MDCScalingCurve)dictionary;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ The curve as a dictionary mapping UIContentSizeCategory to point size.
+
+ For table-backed curves the dictionary is only created the first time it is requested.
+ */
+@property(nonatomic, readonly, nonnull) MDCScalingCurve dictionary;
+
+/**
+ Returns the point size for the given content size category, or 0 if the curve has no value for
+ the category.
+ */
+- (CGFloat)pointSizeForSizeCategory:(nullable UIContentSizeCategory)sizeCategory;
+
+@end
+
+@interface UIFont (MaterialScalingCurve)
+
+/**
+ The scaling curve attached to this font, shared as-is with fonts scaled from it.
+
+ @c mdc_scalingCurve is a dictionary view of this curve.
+ */
+@property(nonatomic, strong, nullable, setter=mdc_setFontScalingCurve:)
+    MDCFontScalingCurve *mdc_fontScalingCurve;
+
+@end
@@ -0,0 +1,139 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCFontScalingCurve.h"
+
+#import <objc/runtime.h>
+#import <os/lock.h>
+
+static char MDCFontScalingCurveKey;
+
+NSUInteger MDCContentSizeCategoryIndex(UIContentSizeCategory category) {
+  static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+  static UIContentSizeCategory lastCategory;
+  static NSUInteger lastIndex = NSNotFound;
+  if (!category) {
+    return NSNotFound;
+  }
+
+  os_unfair_lock_lock(&lock);
+  BOOL isLastCategory = category == lastCategory;
+  NSUInteger index = lastIndex;
+  os_unfair_lock_unlock(&lock);
+  if (isLastCategory) {
+    return index;
+  }
+
+  // Ordered from smallest to largest.
+  UIContentSizeCategory categories[MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+      UIContentSizeCategoryExtraSmall,
+      UIContentSizeCategorySmall,
+      UIContentSizeCategoryMedium,
+      UIContentSizeCategoryLarge,
+      UIContentSizeCategoryExtraLarge,
+      UIContentSizeCategoryExtraExtraLarge,
+      UIContentSizeCategoryExtraExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityMedium,
+      UIContentSizeCategoryAccessibilityLarge,
+      UIContentSizeCategoryAccessibilityExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+  };
+  index = NSNotFound;
+  for (NSUInteger i = 0; i < MDC_CONTENT_SIZE_CATEGORY_COUNT; i++) {
+    if (category == categories[i] || [category isEqualToString:categories[i]]) {
+      index = i;
+      break;
+    }
+  }
+
+  os_unfair_lock_lock(&lock);
+  lastCategory = [category copy];
+  lastIndex = index;
+  os_unfair_lock_unlock(&lock);
+  return index;
+}
+
+@implementation MDCFontScalingCurve {
+  const CGFloat *_pointSizes;
+  MDCScalingCurve _dictionary;
+  os_unfair_lock _dictionaryLock;
+}
+
+- (instancetype)initWithPointSizeTable:(const CGFloat *)pointSizes {
+  self = [super init];
+  if (self) {
+    _pointSizes = pointSizes;
+    _dictionaryLock = OS_UNFAIR_LOCK_INIT;
+  }
+  return self;
+}
+
+- (instancetype)initWithDictionary:(MDCScalingCurve)dictionary {
+  self = [super init];
+  if (self) {
+    _dictionary = [dictionary copy];
+    _dictionaryLock = OS_UNFAIR_LOCK_INIT;
+  }
+  return self;
+}
+
+- (MDCScalingCurve)dictionary {
+  os_unfair_lock_lock(&_dictionaryLock);
+  if (!_dictionary) {
+    _dictionary = @{
+      UIContentSizeCategoryExtraSmall : @(_pointSizes[0]),
+      UIContentSizeCategorySmall : @(_pointSizes[1]),
+      UIContentSizeCategoryMedium : @(_pointSizes[2]),
+      UIContentSizeCategoryLarge : @(_pointSizes[3]),
+      UIContentSizeCategoryExtraLarge : @(_pointSizes[4]),
+      UIContentSizeCategoryExtraExtraLarge : @(_pointSizes[5]),
+      UIContentSizeCategoryExtraExtraExtraLarge : @(_pointSizes[6]),
+      UIContentSizeCategoryAccessibilityMedium : @(_pointSizes[7]),
+      UIContentSizeCategoryAccessibilityLarge : @(_pointSizes[8]),
+      UIContentSizeCategoryAccessibilityExtraLarge : @(_pointSizes[9]),
+      UIContentSizeCategoryAccessibilityExtraExtraLarge : @(_pointSizes[10]),
+      UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @(_pointSizes[11])
+    };
+  }
+  MDCScalingCurve dictionary = _dictionary;
+  os_unfair_lock_unlock(&_dictionaryLock);
+  return dictionary;
+}
+
+- (CGFloat)pointSizeForSizeCategory:(UIContentSizeCategory)sizeCategory {
+  if (!sizeCategory) {
+    return 0;
+  }
+  if (_pointSizes) {
+    NSUInteger index = MDCContentSizeCategoryIndex(sizeCategory);
+    return index == NSNotFound ? 0 : _pointSizes[index];
+  }
+  return (CGFloat)_dictionary[sizeCategory].doubleValue;
+}
+
+@end
+
+@implementation UIFont (MaterialScalingCurve)
+
+- (MDCFontScalingCurve *)mdc_fontScalingCurve {
+  return (MDCFontScalingCurve *)objc_getAssociatedObject(self, &MDCFontScalingCurveKey);
+}
+
+- (void)mdc_setFontScalingCurve:(MDCFontScalingCurve *)fontScalingCurve {
+  objc_setAssociatedObject(self, &MDCFontScalingCurveKey, fontScalingCurve,
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+@end
@@ -14,459 +14,114 @@
 
 #import "MDCFontTraits.h"
 
-static NSDictionary<NSString *, MDCFontTraits *> *_body1Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_body2Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_buttonTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_captionTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display1Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display2Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display3Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display4Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_headlineTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_subheadlineTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_titleTraits;
+#import "MDCFontScalingCurve.h"
 
-static NSDictionary<NSNumber *, NSDictionary *> *_styleTable;
+// The number of MDCFontTextStyle values.
+#define kFontTextStyleCount (MDCFontTextStyleButton + 1)
 
-@interface MDCFontTraits (MaterialTypographyPrivate)
+// The index of UIContentSizeCategoryExtraExtraExtraLarge in a row of the traits table.
+static const NSUInteger kExtraExtraExtraLargeIndex = 6;
 
-+ (instancetype)traitsWithPointSize:(CGFloat)pointSize
-                             weight:(CGFloat)weight
-                            leading:(CGFloat)leading
-                           tracking:(CGFloat)tracking;
-
-- (instancetype)initWithPointSize:(CGFloat)pointSize
-                           weight:(CGFloat)weight
-                          leading:(CGFloat)leading
-                         tracking:(CGFloat)tracking;
-
-@end
-
-@implementation MDCFontTraits
+/** The font weights used by Material text styles. */
+typedef NS_ENUM(NSInteger, MDCFontTraitsWeight) {
+  MDCFontTraitsWeightLight,
+  MDCFontTraitsWeightRegular,
+  MDCFontTraitsWeightMedium,
+};
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wpartial-availability"
-+ (void)initialize {
-  _body1Traits = @{
-    UIContentSizeCategoryExtraSmall : [MDCFontTraits traitsWithPointSize:11
-                                                                  weight:UIFontWeightRegular
-                                                                 leading:0.0
-                                                                tracking:0.0],
-    UIContentSizeCategorySmall : [MDCFontTraits traitsWithPointSize:12
-                                                             weight:UIFontWeightRegular
-                                                            leading:0.0
-                                                           tracking:0.0],
-    UIContentSizeCategoryMedium : [MDCFontTraits traitsWithPointSize:13
-                                                              weight:UIFontWeightRegular
-                                                             leading:0.0
-                                                            tracking:0.0],
-    UIContentSizeCategoryLarge : [MDCFontTraits traitsWithPointSize:14
-                                                             weight:UIFontWeightRegular
-                                                            leading:0.0
-                                                           tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [MDCFontTraits traitsWithPointSize:16
-                                                                  weight:UIFontWeightRegular
-                                                                 leading:0.0
-                                                                tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge : [MDCFontTraits traitsWithPointSize:18
-                                                                       weight:UIFontWeightRegular
-                                                                      leading:0.0
-                                                                     tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:20 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityMedium :
-        [MDCFontTraits traitsWithPointSize:25 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityLarge : [MDCFontTraits traitsWithPointSize:30
-                                                                          weight:UIFontWeightRegular
-                                                                         leading:0.0
-                                                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraLarge :
-        [MDCFontTraits traitsWithPointSize:37 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:44 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:52 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-  };
-
-  _body2Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityMedium :
-        [[MDCFontTraits alloc] initWithPointSize:25
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityLarge :
-        [[MDCFontTraits alloc] initWithPointSize:30
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:37
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:44
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:52
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
 
-  _buttonTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+// The point sizes of each text style, indexed by MDCFontTextStyle and then by content size category
+// from UIContentSizeCategoryExtraSmall to UIContentSizeCategoryAccessibilityExtraExtraExtraLarge.
+// Only the Body styles define accessibility sizes; entries of 0 use the traits of
+// UIContentSizeCategoryExtraExtraExtraLarge instead.
+static const CGFloat kPointSizes[kFontTextStyleCount][MDC_CONTENT_SIZE_CATEGORY_COUNT] = {
+    // MDCFontTextStyleBody1
+    {11, 12, 13, 14, 16, 18, 20, 25, 30, 37, 44, 52},
+    // MDCFontTextStyleBody2
+    {11, 12, 13, 14, 16, 18, 20, 25, 30, 37, 44, 52},
+    // MDCFontTextStyleCaption
+    {11, 11, 11, 12, 14, 16, 18, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleHeadline
+    {21, 22, 23, 24, 26, 28, 30, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleSubheadline
+    {13, 14, 15, 16, 18, 20, 22, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleTitle
+    {17, 18, 19, 20, 22, 24, 26, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleDisplay1
+    {28, 30, 32, 34, 36, 38, 40, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleDisplay2
+    {39, 41, 43, 45, 47, 49, 51, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleDisplay3
+    {50, 52, 54, 56, 58, 60, 62, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleDisplay4
+    {100, 104, 108, 112, 116, 120, 124, 0, 0, 0, 0, 0},
+    // MDCFontTextStyleButton
+    {11, 12, 13, 14, 16, 18, 20, 0, 0, 0, 0, 0},
+};
+
+// The weight of each text style, indexed by MDCFontTextStyle.
+static const MDCFontTraitsWeight kWeights[kFontTextStyleCount] = {
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleBody1
+    MDCFontTraitsWeightMedium,   // MDCFontTextStyleBody2
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleCaption
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleHeadline
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleSubheadline
+    MDCFontTraitsWeightMedium,   // MDCFontTextStyleTitle
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleDisplay1
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleDisplay2
+    MDCFontTraitsWeightRegular,  // MDCFontTextStyleDisplay3
+    MDCFontTraitsWeightLight,    // MDCFontTextStyleDisplay4
+    MDCFontTraitsWeightMedium,   // MDCFontTextStyleButton
+};
 
-  _captionTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:16
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
-
-  _display1Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:28
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:30
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:32
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:34
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:36
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:38
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:40
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
-
-  _display2Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:39
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:41
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:43
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:45
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:47
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:49
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:51
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+#pragma clang diagnostic pop
 
-  _display3Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:50
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:52
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:54
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:56
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:58
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:60
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:62
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+// The shared traits of each text style and content size category, indexed as kPointSizes.
+static MDCFontTraits *gTraitsTable[kFontTextStyleCount][MDC_CONTENT_SIZE_CATEGORY_COUNT];
 
-  _display4Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:100
-                                                                        weight:UIFontWeightLight
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:104
-                                                                   weight:UIFontWeightLight
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:108
-                                                                    weight:UIFontWeightLight
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:112
-                                                                   weight:UIFontWeightLight
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:116
-                                                                        weight:UIFontWeightLight
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:120
-                                          weight:UIFontWeightLight
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:124
-                                          weight:UIFontWeightLight
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@interface MDCFontTraits (MaterialTypographyPrivate)
 
-  _headlineTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:21
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:22
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:23
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:24
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:26
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:28
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:30
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+- (instancetype)initWithPointSize:(CGFloat)pointSize
+                           weight:(CGFloat)weight
+                          leading:(CGFloat)leading
+                         tracking:(CGFloat)tracking;
 
-  _subheadlineTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:15
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:18
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:22
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@end
 
-  _titleTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:17
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:18
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:19
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:20
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:22
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:24
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:26
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@implementation MDCFontTraits
 
-  _styleTable = @{
-    @(MDCFontTextStyleBody1) : _body1Traits,
-    @(MDCFontTextStyleBody2) : _body2Traits,
-    @(MDCFontTextStyleButton) : _buttonTraits,
-    @(MDCFontTextStyleCaption) : _captionTraits,
-    @(MDCFontTextStyleDisplay1) : _display1Traits,
-    @(MDCFontTextStyleDisplay2) : _display2Traits,
-    @(MDCFontTextStyleDisplay3) : _display3Traits,
-    @(MDCFontTextStyleDisplay4) : _display4Traits,
-    @(MDCFontTextStyleHeadline) : _headlineTraits,
-    @(MDCFontTextStyleSubheadline) : _subheadlineTraits,
-    @(MDCFontTextStyleTitle) : _titleTraits
-  };
-}
-#pragma clang diagnostic pop
++ (void)initialize {
+  if (self != [MDCFontTraits class]) {
+    return;
+  }
 
-+ (instancetype)traitsWithPointSize:(CGFloat)pointSize
-                             weight:(CGFloat)weight
-                            leading:(CGFloat)leading
-                           tracking:(CGFloat)tracking {
-  return [[MDCFontTraits alloc] initWithPointSize:pointSize
-                                           weight:weight
-                                          leading:leading
-                                         tracking:tracking];
+  for (NSUInteger style = 0; style < kFontTextStyleCount; style++) {
+    CGFloat weight = UIFontWeightRegular;
+    switch (kWeights[style]) {
+      case MDCFontTraitsWeightLight:
+        weight = UIFontWeightLight;
+        break;
+      case MDCFontTraitsWeightRegular:
+        weight = UIFontWeightRegular;
+        break;
+      case MDCFontTraitsWeightMedium:
+        weight = UIFontWeightMedium;
+        break;
+    }
+    for (NSUInteger category = 0; category < MDC_CONTENT_SIZE_CATEGORY_COUNT; category++) {
+      CGFloat pointSize = kPointSizes[style][category];
+      if (pointSize > 0) {
+        gTraitsTable[style][category] = [[MDCFontTraits alloc] initWithPointSize:pointSize
+                                                                          weight:weight
+                                                                         leading:0.0
+                                                                        tracking:0.0];
+      } else {
+        gTraitsTable[style][category] = gTraitsTable[style][kExtraExtraExtraLargeIndex];
+      }
+    }
+  }
 }
 
 - (instancetype)initWithPointSize:(CGFloat)pointSize
@@ -486,23 +141,20 @@ static NSDictionary<NSNumber *, NSDictionary *> *_styleTable;
 
 + (MDCFontTraits *)traitsForTextStyle:(MDCFontTextStyle)style
                          sizeCategory:(NSString *)sizeCategory {
-  NSDictionary *traitsTable = _styleTable[@(style)];
-  NSCAssert(traitsTable, @"traitsTable cannot be nil. Is style valid?");
-
+  BOOL isValidStyle = style >= 0 && style < kFontTextStyleCount;
+  NSCAssert(isValidStyle, @"traitsTable cannot be nil. Is style valid?");
   MDCFontTraits *traits;
-  if (traitsTable) {
-    if (sizeCategory) {
-      traits = traitsTable[sizeCategory];
-    }
-
+  if (isValidStyle) {
     // If you have queried the table for a sizeCategory that doesn't exist, we will return the
     // traits for XXXL.  This handles the case where the values are requested for one of the
     // accessibility size categories beyond XXXL such as
     // UIContentSizeCategoryAccessibilityExtraLarge.  Accessbility size categories are only
     // defined for the Body Font Style.
-    if (traits == nil) {
-      traits = traitsTable[UIContentSizeCategoryExtraExtraExtraLarge];
+    NSUInteger category = MDCContentSizeCategoryIndex(sizeCategory);
+    if (category == NSNotFound) {
+      category = kExtraExtraExtraLargeIndex;
     }
+    traits = gTraitsTable[style][category];
   }
 
   return traits;
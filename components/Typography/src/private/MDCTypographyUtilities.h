@@ -15,3 +15,9 @@
 #import <UIKit/UIKit.h>
 
 UIContentSizeCategory GetCurrentSizeCategory(void);
+
+/**
+ @return The shared application's preferredContentSizeCategory when running in an application,
+ otherwise the main screen's preferred content size category.
+ */
+UIContentSizeCategory GetPreferredSizeCategory(void);
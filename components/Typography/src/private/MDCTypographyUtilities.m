@@ -23,3 +23,12 @@
 UIContentSizeCategory GetCurrentSizeCategory(void) {
   return UIScreen.mainScreen.traitCollection.preferredContentSizeCategory;
 }
+
+UIContentSizeCategory GetPreferredSizeCategory(void) {
+  // If we are within an application, query the preferredContentSizeCategory.
+  UIApplication *application = [UIApplication mdc_safeSharedApplication];
+  if (application) {
+    return application.preferredContentSizeCategory;
+  }
+  return UIScreen.mainScreen.traitCollection.preferredContentSizeCategory;
+}
@@ -15,6 +15,7 @@
 #import <XCTest/XCTest.h>
 
 #import "MDCFontScaler.h"
+#import "MDCFontScalingCurve.h"
 #import "MaterialTypography.h"
 
 @interface UIFont_MaterialScalable : XCTestCase
@@ -182,6 +183,67 @@
   XCTAssertNotNil(bodyScalableFont.mdc_scalingCurve);
 }
 
+- (void)testScalersShareScalingCurveWithScaledFonts {
+  // Given
+  MDCFontScaler *scaler1 = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleHeadline3];
+  MDCFontScaler *scaler2 = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleHeadline3];
+
+  // When
+  UIFont *scaledFont1 = [scaler1 scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+  UIFont *scaledFont2 = [scaler2 scaledFontWithFont:[UIFont systemFontOfSize:12.0]];
+  UIFont *rescaledFont =
+      [scaledFont1 mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraExtraLarge];
+
+  // Then
+  XCTAssertEqual(scaledFont1.mdc_fontScalingCurve, scaledFont2.mdc_fontScalingCurve);
+  XCTAssertEqual(rescaledFont.mdc_fontScalingCurve, scaledFont1.mdc_fontScalingCurve);
+  XCTAssertEqual(scaledFont1.mdc_scalingCurve, scaledFont2.mdc_scalingCurve);
+}
+
+- (void)testScalingCurveDictionaryMatchesScaledPointSizes {
+  // Given
+  MDCFontScaler *scaler = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleSubtitle1];
+  UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+
+  // When
+  NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = scalableFont.mdc_scalingCurve;
+
+  // Then
+  XCTAssertEqual(scalingCurve.count, (NSUInteger)MDC_CONTENT_SIZE_CATEGORY_COUNT);
+  for (UIContentSizeCategory sizeCategory in scalingCurve) {
+    UIFont *scaledFont = [scalableFont mdc_scaledFontForSizeCategory:sizeCategory];
+    XCTAssertEqualWithAccuracy(scaledFont.pointSize, scalingCurve[sizeCategory].doubleValue,
+                               0.0001);
+  }
+}
+
+- (void)testContentSizeCategoryIndex {
+  XCTAssertEqual(MDCContentSizeCategoryIndex(UIContentSizeCategoryExtraSmall), 0U);
+  XCTAssertEqual(MDCContentSizeCategoryIndex(UIContentSizeCategoryLarge), 3U);
+  XCTAssertEqual(MDCContentSizeCategoryIndex(UIContentSizeCategoryLarge), 3U);
+  XCTAssertEqual(MDCContentSizeCategoryIndex([UIContentSizeCategoryLarge mutableCopy]), 3U);
+  XCTAssertEqual(
+      MDCContentSizeCategoryIndex(UIContentSizeCategoryAccessibilityExtraExtraExtraLarge), 11U);
+  XCTAssertEqual(MDCContentSizeCategoryIndex(UIContentSizeCategoryUnspecified),
+                 (NSUInteger)NSNotFound);
+  XCTAssertEqual(MDCContentSizeCategoryIndex(nil), (NSUInteger)NSNotFound);
+}
+
+- (void)testPerformanceScalingFontsAcrossSizeCategories {
+  // Given
+  MDCFontScaler *scaler = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleBody1];
+  UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 500; i++) {
+      [scalableFont mdc_scaledFontForSizeCategory:i % 2 ? UIContentSizeCategoryExtraLarge
+                                                        : UIContentSizeCategorySmall];
+      [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleButton];
+    }
+  }];
+}
+
 @end
 
 @interface MaterialScalableFontTests : XCTestCase
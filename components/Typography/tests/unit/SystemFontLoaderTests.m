@@ -108,4 +108,67 @@
 #pragma clang diagnostic pop
 }
 
+- (void)testCachedFontsAreReused {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  // When
+  UIFont *regular = [fontLoader regularFontOfSize:14];
+  UIFont *bold = [fontLoader boldFontOfSize:14];
+
+  // Then
+  XCTAssertEqual([fontLoader regularFontOfSize:14], regular);
+  XCTAssertEqual([fontLoader boldFontOfSize:14], bold);
+  XCTAssertNotEqual(regular, bold);
+  XCTAssertEqualWithAccuracy([fontLoader regularFontOfSize:(CGFloat)14.5].pointSize, 14.5, 0.001);
+}
+
+- (void)testFontsAreCorrectAfterCacheFillsUp {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  // When
+  for (NSUInteger i = 0; i < 200; i++) {
+    [fontLoader mediumFontOfSize:(CGFloat)i / 4 + 8];
+  }
+
+  // Then
+  for (NSUInteger i = 0; i < 200; i++) {
+    CGFloat size = (CGFloat)i / 4 + 8;
+    XCTAssertEqualWithAccuracy([fontLoader mediumFontOfSize:size].pointSize, size, 0.001);
+  }
+}
+
+- (void)testMemoryWarningEmptiesCache {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  UIFont *font = [fontLoader lightFontOfSize:12];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIApplicationDidReceiveMemoryWarningNotification
+                    object:nil];
+
+  // Then
+  UIFont *reloadedFont = [fontLoader lightFontOfSize:12];
+  XCTAssertEqualObjects(reloadedFont, font);
+}
+
+- (void)testPerformanceScrollingFontLookups {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  CGFloat sizes[] = {12, 14, 16, 20, 24};
+
+  // Then
+  // Simulates cells being configured during scrolling, each asking for a few fonts.
+  [self measureBlock:^{
+    for (NSUInteger cell = 0; cell < 10000; cell++) {
+      CGFloat size = sizes[cell % 5];
+      [fontLoader regularFontOfSize:size];
+      [fontLoader mediumFontOfSize:size];
+      [fontLoader boldFontOfSize:size - 2];
+    }
+  }];
+}
+
 @end
@@ -61,4 +61,52 @@
   XCTAssertGreaterThan(scaledFont.pointSize, font.pointSize);
 }
 
+- (void)testMDC_preferredFontForMaterialTextStyleReturnsCachedFonts {
+  // Given
+  NSArray<NSNumber *> *textStyles = @[
+    @(MDCFontTextStyleTitle), @(MDCFontTextStyleBody1), @(MDCFontTextStyleBody2),
+    @(MDCFontTextStyleButton), @(MDCFontTextStyleCaption), @(MDCFontTextStyleDisplay1),
+    @(MDCFontTextStyleDisplay2), @(MDCFontTextStyleDisplay3), @(MDCFontTextStyleDisplay4),
+    @(MDCFontTextStyleHeadline), @(MDCFontTextStyleSubheadline)
+  ];
+
+  for (NSNumber *textStyleNumber in textStyles) {
+    MDCFontTextStyle textStyle = [textStyleNumber integerValue];
+
+    // When
+    UIFont *font1 = [UIFont mdc_preferredFontForMaterialTextStyle:textStyle];
+    UIFont *font2 = [UIFont mdc_preferredFontForMaterialTextStyle:textStyle];
+
+    // Then
+    XCTAssertEqual(font1, font2);
+    XCTAssertEqualWithAccuracy(
+        font1.pointSize,
+        [UIFontDescriptor mdc_preferredFontDescriptorForMaterialTextStyle:textStyle].pointSize,
+        0.001);
+  }
+}
+
+- (void)testMDC_preferredFontForMaterialTextStyleIsUnchangedAfterCacheFlush {
+  // Given
+  UIFont *font = [UIFont mdc_preferredFontForMaterialTextStyle:MDCFontTextStyleBody1];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIContentSizeCategoryDidChangeNotification
+                    object:nil];
+
+  // Then
+  UIFont *recreatedFont = [UIFont mdc_preferredFontForMaterialTextStyle:MDCFontTextStyleBody1];
+  XCTAssertEqualObjects(recreatedFont.fontName, font.fontName);
+  XCTAssertEqualWithAccuracy(recreatedFont.pointSize, font.pointSize, 0.001);
+}
+
+- (void)testPerformancePreferredFontForMaterialTextStyle {
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 10000; i++) {
+      [UIFont mdc_preferredFontForMaterialTextStyle:(MDCFontTextStyle)(i % 11)];
+    }
+  }];
+}
+
 @end
@@ -0,0 +1,43 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MDCColorBlending.h"
+
+/**
+ Blends one color channel with the background color channel using alpha composition:
+
+   channel = ((1 - alpha) * bChannel * bAlpha + alpha * channel) / (alpha + bAlpha * (1 - alpha))
+ */
+static inline double MDCBlendChannel(double channel, double alpha, double bChannel, double bAlpha,
+                                     double blendedAlpha) {
+  return ((1 - alpha) * bChannel * bAlpha + alpha * channel) / blendedAlpha;
+}
+
+MDCRGBAColor MDCBlendRGBAColor(MDCRGBAColor color, MDCRGBAColor backgroundColor) {
+  double alpha = color.alpha;
+  double bAlpha = backgroundColor.alpha;
+  double blendedAlpha = alpha + bAlpha * (1 - alpha);
+  return MDCRGBAColorMake(
+      MDCBlendChannel(color.red, alpha, backgroundColor.red, bAlpha, blendedAlpha),
+      MDCBlendChannel(color.green, alpha, backgroundColor.green, bAlpha, blendedAlpha),
+      MDCBlendChannel(color.blue, alpha, backgroundColor.blue, bAlpha, blendedAlpha),
+      blendedAlpha);
+}
+
+void MDCBlendRGBAColors(const MDCRGBAColor *colors, const MDCRGBAColor *backgroundColors,
+                        MDCRGBAColor *results, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    results[i] = MDCBlendRGBAColor(colors[i], backgroundColors[i]);
+  }
+}
@@ -0,0 +1,64 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MDCColorBlending_h
+#define MDCColorBlending_h
+
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/** An RGBA color with straight (non-premultiplied) components in the range [0, 1]. */
+typedef struct MDCRGBAColor {
+  double red;
+  double green;
+  double blue;
+  double alpha;
+} MDCRGBAColor;
+
+static inline MDCRGBAColor MDCRGBAColorMake(double red, double green, double blue, double alpha) {
+  MDCRGBAColor color = {red, green, blue, alpha};
+  return color;
+}
+
+/**
+ Blends a color over a background color using the "source over" alpha compositing operator.
+ More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
+
+ @param color The color that sits on top.
+ @param backgroundColor The color in the background.
+ @return The composited color.
+ */
+MDCRGBAColor MDCBlendRGBAColor(MDCRGBAColor color, MDCRGBAColor backgroundColor);
+
+/**
+ Blends @c count colors over their corresponding background colors.
+
+ @c results may alias @c colors or @c backgroundColors.
+
+ @param colors The colors that sit on top.
+ @param backgroundColors The colors in the background, one per color.
+ @param results Receives the composited colors, one per color.
+ @param count The number of color pairs.
+ */
+void MDCBlendRGBAColors(const MDCRGBAColor *colors, const MDCRGBAColor *backgroundColors,
+                        MDCRGBAColor *results, size_t count);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif  // MDCColorBlending_h
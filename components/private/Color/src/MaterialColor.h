@@ -12,5 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "MDCColorBlending.h"  // IWYU pragma: keep
 #import "UIColor+MaterialBlending.h"  // IWYU pragma: keep
 #import "UIColor+MaterialDynamic.h"  // IWYU pragma: keep
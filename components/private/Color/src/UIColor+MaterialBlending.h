@@ -14,6 +14,8 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MDCColorBlending.h"
+
 @interface UIColor (MaterialBlending)
 
 /**
@@ -26,4 +28,27 @@
 + (nonnull UIColor *)mdc_blendColor:(nonnull UIColor *)color
                 withBackgroundColor:(nonnull UIColor *)backgroundColor;
 
+/**
+ Blends each color over the background color at the same index using Alpha compositing technique.
+
+ The components of all colors are extracted once and blended in a single batch by
+ MDCBlendRGBAColors.
+
+ @param colors UIColor values that sit on top.
+ @param backgroundColors UIColors on the background. Must have the same count as @c colors.
+ */
++ (nonnull NSArray<UIColor *> *)mdc_blendColors:(nonnull NSArray<UIColor *> *)colors
+                           withBackgroundColors:(nonnull NSArray<UIColor *> *)backgroundColors;
+
+/**
+ Returns a color with the given RGBA components.
+ */
++ (nonnull UIColor *)mdc_colorWithRGBAColor:(MDCRGBAColor)rgbaColor;
+
+/**
+ The receiver's components in the RGB color space. Colors that can not be converted to RGB have all
+ components set to zero.
+ */
+@property(nonatomic, readonly) MDCRGBAColor mdc_RGBAColor;
+
 @end
@@ -14,32 +14,56 @@
 
 #import "UIColor+MaterialBlending.h"
 
-/**
- Helper method to blend a color channel with a background color channel using alpha composition.
- More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
-
- @params value is the value of color channel
- @params bValue is the value of background color channel
- @params alpha is the alpha of color channel
- @params bAlpha is the alpha of background color channel
- */
-
-static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, CGFloat bAlpha) {
-  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
-}
-
 @implementation UIColor (MaterialBlending)
 
 + (UIColor *)mdc_blendColor:(UIColor *)color withBackgroundColor:(UIColor *)backgroundColor {
+  return [UIColor
+      mdc_colorWithRGBAColor:MDCBlendRGBAColor(color.mdc_RGBAColor, backgroundColor.mdc_RGBAColor)];
+}
+
++ (NSArray<UIColor *> *)mdc_blendColors:(NSArray<UIColor *> *)colors
+                   withBackgroundColors:(NSArray<UIColor *> *)backgroundColors {
+  NSParameterAssert(colors.count == backgroundColors.count);
+  NSUInteger count = MIN(colors.count, backgroundColors.count);
+  if (count == 0) {
+    return @[];
+  }
+
+  NSMutableArray<UIColor *> *blendedColors = [NSMutableArray arrayWithCapacity:count];
+  MDCRGBAColor *rgbaColors = malloc(2 * count * sizeof(MDCRGBAColor));
+  if (rgbaColors == NULL) {
+    // Without a buffer for the batch, blend the colors one pair at a time.
+    for (NSUInteger i = 0; i < count; i++) {
+      [blendedColors addObject:[UIColor mdc_blendColor:colors[i]
+                                   withBackgroundColor:backgroundColors[i]]];
+    }
+    return blendedColors;
+  }
+  MDCRGBAColor *rgbaBackgroundColors = rgbaColors + count;
+  for (NSUInteger i = 0; i < count; i++) {
+    rgbaColors[i] = colors[i].mdc_RGBAColor;
+    rgbaBackgroundColors[i] = backgroundColors[i].mdc_RGBAColor;
+  }
+  MDCBlendRGBAColors(rgbaColors, rgbaBackgroundColors, rgbaColors, count);
+
+  for (NSUInteger i = 0; i < count; i++) {
+    [blendedColors addObject:[UIColor mdc_colorWithRGBAColor:rgbaColors[i]]];
+  }
+  free(rgbaColors);
+  return blendedColors;
+}
+
++ (UIColor *)mdc_colorWithRGBAColor:(MDCRGBAColor)rgbaColor {
+  return [UIColor colorWithRed:(CGFloat)rgbaColor.red
+                         green:(CGFloat)rgbaColor.green
+                          blue:(CGFloat)rgbaColor.blue
+                         alpha:(CGFloat)rgbaColor.alpha];
+}
+
+- (MDCRGBAColor)mdc_RGBAColor {
   CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
-  [color getRed:&red green:&green blue:&blue alpha:&alpha];
-  CGFloat bRed = 0.0, bGreen = 0.0, bBlue = 0.0, bAlpha = 0.0;
-  [backgroundColor getRed:&bRed green:&bGreen blue:&bBlue alpha:&bAlpha];
-
-  return [UIColor colorWithRed:blendColorChannel(red, bRed, alpha, bAlpha)
-                         green:blendColorChannel(green, bGreen, alpha, bAlpha)
-                          blue:blendColorChannel(blue, bBlue, alpha, bAlpha)
-                         alpha:alpha + bAlpha * (1 - alpha)];
+  [self getRed:&red green:&green blue:&blue alpha:&alpha];
+  return MDCRGBAColorMake(red, green, blue, alpha);
 }
 
 @end
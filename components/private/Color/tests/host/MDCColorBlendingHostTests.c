@@ -0,0 +1,118 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Checks the blend math in MDCColorBlending.c and reports its per-color cost. Run with
+// scripts/test_host.
+
+#include <float.h>
+#include <stdlib.h>
+
+#include "../../src/MDCColorBlending.h"
+#include "MDCHostTest.h"
+
+#define BENCHMARK_COLOR_COUNT 100000
+
+static void ExpectColorNear(MDCRGBAColor actual, MDCRGBAColor expected) {
+  MDC_HOST_EXPECT_NEAR(actual.red, expected.red, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(actual.green, expected.green, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(actual.blue, expected.blue, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(actual.alpha, expected.alpha, DBL_EPSILON);
+}
+
+static void TestBlendMatchesAlphaCompositing(void) {
+  MDCRGBAColor result = MDCBlendRGBAColor(MDCRGBAColorMake(0.1, 0.8, 0.8, 0.2),
+                                          MDCRGBAColorMake(0.4, 0.6, 0.9, 0.8));
+
+  ExpectColorNear(result, MDCRGBAColorMake(0.32857142857142863, 0.64761904761904765,
+                                           0.87619047619047618, 0.84000000000000008));
+}
+
+static void TestOpaqueColorHidesBackground(void) {
+  MDCRGBAColor color = MDCRGBAColorMake(0.2, 0.4, 0.6, 1);
+
+  ExpectColorNear(MDCBlendRGBAColor(color, MDCRGBAColorMake(0.9, 0.1, 0.5, 0.3)), color);
+}
+
+static void TestTransparentColorShowsBackground(void) {
+  MDCRGBAColor backgroundColor = MDCRGBAColorMake(0.9, 0.1, 0.5, 1);
+
+  ExpectColorNear(MDCBlendRGBAColor(MDCRGBAColorMake(0.2, 0.4, 0.6, 0), backgroundColor),
+                  backgroundColor);
+}
+
+static void TestHalfTransparentBlackOverWhiteIsGray(void) {
+  MDCRGBAColor result =
+      MDCBlendRGBAColor(MDCRGBAColorMake(0, 0, 0, 0.5), MDCRGBAColorMake(1, 1, 1, 1));
+
+  ExpectColorNear(result, MDCRGBAColorMake(0.5, 0.5, 0.5, 1));
+}
+
+static void TestBatchBlendMatchesSingleBlendInPlace(void) {
+  MDCRGBAColor colors[3] = {
+      MDCRGBAColorMake(0, 0, 0, 0.5),
+      MDCRGBAColorMake(1, 1, 1, 0.12),
+      MDCRGBAColorMake(0.1, 0.8, 0.8, 0.2),
+  };
+  MDCRGBAColor backgroundColors[3] = {
+      MDCRGBAColorMake(1, 1, 1, 1),
+      MDCRGBAColorMake(0.07, 0.07, 0.07, 1),
+      MDCRGBAColorMake(0.4, 0.6, 0.9, 0.8),
+  };
+  MDCRGBAColor expected[3];
+  for (size_t i = 0; i < 3; i++) {
+    expected[i] = MDCBlendRGBAColor(colors[i], backgroundColors[i]);
+  }
+
+  MDCBlendRGBAColors(colors, backgroundColors, colors, 3);
+
+  for (size_t i = 0; i < 3; i++) {
+    ExpectColorNear(colors[i], expected[i]);
+  }
+}
+
+static void BenchmarkBatchBlend(void) {
+  MDCRGBAColor *colors = malloc(BENCHMARK_COLOR_COUNT * sizeof(MDCRGBAColor));
+  MDCRGBAColor *backgroundColors = malloc(BENCHMARK_COLOR_COUNT * sizeof(MDCRGBAColor));
+  MDCRGBAColor *results = malloc(BENCHMARK_COLOR_COUNT * sizeof(MDCRGBAColor));
+  if (colors == NULL || backgroundColors == NULL || results == NULL) {
+    free(colors);
+    free(backgroundColors);
+    free(results);
+    return;
+  }
+  for (size_t i = 0; i < BENCHMARK_COLOR_COUNT; i++) {
+    double value = (double)(i % 256) / 255;
+    colors[i] = MDCRGBAColorMake(1, 1, 1, value * 0.16);
+    backgroundColors[i] = MDCRGBAColorMake(value, value, value, 1);
+  }
+
+  double start = MDCHostTestNanoseconds();
+  MDCBlendRGBAColors(colors, backgroundColors, results, BENCHMARK_COLOR_COUNT);
+  double elapsed = MDCHostTestNanoseconds() - start;
+  MDCHostTestReportCost("MDCBlendRGBAColors", elapsed, BENCHMARK_COLOR_COUNT);
+
+  free(colors);
+  free(backgroundColors);
+  free(results);
+}
+
+int main(void) {
+  TestBlendMatchesAlphaCompositing();
+  TestOpaqueColorHidesBackground();
+  TestTransparentColorShowsBackground();
+  TestHalfTransparentBlackOverWhiteIsGray();
+  TestBatchBlendMatchesSingleBlendInPlace();
+  BenchmarkBatchBlend();
+  return MDCHostTestExitStatus();
+}
@@ -0,0 +1,125 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCColorBlending.h"
+#import "UIColor+MaterialBlending.h"
+
+static const size_t kBenchmarkColorCount = 100000;
+
+@interface MDCColorBlendingTests : XCTestCase
+@end
+
+@implementation MDCColorBlendingTests
+
+- (void)testBlendMatchesAlphaCompositing {
+  // Given
+  MDCRGBAColor color = MDCRGBAColorMake(0.1, 0.8, 0.8, 0.2);
+  MDCRGBAColor backgroundColor = MDCRGBAColorMake(0.4, 0.6, 0.9, 0.8);
+
+  // When
+  MDCRGBAColor result = MDCBlendRGBAColor(color, backgroundColor);
+
+  // Then
+  XCTAssertEqualWithAccuracy(result.red, 0.32857142857142863, DBL_EPSILON);
+  XCTAssertEqualWithAccuracy(result.green, 0.64761904761904765, DBL_EPSILON);
+  XCTAssertEqualWithAccuracy(result.blue, 0.87619047619047618, DBL_EPSILON);
+  XCTAssertEqualWithAccuracy(result.alpha, 0.84000000000000008, DBL_EPSILON);
+}
+
+- (void)testBatchBlendMatchesSingleBlend {
+  // Given
+  MDCRGBAColor colors[3] = {
+      MDCRGBAColorMake(0, 0, 0, 0.5),
+      MDCRGBAColorMake(1, 1, 1, 0.12),
+      MDCRGBAColorMake(0.1, 0.8, 0.8, 0.2),
+  };
+  MDCRGBAColor backgroundColors[3] = {
+      MDCRGBAColorMake(1, 1, 1, 1),
+      MDCRGBAColorMake(0.07, 0.07, 0.07, 1),
+      MDCRGBAColorMake(0.4, 0.6, 0.9, 0.8),
+  };
+  MDCRGBAColor results[3];
+
+  // When
+  MDCBlendRGBAColors(colors, backgroundColors, results, 3);
+
+  // Then
+  for (size_t i = 0; i < 3; i++) {
+    MDCRGBAColor expected = MDCBlendRGBAColor(colors[i], backgroundColors[i]);
+    XCTAssertEqual(results[i].red, expected.red);
+    XCTAssertEqual(results[i].green, expected.green);
+    XCTAssertEqual(results[i].blue, expected.blue);
+    XCTAssertEqual(results[i].alpha, expected.alpha);
+  }
+}
+
+- (void)testUIColorBatchBlendMatchesSingleBlend {
+  // Given
+  NSArray<UIColor *> *colors = @[
+    [UIColor colorWithRed:0 green:0 blue:0 alpha:(CGFloat)0.5],
+    [UIColor colorWithWhite:1 alpha:(CGFloat)0.3]
+  ];
+  NSArray<UIColor *> *backgroundColors = @[ UIColor.whiteColor, UIColor.blackColor ];
+
+  // When
+  NSArray<UIColor *> *results = [UIColor mdc_blendColors:colors
+                                    withBackgroundColors:backgroundColors];
+
+  // Then
+  XCTAssertEqual(results.count, 2U);
+  XCTAssertEqualObjects(results[0], [UIColor mdc_blendColor:colors[0]
+                                        withBackgroundColor:backgroundColors[0]]);
+  XCTAssertEqualObjects(results[1], [UIColor mdc_blendColor:colors[1]
+                                        withBackgroundColor:backgroundColors[1]]);
+}
+
+- (void)testPerformanceBatchBlend {
+  // Given
+  MDCRGBAColor *colors = malloc(kBenchmarkColorCount * sizeof(MDCRGBAColor));
+  MDCRGBAColor *backgroundColors = malloc(kBenchmarkColorCount * sizeof(MDCRGBAColor));
+  MDCRGBAColor *results = malloc(kBenchmarkColorCount * sizeof(MDCRGBAColor));
+  for (size_t i = 0; i < kBenchmarkColorCount; i++) {
+    double value = (double)(i % 256) / 255;
+    colors[i] = MDCRGBAColorMake(1, 1, 1, value * 0.16);
+    backgroundColors[i] = MDCRGBAColorMake(value, value, value, 1);
+  }
+
+  // Then
+  [self measureBlock:^{
+    MDCBlendRGBAColors(colors, backgroundColors, results, kBenchmarkColorCount);
+  }];
+  free(colors);
+  free(backgroundColors);
+  free(results);
+}
+
+- (void)testPerformanceUIColorBlend {
+  // Given
+  UIColor *color = [UIColor colorWithWhite:1 alpha:(CGFloat)0.12];
+  UIColor *backgroundColor = [UIColor colorWithRed:(CGFloat)0.07
+                                             green:(CGFloat)0.07
+                                              blue:(CGFloat)0.07
+                                             alpha:1];
+
+  // Then
+  [self measureBlock:^{
+    for (size_t i = 0; i < kBenchmarkColorCount / 10; i++) {
+      [UIColor mdc_blendColor:color withBackgroundColor:backgroundColor];
+    }
+  }];
+}
+
+@end
@@ -0,0 +1,70 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "MDCIcons.h"
+
+/** Returns the path of an icon drawn to fill @c frame. */
+typedef UIBezierPath *_Nonnull (^MDCProceduralIconPathProvider)(CGRect frame);
+
+/**
+ Icons that are drawn from a vector path at runtime instead of being loaded from a bundle.
+
+ Components register the path of each icon once under a name of their choosing. The rasterized
+ template images are then shared by every caller in the process, so a screen full of chips draws
+ its delete icon once rather than once per chip. Images are evicted under memory pressure and
+ redrawn on demand.
+ */
+@interface MDCIcons (Procedural)
+
+/**
+ Registers the path of a procedural icon. Registering a name that is already registered has no
+ effect, so components can register their icons lazily from any code path.
+ */
++ (void)registerProceduralIconNamed:(nonnull NSString *)iconName
+                       pathProvider:(nonnull MDCProceduralIconPathProvider)pathProvider;
+
+/**
+ Returns the template image of a registered procedural icon, filled at the given opacity.
+
+ @param iconName The name the icon was registered under.
+ @param size The size of the image in points. The path is drawn to fill this size.
+ @param opacity The alpha the path is filled with, which template rendering multiplies with the
+                tint color.
+ @param scale The scale of the image, or 0 for the main screen's scale.
+ @return The shared image, or nil if no icon is registered under @c iconName.
+ */
++ (nullable UIImage *)templateImageForProceduralIconNamed:(nonnull NSString *)iconName
+                                                     size:(CGSize)size
+                                                  opacity:(CGFloat)opacity
+                                                    scale:(CGFloat)scale;
+
+@end
+
+/**
+ The number of procedural icon images drawn since launch or the last call to
+ @c MDCProceduralIconResetDrawCount.
+ */
+FOUNDATION_EXTERN NSUInteger MDCProceduralIconDrawCount(void);
+
+/**
+ Resets the procedural icon draw counter to zero.
+ */
+FOUNDATION_EXTERN void MDCProceduralIconResetDrawCount(void);
+
+/**
+ Empties the shared procedural icon image cache. Registered paths are kept.
+ */
+FOUNDATION_EXTERN void MDCProceduralIconRemoveAllImages(void);
@@ -0,0 +1,173 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCIcons+Procedural.h"
+
+#import <UIKit/UIKit.h>
+#import <os/lock.h>
+
+static os_unfair_lock gProceduralIconLock = OS_UNFAIR_LOCK_INIT;
+static NSUInteger gProceduralIconDrawCount = 0;
+
+/** The inputs that determine a procedural icon image. */
+@interface MDCProceduralIconKey : NSObject <NSCopying>
+- (instancetype)initWithIconName:(NSString *)iconName
+                            size:(CGSize)size
+                         opacity:(CGFloat)opacity
+                           scale:(CGFloat)scale;
+@end
+
+@implementation MDCProceduralIconKey {
+ @public
+  NSString *_iconName;
+  CGSize _size;
+  CGFloat _opacity;
+  CGFloat _scale;
+}
+
+- (instancetype)initWithIconName:(NSString *)iconName
+                            size:(CGSize)size
+                         opacity:(CGFloat)opacity
+                           scale:(CGFloat)scale {
+  self = [super init];
+  if (self) {
+    _iconName = [iconName copy];
+    _size = size;
+    _opacity = opacity;
+    _scale = scale;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCProceduralIconKey class]]) {
+    return NO;
+  }
+  MDCProceduralIconKey *key = object;
+  return [_iconName isEqualToString:key->_iconName] && CGSizeEqualToSize(_size, key->_size) &&
+         _opacity == key->_opacity && _scale == key->_scale;
+}
+
+- (NSUInteger)hash {
+  return _iconName.hash ^ ((NSUInteger)_size.width << 8) ^ ((NSUInteger)_size.height << 16) ^
+         ((NSUInteger)(_opacity * 255) << 24) ^ (NSUInteger)_scale;
+}
+
+@end
+
+static NSMutableDictionary<NSString *, MDCProceduralIconPathProvider> *
+MDCProceduralIconPathProviders(void) {
+  static NSMutableDictionary *pathProviders;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    pathProviders = [[NSMutableDictionary alloc] init];
+  });
+  return pathProviders;
+}
+
+static NSCache<MDCProceduralIconKey *, UIImage *> *MDCProceduralIconCache(void) {
+  static NSCache *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [[NSCache alloc] init];
+    // NSCache only evicts when the whole process is under pressure; drop the icons as soon as the
+    // app is warned since they are cheap to redraw.
+    [[NSNotificationCenter defaultCenter]
+        addObserverForName:UIApplicationDidReceiveMemoryWarningNotification
+                    object:nil
+                     queue:nil
+                usingBlock:^(NSNotification *notification) {
+                  [cache removeAllObjects];
+                }];
+  });
+  return cache;
+}
+
+static UIImage *MDCDrawProceduralIcon(MDCProceduralIconPathProvider pathProvider,
+                                      MDCProceduralIconKey *key) {
+  CGRect bounds = CGRectMake(0, 0, key->_size.width, key->_size.height);
+  UIGraphicsBeginImageContextWithOptions(bounds.size, NO, key->_scale);
+  [[UIColor colorWithWhite:0 alpha:key->_opacity] setFill];
+  [pathProvider(bounds) fill];
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  return [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+}
+
+@implementation MDCIcons (Procedural)
+
++ (void)registerProceduralIconNamed:(NSString *)iconName
+                       pathProvider:(MDCProceduralIconPathProvider)pathProvider {
+  NSMutableDictionary<NSString *, MDCProceduralIconPathProvider> *pathProviders =
+      MDCProceduralIconPathProviders();
+  os_unfair_lock_lock(&gProceduralIconLock);
+  if (!pathProviders[iconName]) {
+    pathProviders[iconName] = [pathProvider copy];
+  }
+  os_unfair_lock_unlock(&gProceduralIconLock);
+}
+
++ (UIImage *)templateImageForProceduralIconNamed:(NSString *)iconName
+                                            size:(CGSize)size
+                                         opacity:(CGFloat)opacity
+                                           scale:(CGFloat)scale {
+  if (scale <= 0) {
+    scale = UIScreen.mainScreen.scale;
+  }
+  MDCProceduralIconKey *key = [[MDCProceduralIconKey alloc] initWithIconName:iconName
+                                                                        size:size
+                                                                     opacity:opacity
+                                                                       scale:scale];
+  NSCache<MDCProceduralIconKey *, UIImage *> *cache = MDCProceduralIconCache();
+  UIImage *image = [cache objectForKey:key];
+  if (image) {
+    return image;
+  }
+
+  os_unfair_lock_lock(&gProceduralIconLock);
+  MDCProceduralIconPathProvider pathProvider = MDCProceduralIconPathProviders()[iconName];
+  os_unfair_lock_unlock(&gProceduralIconLock);
+  NSAssert(pathProvider, @"No procedural icon is registered under the name %@.", iconName);
+  if (!pathProvider || size.width <= 0 || size.height <= 0) {
+    return nil;
+  }
+
+  image = MDCDrawProceduralIcon(pathProvider, key);
+  if (image) {
+    gProceduralIconDrawCount++;
+    [cache setObject:image forKey:key];
+  }
+  return image;
+}
+
+@end
+
+NSUInteger MDCProceduralIconDrawCount(void) {
+  return gProceduralIconDrawCount;
+}
+
+void MDCProceduralIconResetDrawCount(void) {
+  gProceduralIconDrawCount = 0;
+}
+
+void MDCProceduralIconRemoveAllImages(void) {
+  [MDCProceduralIconCache() removeAllObjects];
+}
@@ -13,4 +13,5 @@
 // limitations under the License.
 
 #import "MDCIcons+BundleLoader.h"  // IWYU pragma: keep
+#import "MDCIcons+Procedural.h"  // IWYU pragma: keep
 #import "MDCIcons.h"  // IWYU pragma: keep
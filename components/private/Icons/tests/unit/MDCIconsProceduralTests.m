@@ -0,0 +1,172 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCIcons+Procedural.h"
+
+static NSString *const kSquareIconName = @"MDCIconsProceduralTestsSquare";
+static NSString *const kCircleIconName = @"MDCIconsProceduralTestsCircle";
+static const NSUInteger kBenchmarkButtonCount = 200;
+
+@interface MDCIconsProceduralTests : XCTestCase
+@end
+
+@implementation MDCIconsProceduralTests
+
++ (void)setUp {
+  [super setUp];
+
+  [MDCIcons registerProceduralIconNamed:kSquareIconName
+                           pathProvider:^UIBezierPath *(CGRect frame) {
+                             return [UIBezierPath bezierPathWithRect:frame];
+                           }];
+  [MDCIcons registerProceduralIconNamed:kCircleIconName
+                           pathProvider:^UIBezierPath *(CGRect frame) {
+                             return [UIBezierPath bezierPathWithOvalInRect:frame];
+                           }];
+}
+
+- (void)setUp {
+  [super setUp];
+
+  MDCProceduralIconRemoveAllImages();
+  MDCProceduralIconResetDrawCount();
+}
+
+- (void)tearDown {
+  MDCProceduralIconRemoveAllImages();
+  MDCProceduralIconResetDrawCount();
+
+  [super tearDown];
+}
+
+- (void)testImageIsTemplateWithRequestedSizeAndScale {
+  // When
+  UIImage *image = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                            size:CGSizeMake(18, 24)
+                                                         opacity:1
+                                                           scale:2];
+
+  // Then
+  XCTAssertEqual(image.renderingMode, UIImageRenderingModeAlwaysTemplate);
+  XCTAssertTrue(CGSizeEqualToSize(image.size, CGSizeMake(18, 24)));
+  XCTAssertEqual(image.scale, 2);
+}
+
+- (void)testRepeatedRequestsShareOneImage {
+  // When
+  UIImage *firstImage = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                                 size:CGSizeMake(18, 18)
+                                                              opacity:1
+                                                                scale:2];
+  UIImage *secondImage = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                                  size:CGSizeMake(18, 18)
+                                                               opacity:1
+                                                                 scale:2];
+
+  // Then
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(MDCProceduralIconDrawCount(), 1U);
+}
+
+- (void)testDistinctInputsDrawDistinctImages {
+  // When
+  UIImage *image = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                            size:CGSizeMake(18, 18)
+                                                         opacity:1
+                                                           scale:2];
+  UIImage *otherIconImage = [MDCIcons templateImageForProceduralIconNamed:kCircleIconName
+                                                                     size:CGSizeMake(18, 18)
+                                                                  opacity:1
+                                                                    scale:2];
+  UIImage *otherSizeImage = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                                     size:CGSizeMake(24, 24)
+                                                                  opacity:1
+                                                                    scale:2];
+  UIImage *otherOpacityImage = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                                        size:CGSizeMake(18, 18)
+                                                                     opacity:(CGFloat)0.54
+                                                                       scale:2];
+  UIImage *otherScaleImage = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                                      size:CGSizeMake(18, 18)
+                                                                   opacity:1
+                                                                     scale:3];
+
+  // Then
+  NSSet *images =
+      [NSSet setWithObjects:image, otherIconImage, otherSizeImage, otherOpacityImage,
+                            otherScaleImage, nil];
+  XCTAssertEqual(images.count, 5U);
+  XCTAssertEqual(MDCProceduralIconDrawCount(), 5U);
+}
+
+- (void)testRegisteringANameTwiceKeepsTheFirstPath {
+  // Given
+  UIImage *image = [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                            size:CGSizeMake(18, 18)
+                                                         opacity:1
+                                                           scale:2];
+
+  // When
+  [MDCIcons registerProceduralIconNamed:kSquareIconName
+                           pathProvider:^UIBezierPath *(CGRect frame) {
+                             return [UIBezierPath bezierPath];
+                           }];
+
+  // Then
+  XCTAssertEqual([MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                                          size:CGSizeMake(18, 18)
+                                                       opacity:1
+                                                         scale:2],
+                 image);
+}
+
+- (void)testMemoryWarningEvictsImages {
+  // Given
+  [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                           size:CGSizeMake(18, 18)
+                                        opacity:1
+                                          scale:2];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIApplicationDidReceiveMemoryWarningNotification
+                    object:nil];
+  [MDCIcons templateImageForProceduralIconNamed:kSquareIconName
+                                           size:CGSizeMake(18, 18)
+                                        opacity:1
+                                          scale:2];
+
+  // Then
+  XCTAssertEqual(MDCProceduralIconDrawCount(), 2U);
+}
+
+#pragma mark - Performance
+
+/** Simulates a screen of chips that each ask for their delete icon. */
+- (void)testPerformanceManyButtonsRequestingTheSameIcon {
+  [self measureBlock:^{
+    MDCProceduralIconRemoveAllImages();
+    for (NSUInteger i = 0; i < kBenchmarkButtonCount; i++) {
+      UIImage *image = [MDCIcons templateImageForProceduralIconNamed:kCircleIconName
+                                                                size:CGSizeMake(18, 18)
+                                                             opacity:1
+                                                               scale:0];
+      XCTAssertNotNil(image);
+    }
+  }];
+}
+
+@end
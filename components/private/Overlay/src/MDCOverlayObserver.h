@@ -14,6 +14,27 @@
 
 #import <UIKit/UIKit.h>
 
+/**
+ A change to a single overlay's frame, and how the resulting transition should be animated.
+
+ This is the typed equivalent of the user info dictionary of @c MDCOverlayDidChangeNotification.
+ */
+typedef struct MDCOverlayFrameChange {
+  /** The frame of the overlay in screen coordinates, or an empty rect if it is not on screen. */
+  CGRect frame;
+  /** Whether @c duration and @c curve describe the transition. If NO, they are ignored. */
+  BOOL specifiesAnimation;
+  /** The duration of the transition animation. 0 means the transition is not animated. */
+  NSTimeInterval duration;
+  /** The curve of the transition animation, if no timing function is provided. */
+  UIViewAnimationCurve curve;
+  /**
+   Whether the transition needs to run immediately rather than being coalesced with the other
+   changes made during the current runloop turn.
+   */
+  BOOL runsImmediately;
+} MDCOverlayFrameChange;
+
 /**
  Class responsible for reporting changes to overlays on a given screen.
  */
@@ -47,6 +68,22 @@
  */
 - (void)removeTarget:(id)target action:(SEL)action;
 
+/**
+ Reports a change to the frame of an overlay.
+
+ Changes made during one runloop turn are coalesced into a single transition, which is delivered to
+ the targets at the end of the turn. Posting @c MDCOverlayDidChangeNotification has the same effect
+ but boxes the change into a user info dictionary.
+
+ @param change The change to the overlay's frame.
+ @param identifier The unique identifier of the overlay.
+ @param timingFunction If the change specifies an animation, the timing function of the transition.
+                       Takes precedence over the change's curve.
+ */
+- (void)applyFrameChange:(MDCOverlayFrameChange)change
+    toOverlayWithIdentifier:(NSString *)identifier
+             timingFunction:(CAMediaTimingFunction *)timingFunction;
+
 /**
  Prevents the given target from being notified of any overlay changes.
 
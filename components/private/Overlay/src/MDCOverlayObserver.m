@@ -31,13 +31,55 @@
 #define MDC_UNUSED_IN_RELEASE
 #endif
 
+/** The signature of the methods registered via -addTarget:action:. */
+typedef void (*MDCOverlayActionFunction)(id, SEL, id<MDCOverlayTransitioning>);
+
+/** A registered action, with its implementation looked up once rather than on every transition. */
+@interface MDCOverlayObserverAction : NSObject
+
+@property(nonatomic, readonly) SEL action;
+
+- (instancetype)initWithTarget:(id)target action:(SEL)action;
+
+- (void)invokeWithTarget:(id)target transition:(id<MDCOverlayTransitioning>)transition;
+
+@end
+
+@implementation MDCOverlayObserverAction {
+  MDCOverlayActionFunction _function;
+}
+
+- (instancetype)initWithTarget:(id)target action:(SEL)action {
+  self = [super init];
+  if (self != nil) {
+    _action = action;
+    _function = (MDCOverlayActionFunction)[target methodForSelector:action];
+  }
+  return self;
+}
+
+- (void)invokeWithTarget:(id)target transition:(id<MDCOverlayTransitioning>)transition {
+  NSParameterAssert(transition != nil);
+
+  _function(target, _action, transition);
+}
+
+@end
+
+/** The animation parameters of the transition that fires at the end of the current runloop. */
+typedef struct MDCOverlayPendingTransition {
+  BOOL isPending;
+  NSTimeInterval duration;
+  UIViewAnimationCurve curve;
+} MDCOverlayPendingTransition;
+
 @interface MDCOverlayObserver () <MDCOverlayAnimationObserverDelegate>
 
-/** The list of overlays currently known to this observer. */
-@property(nonatomic) NSMutableDictionary *overlays;
+/** The overlays currently known to this observer, keyed by identifier. */
+@property(nonatomic) NSMutableDictionary<NSString *, MDCOverlayObserverOverlay *> *overlays;
 
-/** The currently-pending transition. */
-@property(nonatomic) MDCOverlayObserverTransition *pendingTransition;
+/** The same overlays, kept sorted by identifier as they are added and removed. */
+@property(nonatomic) NSMutableArray<MDCOverlayObserverOverlay *> *sortedOverlays;
 
 /** The table holding the target-action mapping. */
 @property(nonatomic) NSMapTable *actionTable;
@@ -47,7 +89,13 @@
 
 @end
 
-@implementation MDCOverlayObserver
+@implementation MDCOverlayObserver {
+  MDCOverlayPendingTransition _pendingTransition;
+  CAMediaTimingFunction *_pendingTimingFunction;
+
+  // An immutable copy of sortedOverlays, handed to transitions until the overlays change.
+  NSArray<MDCOverlayObserverOverlay *> *_overlaysSnapshot;
+}
 
 static MDCOverlayObserver *_sOverlayObserver;
 
@@ -68,6 +116,7 @@ static MDCOverlayObserver *_sOverlayObserver;
   self = [super init];
   if (self != nil) {
     _overlays = [NSMutableDictionary dictionary];
+    _sortedOverlays = [NSMutableArray array];
     _observer = [[MDCOverlayAnimationObserver alloc] init];
     _observer.delegate = self;
 
@@ -91,34 +140,35 @@ static MDCOverlayObserver *_sOverlayObserver;
 
 #pragma mark - Overlays
 
-- (MDCOverlayObserverOverlay *)overlayWithIdentifier:(NSString *)identifier {
-  return self.overlays[identifier];
+- (void)addOverlayWithIdentifier:(NSString *)identifier frame:(CGRect)frame {
+  MDCOverlayObserverOverlay *overlay = [[MDCOverlayObserverOverlay alloc] init];
+  overlay.identifier = identifier;
+  overlay.frame = frame;
+  self.overlays[identifier] = overlay;
+
+  NSUInteger index =
+      [self.sortedOverlays indexOfObject:overlay
+                           inSortedRange:NSMakeRange(0, self.sortedOverlays.count)
+                                 options:NSBinarySearchingInsertionIndex
+                         usingComparator:^NSComparisonResult(MDCOverlayObserverOverlay *first,
+                                                             MDCOverlayObserverOverlay *second) {
+                           return [first.identifier compare:second.identifier];
+                         }];
+  [self.sortedOverlays insertObject:overlay atIndex:index];
+  _overlaysSnapshot = nil;
 }
 
-- (MDCOverlayObserverOverlay *)buildOverlayWithIdentifier:(NSString *)identifier {
-  MDCOverlayObserverOverlay *overlay = self.overlays[identifier];
-  if (overlay == nil) {
-    overlay = [[MDCOverlayObserverOverlay alloc] init];
-    overlay.identifier = identifier;
-    self.overlays[identifier] = overlay;
-  }
-
-  return overlay;
-}
-
-- (void)removeOverlayWithIdentifier:(NSString *)identifier {
-  [self.overlays removeObjectForKey:identifier];
+- (void)removeOverlay:(MDCOverlayObserverOverlay *)overlay {
+  [self.overlays removeObjectForKey:overlay.identifier];
+  [self.sortedOverlays removeObjectIdenticalTo:overlay];
+  _overlaysSnapshot = nil;
 }
 
-- (NSArray *)sortedOverlays {
-  NSArray *sortedKeys = [[self.overlays allKeys] sortedArrayUsingSelector:@selector(compare:)];
-
-  NSMutableArray *result = [NSMutableArray array];
-  for (NSString *key in sortedKeys) {
-    [result addObject:self.overlays[key]];
+- (NSArray<MDCOverlayObserverOverlay *> *)overlaysSnapshot {
+  if (_overlaysSnapshot == nil) {
+    _overlaysSnapshot = [self.sortedOverlays copy];
   }
-
-  return result;
+  return _overlaysSnapshot;
 }
 
 #pragma mark - Input Sources
@@ -126,12 +176,12 @@ static MDCOverlayObserver *_sOverlayObserver;
 - (BOOL)updateOverlay:(NSString *)identifier withFrame:(CGRect)frame {
   BOOL changed = NO;
 
-  MDCOverlayObserverOverlay *existingOverlay = [self overlayWithIdentifier:identifier];
+  MDCOverlayObserverOverlay *existingOverlay = self.overlays[identifier];
 
   if (existingOverlay != nil) {
     if (CGRectIsEmpty(frame)) {
       // We're getting rid of this overlay entirely.
-      [self removeOverlayWithIdentifier:identifier];
+      [self removeOverlay:existingOverlay];
       changed = YES;
     } else if (!CGRectEqualToRect(existingOverlay.frame, frame)) {
       // We're changing to a new frame for this overlay.
@@ -139,114 +189,103 @@ static MDCOverlayObserver *_sOverlayObserver;
       changed = YES;
     }
   } else if (!CGRectIsEmpty(frame)) {
-    MDCOverlayObserverOverlay *overlay = [self buildOverlayWithIdentifier:identifier];
-    overlay.frame = frame;
+    [self addOverlayWithIdentifier:identifier frame:frame];
     changed = YES;
   }
 
   return changed;
 }
 
-- (void)handleOverlayChangeNotification:(NSNotification *)note {
-  NSDictionary *userInfo = note.userInfo;
-  NSString *identifier = userInfo[MDCOverlayIdentifierKey];
-
+- (void)applyFrameChange:(MDCOverlayFrameChange)change
+    toOverlayWithIdentifier:(NSString *)identifier
+             timingFunction:(CAMediaTimingFunction *)timingFunction {
   // Don't even bother if an identifier wasn't provided.
   if (identifier.length == 0) {
     return;
   }
 
-  NSValue *frame = userInfo[MDCOverlayFrameKey] ? userInfo[MDCOverlayFrameKey]
-                                                : [NSValue valueWithCGRect:CGRectNull];
-  NSNumber *duration = userInfo[MDCOverlayTransitionDurationKey];
-
-  // Update the overlay frame.
-  BOOL updated = [self updateOverlay:identifier withFrame:[frame CGRectValue]];
-
-  // If there was actually a change, set up a transition.
-  if (updated) {
-    if (self.pendingTransition == nil) {
-      self.pendingTransition = [[MDCOverlayObserverTransition alloc] init];
-      [self.observer messageDelegateOnNextRunloop];
-    }
+  // Update the overlay frame. If there was actually a change, set up a transition.
+  if ([self updateOverlay:identifier withFrame:change.frame] && !_pendingTransition.isPending) {
+    _pendingTransition = (MDCOverlayPendingTransition){.isPending = YES};
+    _pendingTimingFunction = nil;
+    [self.observer messageDelegateOnNextRunloop];
   }
 
   // If we were given a duration, then update the animation parameters.
-  if (self.pendingTransition != nil && duration != nil) {
-    self.pendingTransition.duration = duration.doubleValue;
-    self.pendingTransition.customTimingFunction = userInfo[MDCOverlayTransitionTimingFunctionKey];
-    self.pendingTransition.animationCurve =
-        ((NSNumber *)userInfo[MDCOverlayTransitionCurveKey]).integerValue;
+  if (_pendingTransition.isPending && change.specifiesAnimation) {
+    _pendingTransition.duration = change.duration;
+    _pendingTransition.curve = change.curve;
+    _pendingTimingFunction = timingFunction;
 
     // If this update requires us to run the animation immediately, go ahead and fire it off.
-    NSNumber *runImmediately = userInfo[MDCOverlayTransitionImmediacyKey];
-    if (runImmediately.boolValue) {
+    if (change.runsImmediately) {
       [self fireTransition];
     }
   }
 }
 
-#pragma mark - Target/Action
-
-- (NSInvocation *)buildInvocationForTarget:(id)target action:(SEL)action {
-  NSMethodSignature *signature = [target methodSignatureForSelector:action];
-  NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:signature];
-  [invocation setTarget:target];
-  [invocation setSelector:action];
+- (void)handleOverlayChangeNotification:(NSNotification *)note {
+  NSDictionary *userInfo = note.userInfo;
+  NSValue *frame = userInfo[MDCOverlayFrameKey];
+  NSNumber *duration = userInfo[MDCOverlayTransitionDurationKey];
 
-  return invocation;
+  MDCOverlayFrameChange change = {
+      .frame = frame != nil ? frame.CGRectValue : CGRectNull,
+      .specifiesAnimation = duration != nil,
+      .duration = duration.doubleValue,
+      .curve = ((NSNumber *)userInfo[MDCOverlayTransitionCurveKey]).integerValue,
+      .runsImmediately = ((NSNumber *)userInfo[MDCOverlayTransitionImmediacyKey]).boolValue,
+  };
+  [self applyFrameChange:change
+      toOverlayWithIdentifier:userInfo[MDCOverlayIdentifierKey]
+               timingFunction:userInfo[MDCOverlayTransitionTimingFunctionKey]];
 }
 
-- (void)invokeTarget:(NSInvocation *)invocation
-      withTransition:(MDCOverlayObserverTransition *)transition {
-  NSParameterAssert(invocation != nil);
-  NSParameterAssert(transition != nil);
-
-  [invocation setArgument:&transition atIndex:2];
-  [invocation invoke];
-}
+#pragma mark - Target/Action
 
-- (NSUInteger)indexOfInvocationForTarget:(id)target action:(SEL)action {
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
+- (NSUInteger)indexOfActionForTarget:(id)target action:(SEL)action {
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-  if (invocations == nil) {
+  if (actions == nil) {
     return NSNotFound;
   }
 
-  return [invocations indexOfObjectPassingTest:^BOOL(NSInvocation *invocation,
-                                                     __unused NSUInteger idx, __unused BOOL *stop) {
-    return invocation.selector == action;
-  }];
+  for (NSUInteger i = 0; i < actions.count; i++) {
+    if (actions[i].action == action) {
+      return i;
+    }
+  }
+  return NSNotFound;
 }
 
 - (void)addTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
   if (foundIndex != NSNotFound) {
     return;
   }
 
-  NSInvocation *invocation = [self buildInvocationForTarget:target action:action];
-  NSParameterAssert(invocation != nil);
+  MDCOverlayObserverAction *observerAction =
+      [[MDCOverlayObserverAction alloc] initWithTarget:target action:action];
 
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
-  if (invocations == nil) {
-    invocations = [NSMutableArray array];
-    [self.actionTable setObject:invocations forKey:target];
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
+  if (actions == nil) {
+    actions = [NSMutableArray array];
+    [self.actionTable setObject:actions forKey:target];
   }
 
-  [invocations addObject:invocation];
+  [actions addObject:observerAction];
 
   if (self.overlays.count > 0) {
     // If there's already a pending transition, let the runloop take care of it, otherwise create
     // one and call it immediately on just the newly-added target, so that it can get its initial
     // value.
-    if (self.pendingTransition == nil) {
+    if (!_pendingTransition.isPending) {
       MDCOverlayObserverTransition *transition = [[MDCOverlayObserverTransition alloc] init];
-      transition.overlays = [self sortedOverlays];
+      transition.overlays = [self overlaysSnapshot];
 
-      [self invokeTarget:invocation withTransition:transition];
+      [observerAction invokeWithTarget:target transition:transition];
 
       // Run the (non-animated) transition.
       [transition runAnimation];
@@ -263,17 +302,17 @@ static MDCOverlayObserver *_sOverlayObserver;
 - (void)removeTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
 
   if (foundIndex != NSNotFound) {
-    NSMutableArray *invocations = [self.actionTable objectForKey:target];
+    NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-    if (invocations.count == 1) {
-      // Clean up all the invocations if this was the only one.
+    if (actions.count == 1) {
+      // Clean up all the actions if this was the only one.
       [self removeTarget:target];
     } else {
-      // Otherwise remove this single invocation.
-      [invocations removeObjectAtIndex:foundIndex];
+      // Otherwise remove this single action.
+      [actions removeObjectAtIndex:foundIndex];
     }
   }
 }
@@ -281,25 +320,30 @@ static MDCOverlayObserver *_sOverlayObserver;
 #pragma mark - Runloop Observer
 
 - (void)fireTransition {
-  if (self.pendingTransition == nil) {
+  if (!_pendingTransition.isPending) {
     return;
   }
 
-  // Update the transition with the latest set of overlays.
-  self.pendingTransition.overlays = [self sortedOverlays];
+  // Build the transition with the latest set of overlays.
+  MDCOverlayObserverTransition *transition = [[MDCOverlayObserverTransition alloc] init];
+  transition.duration = _pendingTransition.duration;
+  transition.animationCurve = _pendingTransition.curve;
+  transition.customTimingFunction = _pendingTimingFunction;
+  transition.overlays = [self overlaysSnapshot];
 
   // Call all of our targets and let them know a transition has happened.
   for (id target in self.actionTable) {
-    NSArray *invocations = [self.actionTable objectForKey:target];
-    for (NSInvocation *invocation in invocations) {
-      [self invokeTarget:invocation withTransition:self.pendingTransition];
+    NSArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
+    for (MDCOverlayObserverAction *action in actions) {
+      [action invokeWithTarget:target transition:transition];
     }
   }
 
   // Actually run the transition animation.
-  [self.pendingTransition runAnimation];
+  [transition runAnimation];
 
-  self.pendingTransition = nil;
+  _pendingTransition = (MDCOverlayPendingTransition){0};
+  _pendingTimingFunction = nil;
 }
 
 - (void)animationObserverDidEndRunloop:(__unused MDCOverlayAnimationObserver *)observer {
@@ -0,0 +1,222 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialOverlay.h"
+
+/** Records the transitions delivered by an MDCOverlayObserver. */
+@interface FakeOverlayObserverTarget : NSObject
+@property(nonatomic, strong) NSMutableArray<id<MDCOverlayTransitioning>> *transitions;
+@property(nonatomic, strong) XCTestExpectation *expectation;
+@end
+
+@implementation FakeOverlayObserverTarget
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _transitions = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)handleOverlayTransition:(id<MDCOverlayTransitioning>)transition {
+  [self.transitions addObject:transition];
+  [self.expectation fulfill];
+}
+
+@end
+
+@interface MDCOverlayObserverTests : XCTestCase
+@property(nonatomic, strong) MDCOverlayObserver *observer;
+@property(nonatomic, strong) FakeOverlayObserverTarget *target;
+@end
+
+@implementation MDCOverlayObserverTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.observer = [[MDCOverlayObserver alloc] init];
+  self.target = [[FakeOverlayObserverTarget alloc] init];
+  [self.observer addTarget:self.target action:@selector(handleOverlayTransition:)];
+}
+
+- (void)tearDown {
+  [self.observer removeTarget:self.target];
+  self.target = nil;
+  self.observer = nil;
+
+  [super tearDown];
+}
+
+- (NSArray<NSString *> *)identifiersInTransition:(id<MDCOverlayTransitioning>)transition {
+  NSMutableArray<NSString *> *identifiers = [NSMutableArray array];
+  [transition enumerateOverlays:^(id<MDCOverlay> overlay, __unused NSUInteger idx,
+                                  __unused BOOL *stop) {
+    [identifiers addObject:overlay.identifier];
+  }];
+  return identifiers;
+}
+
+- (void)testChangesInOneRunloopTurnCoalesceIntoOneTransition {
+  // Given
+  self.target.expectation = [self expectationWithDescription:@"Transition"];
+  MDCOverlayFrameChange changeB = {.frame = CGRectMake(0, 500, 320, 50)};
+  MDCOverlayFrameChange changeC = {.frame = CGRectMake(0, 400, 320, 50)};
+  MDCOverlayFrameChange changeA = {.frame = CGRectMake(0, 450, 320, 50)};
+
+  // When
+  [self.observer applyFrameChange:changeB toOverlayWithIdentifier:@"b" timingFunction:nil];
+  [self.observer applyFrameChange:changeC toOverlayWithIdentifier:@"c" timingFunction:nil];
+  [self.observer applyFrameChange:changeA toOverlayWithIdentifier:@"a" timingFunction:nil];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 1U);
+  id<MDCOverlayTransitioning> transition = self.target.transitions.firstObject;
+  NSArray<NSString *> *expectedIdentifiers = @[ @"a", @"b", @"c" ];
+  XCTAssertEqualObjects([self identifiersInTransition:transition], expectedIdentifiers);
+  XCTAssertTrue(CGRectEqualToRect(transition.compositeFrame, CGRectMake(0, 400, 320, 150)));
+}
+
+- (void)testRemovedOverlayLeavesOrderOfOthersIntact {
+  // Given
+  MDCOverlayFrameChange addition = {.frame = CGRectMake(0, 0, 10, 10)};
+  for (NSString *identifier in @[ @"c", @"a", @"b" ]) {
+    [self.observer applyFrameChange:addition toOverlayWithIdentifier:identifier timingFunction:nil];
+  }
+  self.target.expectation = [self expectationWithDescription:@"Transition"];
+  MDCOverlayFrameChange removal = {.frame = CGRectNull};
+
+  // When
+  [self.observer applyFrameChange:removal toOverlayWithIdentifier:@"b" timingFunction:nil];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  // Then
+  NSArray<NSString *> *expectedIdentifiers = @[ @"a", @"c" ];
+  XCTAssertEqualObjects([self identifiersInTransition:self.target.transitions.lastObject],
+                        expectedIdentifiers);
+}
+
+- (void)testImmediateChangeIsDeliveredSynchronously {
+  // Given
+  MDCOverlayFrameChange change = {
+      .frame = CGRectMake(0, 400, 320, 216),
+      .specifiesAnimation = YES,
+      .duration = 0.25,
+      .curve = UIViewAnimationCurveEaseOut,
+      .runsImmediately = YES,
+  };
+
+  // When
+  [self.observer applyFrameChange:change toOverlayWithIdentifier:@"keyboard" timingFunction:nil];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 1U);
+  XCTAssertEqualWithAccuracy(self.target.transitions.firstObject.duration, 0.25, 0.001);
+  XCTAssertEqual(self.target.transitions.firstObject.animationCurve, UIViewAnimationCurveEaseOut);
+}
+
+- (void)testUnchangedFrameDoesNotStartTransition {
+  // Given
+  MDCOverlayFrameChange change = {
+      .frame = CGRectMake(0, 400, 320, 50),
+      .specifiesAnimation = YES,
+      .runsImmediately = YES,
+  };
+  [self.observer applyFrameChange:change toOverlayWithIdentifier:@"a" timingFunction:nil];
+
+  // When
+  [self.observer applyFrameChange:change toOverlayWithIdentifier:@"a" timingFunction:nil];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 1U);
+}
+
+- (void)testNotificationIsDeliveredAsFrameChange {
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:MDCOverlayDidChangeNotification
+                    object:nil
+                  userInfo:@{
+                    MDCOverlayIdentifierKey : @"notification",
+                    MDCOverlayFrameKey : [NSValue valueWithCGRect:CGRectMake(0, 400, 320, 50)],
+                    MDCOverlayTransitionDurationKey : @0,
+                    MDCOverlayTransitionImmediacyKey : @YES,
+                  }];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 1U);
+  NSArray<NSString *> *expectedIdentifiers = @[ @"notification" ];
+  XCTAssertEqualObjects([self identifiersInTransition:self.target.transitions.firstObject],
+                        expectedIdentifiers);
+}
+
+- (void)testAddingTargetDeliversCurrentOverlays {
+  // Given
+  MDCOverlayFrameChange change = {
+      .frame = CGRectMake(0, 400, 320, 50),
+      .specifiesAnimation = YES,
+      .runsImmediately = YES,
+  };
+  [self.observer applyFrameChange:change toOverlayWithIdentifier:@"a" timingFunction:nil];
+  FakeOverlayObserverTarget *lateTarget = [[FakeOverlayObserverTarget alloc] init];
+
+  // When
+  [self.observer addTarget:lateTarget action:@selector(handleOverlayTransition:)];
+
+  // Then
+  XCTAssertEqual(lateTarget.transitions.count, 1U);
+  XCTAssertEqual(lateTarget.transitions.firstObject.duration, 0);
+}
+
+- (void)testRemovedTargetIsNotCalled {
+  // Given
+  MDCOverlayFrameChange change = {
+      .frame = CGRectMake(0, 400, 320, 50),
+      .specifiesAnimation = YES,
+      .runsImmediately = YES,
+  };
+
+  // When
+  [self.observer removeTarget:self.target action:@selector(handleOverlayTransition:)];
+  [self.observer applyFrameChange:change toOverlayWithIdentifier:@"a" timingFunction:nil];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 0U);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceImmediateFrameChange {
+  // Given
+  MDCOverlayObserver *observer = self.observer;
+  __block MDCOverlayFrameChange change = {
+      .frame = CGRectMake(0, 400, 320, 50),
+      .specifiesAnimation = YES,
+      .duration = 0.25,
+      .curve = UIViewAnimationCurveEaseInOut,
+      .runsImmediately = YES,
+  };
+
+  // Then
+  [self measureBlock:^{
+    change.frame.origin.y = change.frame.origin.y == 400 ? 450 : 400;
+    [observer applyFrameChange:change toOverlayWithIdentifier:@"snackbar" timingFunction:nil];
+  }];
+}
+
+@end
@@ -0,0 +1,75 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Applies the current value of one observed property of @c item to the owner's view of that item.
+
+ Handler tables are meant to be built once per owner class and shared by all of its instances, so a
+ handler must reach the owner through its @c owner argument rather than by capturing it.
+ */
+typedef void (^MDCTabBarItemPropertyHandler)(id owner, UITabBarItem *item, NSUInteger itemIndex);
+
+/** Called once after one or more observed changes were applied. */
+typedef void (^MDCTabBarItemObserverFlushHandler)(id owner);
+
+/**
+ Observes the properties of the UITabBarItems shown by a bar, such as MDCBottomNavigationBar,
+ MDCTabBarView or MDCItemBar, and routes each change to the bar.
+
+ A change is dispatched through a key path to handler table and an item to index map, so its cost
+ does not depend on the number of items or observed properties. The change is applied to the bar
+ right away, while the bar's follow-up work, such as a layout pass, runs from the flush handler at
+ most once per run loop turn however many items changed.
+
+ Must only be used on the main thread.
+ */
+@interface MDCTabBarItemObserver : NSObject
+
+/**
+ Creates an observer for the items of @c owner.
+
+ @param owner The bar that shows the items. It is not retained.
+ @param propertyHandlers The handler to call for each observed key path of UITabBarItem.
+ @param flushHandler Called at the end of any run loop turn in which a change was applied.
+ */
+- (instancetype)initWithOwner:(id)owner
+             propertyHandlers:
+                 (NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *)propertyHandlers
+                 flushHandler:(nullable MDCTabBarItemObserverFlushHandler)flushHandler
+    NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ The observed items, in the owner's order. Setting this stops observing the previous items and
+ starts observing the new ones.
+ */
+@property(nonatomic, copy) NSArray<UITabBarItem *> *items;
+
+/** Whether a change was applied since the flush handler was last called. */
+@property(nonatomic, readonly) BOOL hasPendingChanges;
+
+/** Returns the index of the first occurrence of @c item in @c items, or NSNotFound. */
+- (NSUInteger)indexOfItem:(nullable UITabBarItem *)item;
+
+/** Calls the flush handler now if a change is pending, instead of at the end of the turn. */
+- (void)flushPendingChanges;
+
+@end
+
+NS_ASSUME_NONNULL_END
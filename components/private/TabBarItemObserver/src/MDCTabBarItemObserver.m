@@ -0,0 +1,180 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCTabBarItemObserver.h"
+#import "private/MDCTabBarItemObserver+Testing.h"
+
+#import <UIKit/UIKit.h>
+
+// KVO context
+static char *const kKVOContextMDCTabBarItemObserver = "kKVOContextMDCTabBarItemObserver";
+
+static NSUInteger gFlushCount = 0;
+
+NSUInteger MDCTabBarItemObserverFlushCount(void) {
+  return gFlushCount;
+}
+
+void MDCTabBarItemObserverResetFlushCount(void) {
+  gFlushCount = 0;
+}
+
+static void MDCTabBarItemObserverFlushAll(void);
+
+/**
+ Returns the observers with a pending change. On first use, installs a main run loop observer that
+ flushes them once the run loop is about to sleep, which is before Core Animation commits the
+ frame, so bars are laid out in the same frame as the change.
+ */
+static NSHashTable<MDCTabBarItemObserver *> *MDCTabBarItemObserversPendingFlush(void) {
+  static NSHashTable *observers;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    observers = [NSHashTable weakObjectsHashTable];
+    CFRunLoopObserverRef runLoopObserver = CFRunLoopObserverCreateWithHandler(
+        kCFAllocatorDefault, kCFRunLoopBeforeWaiting | kCFRunLoopExit, true, 0,
+        ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+          MDCTabBarItemObserverFlushAll();
+        });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), runLoopObserver, kCFRunLoopCommonModes);
+    CFRelease(runLoopObserver);
+  });
+  return observers;
+}
+
+static void MDCTabBarItemObserverFlushAll(void) {
+  NSHashTable<MDCTabBarItemObserver *> *pendingObservers = MDCTabBarItemObserversPendingFlush();
+  if (pendingObservers.count == 0) {
+    return;
+  }
+  NSArray<MDCTabBarItemObserver *> *observers = pendingObservers.allObjects;
+  [pendingObservers removeAllObjects];
+  for (MDCTabBarItemObserver *observer in observers) {
+    [observer flushPendingChanges];
+  }
+}
+
+@implementation MDCTabBarItemObserver {
+  __weak id _owner;
+  NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *_propertyHandlers;
+  MDCTabBarItemObserverFlushHandler _flushHandler;
+  // Maps each item, by identity and without retaining it, to its index plus one. Items are retained
+  // by _items for as long as they are in the map.
+  CFMutableDictionaryRef _itemIndexes;
+}
+
+- (instancetype)initWithOwner:(id)owner
+             propertyHandlers:
+                 (NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *)propertyHandlers
+                 flushHandler:(MDCTabBarItemObserverFlushHandler)flushHandler {
+  self = [super init];
+  if (self) {
+    _owner = owner;
+    _propertyHandlers = [propertyHandlers copy];
+    _flushHandler = [flushHandler copy];
+    _items = @[];
+    _itemIndexes = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [self stopObservingItems];
+  CFRelease(_itemIndexes);
+}
+
+- (void)setItems:(NSArray<UITabBarItem *> *)items {
+  [self stopObservingItems];
+  _items = [items copy] ?: @[];
+  CFDictionaryRemoveAllValues(_itemIndexes);
+  for (NSUInteger i = 0; i < _items.count; i++) {
+    const void *key = (__bridge const void *)_items[i];
+    if (!CFDictionaryContainsKey(_itemIndexes, key)) {
+      CFDictionarySetValue(_itemIndexes, key, (const void *)(uintptr_t)(i + 1));
+    }
+  }
+  [self startObservingItems];
+}
+
+- (NSUInteger)indexOfItem:(UITabBarItem *)item {
+  if (!item) {
+    return NSNotFound;
+  }
+  uintptr_t indexPlusOne =
+      (uintptr_t)CFDictionaryGetValue(_itemIndexes, (__bridge const void *)item);
+  return indexPlusOne == 0 ? NSNotFound : (NSUInteger)(indexPlusOne - 1);
+}
+
+- (void)flushPendingChanges {
+  if (!_hasPendingChanges) {
+    return;
+  }
+  _hasPendingChanges = NO;
+  [MDCTabBarItemObserversPendingFlush() removeObject:self];
+  gFlushCount++;
+  id owner = _owner;
+  if (owner && _flushHandler) {
+    _flushHandler(owner);
+  }
+}
+
+#pragma mark - Private
+
+- (void)startObservingItems {
+  for (UITabBarItem *item in _items) {
+    for (NSString *keyPath in _propertyHandlers) {
+      [item addObserver:self
+             forKeyPath:keyPath
+                options:0
+                context:kKVOContextMDCTabBarItemObserver];
+    }
+  }
+}
+
+- (void)stopObservingItems {
+  for (UITabBarItem *item in _items) {
+    for (NSString *keyPath in _propertyHandlers) {
+      [item removeObserver:self forKeyPath:keyPath context:kKVOContextMDCTabBarItemObserver];
+    }
+  }
+}
+
+- (void)setNeedsFlush {
+  if (!_hasPendingChanges) {
+    _hasPendingChanges = YES;
+    [MDCTabBarItemObserversPendingFlush() addObject:self];
+  }
+}
+
+#pragma mark - NSObject
+
+- (void)observeValueForKeyPath:(NSString *)keyPath
+                      ofObject:(id)object
+                        change:(NSDictionary<NSKeyValueChangeKey, id> *)change
+                       context:(void *)context {
+  if (context != kKVOContextMDCTabBarItemObserver) {
+    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+    return;
+  }
+  MDCTabBarItemPropertyHandler handler = _propertyHandlers[keyPath];
+  NSUInteger itemIndex = [self indexOfItem:object];
+  id owner = _owner;
+  if (!handler || itemIndex == NSNotFound || !owner) {
+    return;
+  }
+  handler(owner, object, itemIndex);
+  [self setNeedsFlush];
+}
+
+@end
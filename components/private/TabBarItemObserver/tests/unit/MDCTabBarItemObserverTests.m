@@ -0,0 +1,194 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCTabBarItemObserver+Testing.h"
+#import "MDCTabBarItemObserver.h"
+
+static const NSUInteger kBenchmarkItemCount = 5;
+static const NSUInteger kBenchmarkChangeCount = 10000;
+
+/** Records the calls made by an MDCTabBarItemObserver. */
+@interface FakeTabBarItemObserverOwner : NSObject
+@property(nonatomic, strong) NSMutableArray<NSString *> *appliedTitles;
+@property(nonatomic, strong) NSMutableArray<NSNumber *> *appliedIndexes;
+@property(nonatomic, assign) NSUInteger flushCount;
+@end
+
+@implementation FakeTabBarItemObserverOwner
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _appliedTitles = [NSMutableArray array];
+    _appliedIndexes = [NSMutableArray array];
+  }
+  return self;
+}
+
+@end
+
+@interface MDCTabBarItemObserverTests : XCTestCase
+@property(nonatomic, strong) FakeTabBarItemObserverOwner *owner;
+@property(nonatomic, strong) MDCTabBarItemObserver *observer;
+@property(nonatomic, strong) NSArray<UITabBarItem *> *items;
+@end
+
+@implementation MDCTabBarItemObserverTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.owner = [[FakeTabBarItemObserverOwner alloc] init];
+  NSDictionary<NSString *, MDCTabBarItemPropertyHandler> *handlers = @{
+    NSStringFromSelector(@selector(title)) : ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+      FakeTabBarItemObserverOwner *fakeOwner = owner;
+      [fakeOwner.appliedTitles addObject:item.title ?: @""];
+      [fakeOwner.appliedIndexes addObject:@(itemIndex)];
+    },
+    NSStringFromSelector(@selector(badgeValue)) :
+        ^(id owner, UITabBarItem *item, NSUInteger itemIndex) {
+          [((FakeTabBarItemObserverOwner *)owner).appliedIndexes addObject:@(itemIndex)];
+        },
+  };
+  self.observer = [[MDCTabBarItemObserver alloc] initWithOwner:self.owner
+                                              propertyHandlers:handlers
+                                                  flushHandler:^(id owner) {
+                                                    ((FakeTabBarItemObserverOwner *)owner)
+                                                        .flushCount++;
+                                                  }];
+  self.items = @[
+    [[UITabBarItem alloc] initWithTitle:@"1" image:nil tag:0],
+    [[UITabBarItem alloc] initWithTitle:@"2" image:nil tag:0],
+    [[UITabBarItem alloc] initWithTitle:@"3" image:nil tag:0],
+  ];
+  self.observer.items = self.items;
+  MDCTabBarItemObserverResetFlushCount();
+}
+
+- (void)tearDown {
+  self.observer = nil;
+  self.items = nil;
+  self.owner = nil;
+
+  [super tearDown];
+}
+
+- (void)testChangeIsAppliedImmediatelyWithItemIndex {
+  // When
+  self.items[2].title = @"Three";
+
+  // Then
+  XCTAssertEqualObjects(self.owner.appliedTitles, @[ @"Three" ]);
+  XCTAssertEqualObjects(self.owner.appliedIndexes, @[ @2 ]);
+  XCTAssertTrue(self.observer.hasPendingChanges);
+  XCTAssertEqual(self.owner.flushCount, 0U);
+}
+
+- (void)testUnobservedPropertyIsIgnored {
+  // When
+  self.items[0].tag = 7;
+
+  // Then
+  XCTAssertEqual(self.owner.appliedIndexes.count, 0U);
+  XCTAssertFalse(self.observer.hasPendingChanges);
+}
+
+- (void)testIndexOfItem {
+  // Then
+  XCTAssertEqual([self.observer indexOfItem:self.items[0]], 0U);
+  XCTAssertEqual([self.observer indexOfItem:self.items[2]], 2U);
+  XCTAssertEqual([self.observer indexOfItem:[[UITabBarItem alloc] init]], (NSUInteger)NSNotFound);
+  XCTAssertEqual([self.observer indexOfItem:nil], (NSUInteger)NSNotFound);
+}
+
+- (void)testManyChangesFlushOnce {
+  // When
+  for (UITabBarItem *item in self.items) {
+    item.title = @"Changed";
+    item.badgeValue = @"1";
+  }
+  [self.observer flushPendingChanges];
+  [self.observer flushPendingChanges];
+
+  // Then
+  XCTAssertEqual(self.owner.appliedIndexes.count, 6U);
+  XCTAssertEqual(self.owner.flushCount, 1U);
+  XCTAssertEqual(MDCTabBarItemObserverFlushCount(), 1U);
+  XCTAssertFalse(self.observer.hasPendingChanges);
+}
+
+- (void)testPendingChangesFlushAtEndOfRunLoopTurn {
+  // Given
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Flushed"];
+
+  // When
+  self.items[0].title = @"One";
+  self.items[1].title = @"Two";
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [expectation fulfill];
+  });
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  // Then
+  XCTAssertEqual(self.owner.flushCount, 1U);
+  XCTAssertFalse(self.observer.hasPendingChanges);
+}
+
+- (void)testSettingItemsStopsObservingPreviousItems {
+  // Given
+  UITabBarItem *oldItem = self.items[0];
+  UITabBarItem *newItem = [[UITabBarItem alloc] initWithTitle:@"New" image:nil tag:0];
+
+  // When
+  self.observer.items = @[ newItem ];
+  oldItem.title = @"Old";
+  newItem.title = @"Newer";
+
+  // Then
+  XCTAssertEqualObjects(self.owner.appliedTitles, @[ @"Newer" ]);
+  XCTAssertEqualObjects(self.owner.appliedIndexes, @[ @0 ]);
+  XCTAssertEqual([self.observer indexOfItem:oldItem], (NSUInteger)NSNotFound);
+}
+
+- (void)testNoChangeIsAppliedAfterOwnerIsReleased {
+  // When
+  self.owner = nil;
+  self.items[0].title = @"Orphaned";
+
+  // Then
+  XCTAssertFalse(self.observer.hasPendingChanges);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceItemChanges {
+  // Given
+  NSMutableArray<UITabBarItem *> *items = [NSMutableArray array];
+  for (NSUInteger i = 0; i < kBenchmarkItemCount; i++) {
+    [items addObject:[[UITabBarItem alloc] initWithTitle:@"" image:nil tag:0]];
+  }
+  self.observer.items = items;
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < kBenchmarkChangeCount; i++) {
+      items[i % kBenchmarkItemCount].badgeValue = (i % 2) ? @"1" : nil;
+    }
+    [self.observer flushPendingChanges];
+  }];
+}
+
+@end
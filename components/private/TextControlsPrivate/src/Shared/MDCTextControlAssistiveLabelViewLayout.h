@@ -17,6 +17,7 @@
 
 #import "MDCTextControl.h"
 #import "MDCTextControlAssistiveLabelDrawPriority.h"
+#import "MDCTextControlGeometry.h"
 
 /**
  MDCTextControlAssistiveLabelViewLayout objects tell MDCAssistiveLabelViews where to position their
@@ -42,4 +43,10 @@
          paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
                                isRTL:(BOOL)isRTL;
 
+/**
+ Wraps assistive label frames that have already been calculated by the text control geometry
+ engine, such as the ones calculated alongside a text field or text area layout.
+ */
+- (instancetype)initWithGeometry:(MDCTextControlAssistiveLabelGeometry)geometry;
+
 @end
@@ -15,6 +15,7 @@
 #import "MDCTextControlAssistiveLabelViewLayout.h"
 
 #import "MDCTextControlAssistiveLabelDrawPriority.h"
+#import "MDCTextControlGeometryAdapter.h"
 
 @interface MDCTextControlAssistiveLabelViewLayout ()
 
@@ -39,142 +40,36 @@
          paddingAboveAssistiveLabels:(CGFloat)paddingAboveAssistiveLabels
          paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
                                isRTL:(BOOL)isRTL {
-  self = [super init];
-  if (self) {
-    [self calculateLayoutWithSuperviewWidth:superviewWidth
-                      leadingAssistiveLabel:leadingAssistiveLabel
-                     trailingAssistiveLabel:trailingAssistiveLabel
-                 assistiveLabelDrawPriority:assistiveLabelDrawPriority
-           customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
-                         leadingEdgePadding:leadingEdgePadding
-                        trailingEdgePadding:trailingEdgePadding
-                paddingAboveAssistiveLabels:(CGFloat)paddingAboveAssistiveLabels
-                paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
-                                      isRTL:isRTL];
-    return self;
-  }
-  return nil;
+  NS_VALID_UNTIL_END_OF_SCOPE MDCTextControlGeometryTextMeasurer *textMeasurer =
+      [[MDCTextControlGeometryTextMeasurer alloc] init];
+  textMeasurer.leadingAssistiveLabel = leadingAssistiveLabel;
+  textMeasurer.trailingAssistiveLabel = trailingAssistiveLabel;
+  MDCTextControlAssistiveLabelGeometryInput input = {
+      .width = superviewWidth,
+      .leadingEdgePadding = leadingEdgePadding,
+      .trailingEdgePadding = trailingEdgePadding,
+      .paddingAboveAssistiveLabels = paddingAboveAssistiveLabels,
+      .paddingBelowAssistiveLabels = paddingBelowAssistiveLabels,
+      .style = MDCTextControlAssistiveLabelStyleWith(
+          assistiveLabelDrawPriority, customAssistiveLabelDrawPriority, leadingAssistiveLabel,
+          trailingAssistiveLabel),
+      .isRTL = isRTL,
+  };
+  MDCTextControlAssistiveLabelGeometry geometry;
+  MDCTextControlAssistiveLabelGeometryCalculate(&input, textMeasurer.measurer, &geometry);
+  return [self initWithGeometry:geometry];
 }
 
-#pragma mark Layout Calculation
-
-- (void)calculateLayoutWithSuperviewWidth:(CGFloat)superviewWidth
-                    leadingAssistiveLabel:(UILabel *)leadingAssistiveLabel
-                   trailingAssistiveLabel:(UILabel *)trailingAssistiveLabel
-               assistiveLabelDrawPriority:
-                   (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
-         customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
-                       leadingEdgePadding:(CGFloat)leadingEdgePadding
-                      trailingEdgePadding:(CGFloat)trailingEdgePadding
-              paddingAboveAssistiveLabels:(CGFloat)paddingAboveAssistiveLabels
-              paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
-                                    isRTL:(BOOL)isRTL {
-  CGFloat leftEdgePadding = isRTL ? trailingEdgePadding : leadingEdgePadding;
-  CGFloat rightEdgePadding = isRTL ? leadingEdgePadding : trailingEdgePadding;
-  CGFloat assistiveLabelsCombinedMinX = leftEdgePadding;
-  CGFloat assistiveLabelsCombinedMaxX = superviewWidth - rightEdgePadding;
-  CGFloat assistiveLabelsCombinedMaxWidth =
-      assistiveLabelsCombinedMaxX - assistiveLabelsCombinedMinX;
-
-  CGFloat assistiveLabelsCombinedMinY = paddingAboveAssistiveLabels;
-  CGFloat leadingAssistiveLabelWidth = 0;
-  CGFloat trailingAssistiveLabelWidth = 0;
-  CGSize leadingAssistiveLabelSize = CGSizeZero;
-  CGSize trailingAssistiveLabelSize = CGSizeZero;
-  switch (assistiveLabelDrawPriority) {
-    case MDCTextControlAssistiveLabelDrawPriorityCustom:
-      leadingAssistiveLabelWidth = [self
-          leadingAssistiveLabelWidthWithCombinedAssistiveLabelsWidth:assistiveLabelsCombinedMaxWidth
-                                                  customDrawPriority:
-                                                      customAssistiveLabelDrawPriority];
-      trailingAssistiveLabelWidth = assistiveLabelsCombinedMaxWidth - leadingAssistiveLabelWidth;
-      leadingAssistiveLabelSize = [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                                                 constrainedToWidth:leadingAssistiveLabelWidth];
-      trailingAssistiveLabelSize = [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                                                  constrainedToWidth:trailingAssistiveLabelWidth];
-      break;
-    case MDCTextControlAssistiveLabelDrawPriorityLeading:
-      leadingAssistiveLabelSize =
-          [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                         constrainedToWidth:assistiveLabelsCombinedMaxWidth];
-      if ([self isLabelMultilineWithLabel:leadingAssistiveLabel size:leadingAssistiveLabelSize]) {
-        trailingAssistiveLabelSize = CGSizeZero;
-      } else {
-        trailingAssistiveLabelSize =
-            [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                           constrainedToWidth:assistiveLabelsCombinedMaxWidth -
-                                              leadingAssistiveLabelSize.width];
-      }
-      break;
-    case MDCTextControlAssistiveLabelDrawPriorityTrailing:
-      // Pass through (.trailing is the default priority)
-    default:
-      trailingAssistiveLabelSize =
-          [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                         constrainedToWidth:assistiveLabelsCombinedMaxWidth];
-      if ([self isLabelMultilineWithLabel:trailingAssistiveLabel size:trailingAssistiveLabelSize]) {
-        leadingAssistiveLabelSize = CGSizeZero;
-      } else {
-        leadingAssistiveLabelSize =
-            [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                           constrainedToWidth:assistiveLabelsCombinedMaxWidth -
-                                              trailingAssistiveLabelSize.width];
-      }
-      break;
-  }
-
-  BOOL leadingAssistiveLabelIsVisible = !CGSizeEqualToSize(leadingAssistiveLabelSize, CGSizeZero);
-  BOOL trailingAssistiveLabelIsVisible = !CGSizeEqualToSize(trailingAssistiveLabelSize, CGSizeZero);
-  if (!leadingAssistiveLabelIsVisible && !trailingAssistiveLabelIsVisible) {
-    self.leadingAssistiveLabelFrame = CGRectZero;
-    self.trailingAssistiveLabelFrame = CGRectZero;
-    self.calculatedHeight = 0;
-    return;
-  }
-
-  CGSize leftAssistiveLabelSize = isRTL ? trailingAssistiveLabelSize : leadingAssistiveLabelSize;
-  CGSize rightAssistiveLabelSize = isRTL ? leadingAssistiveLabelSize : trailingAssistiveLabelSize;
-  CGRect leftAssistiveLabelFrame = CGRectZero;
-  CGRect rightAssistiveLabelFrame = CGRectZero;
-  if (!CGSizeEqualToSize(leftAssistiveLabelSize, CGSizeZero)) {
-    leftAssistiveLabelFrame =
-        CGRectMake(assistiveLabelsCombinedMinX, assistiveLabelsCombinedMinY,
-                   leftAssistiveLabelSize.width, leftAssistiveLabelSize.height);
-  }
-  if (!CGSizeEqualToSize(rightAssistiveLabelSize, CGSizeZero)) {
-    rightAssistiveLabelFrame = CGRectMake(
-        assistiveLabelsCombinedMaxX - rightAssistiveLabelSize.width, assistiveLabelsCombinedMinY,
-        rightAssistiveLabelSize.width, rightAssistiveLabelSize.height);
-  }
-
-  CGFloat maxAssistiveLabelHeight =
-      MAX(CGRectGetMaxY(leftAssistiveLabelFrame), CGRectGetMaxY(rightAssistiveLabelFrame));
-  self.leadingAssistiveLabelFrame = isRTL ? rightAssistiveLabelFrame : leftAssistiveLabelFrame;
-  self.trailingAssistiveLabelFrame = isRTL ? leftAssistiveLabelFrame : rightAssistiveLabelFrame;
-  self.calculatedHeight = maxAssistiveLabelHeight + paddingBelowAssistiveLabels;
-}
-
-- (CGSize)assistiveLabelSizeWithLabel:(UILabel *)label constrainedToWidth:(CGFloat)maxWidth {
-  if (maxWidth <= 0 || label.text.length <= 0 || label.hidden) {
-    return CGSizeZero;
-  }
-  CGSize fittingSize = CGSizeMake(maxWidth, CGFLOAT_MAX);
-  CGSize size = [label sizeThatFits:fittingSize];
-  if (size.width > maxWidth) {
-    size.width = maxWidth;
+- (instancetype)initWithGeometry:(MDCTextControlAssistiveLabelGeometry)geometry {
+  self = [super init];
+  if (self) {
+    self.leadingAssistiveLabelFrame =
+        MDCTextControlCGRectFromGeometryRect(geometry.leadingLabelFrame);
+    self.trailingAssistiveLabelFrame =
+        MDCTextControlCGRectFromGeometryRect(geometry.trailingLabelFrame);
+    self.calculatedHeight = (CGFloat)geometry.calculatedHeight;
   }
-  return size;
-}
-
-- (CGFloat)leadingAssistiveLabelWidthWithCombinedAssistiveLabelsWidth:
-               (CGFloat)totalAssistiveLabelsWidth
-                                                   customDrawPriority:(CGFloat)customDrawPriority {
-  return customDrawPriority * totalAssistiveLabelsWidth;
-}
-
-- (BOOL)isLabelMultilineWithLabel:(UILabel *)label size:(CGSize)size {
-  CGFloat lineHeight = label.font.lineHeight;
-  return round((double)(size.height / lineHeight)) > 1;
+  return self;
 }
 
 @end
@@ -0,0 +1,589 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MDCTextControlGeometry.h"
+
+#include <float.h>
+#include <math.h>
+
+static const double kGradientBlurLength = 4.0;
+
+static const MDCTextControlGeometryRect kZeroRect = {0, 0, 0, 0};
+static const MDCTextControlGeometrySize kZeroSize = {0, 0};
+
+static inline MDCTextControlGeometryRect RectMake(double x, double y, double width, double height) {
+  MDCTextControlGeometryRect rect = {x, y, width, height};
+  return rect;
+}
+
+static inline double RectGetMaxX(MDCTextControlGeometryRect rect) {
+  return rect.x + rect.width;
+}
+
+static inline double RectGetMaxY(MDCTextControlGeometryRect rect) {
+  return rect.y + rect.height;
+}
+
+static inline double RectGetMidY(MDCTextControlGeometryRect rect) {
+  return rect.y + (0.5 * rect.height);
+}
+
+static inline bool SizeIsZero(MDCTextControlGeometrySize size) {
+  return size.width == 0 && size.height == 0;
+}
+
+static inline MDCTextControlGeometrySize Measure(MDCTextControlGeometryMeasurer measurer,
+                                                 MDCTextControlGeometryElement element,
+                                                 double width, double height) {
+  MDCTextControlGeometrySize fittingSize = {width, height};
+  return measurer.measure(element, fittingSize, measurer.context);
+}
+
+static inline MDCTextControlGeometrySize MeasureLabel(MDCTextControlGeometryMeasurer measurer,
+                                                      MDCTextControlGeometryElement element,
+                                                      double maxWidth) {
+  return Measure(measurer, element, maxWidth, DBL_MAX);
+}
+
+bool MDCTextControlGeometryShouldDisplaySideView(bool isPresent,
+                                                 MDCTextControlGeometryViewMode viewMode,
+                                                 bool isEditing) {
+  if (!isPresent) {
+    return false;
+  }
+  switch (viewMode) {
+    case MDCTextControlGeometryViewModeWhileEditing:
+      return isEditing;
+    case MDCTextControlGeometryViewModeUnlessEditing:
+      return !isEditing;
+    case MDCTextControlGeometryViewModeAlways:
+      return true;
+    case MDCTextControlGeometryViewModeNever:
+    default:
+      return false;
+  }
+}
+
+static bool ShouldDisplayClearButton(MDCTextControlGeometryViewMode viewMode, bool isEditing,
+                                     bool hasText) {
+  switch (viewMode) {
+    case MDCTextControlGeometryViewModeWhileEditing:
+      return isEditing && hasText;
+    case MDCTextControlGeometryViewModeUnlessEditing:
+      return !isEditing;
+    case MDCTextControlGeometryViewModeAlways:
+      return true;
+    case MDCTextControlGeometryViewModeNever:
+    default:
+      return false;
+  }
+}
+
+double MDCTextControlGeometryTextHeight(double lineHeight) {
+  return ceil(lineHeight);
+}
+
+/**
+ Measures the normal and floating label within @c textRectWidth, limiting each to a single line.
+ Returns whether either of them had to be truncated.
+ */
+static bool MeasureLabels(MDCTextControlGeometryMeasurer measurer, double textRectWidth,
+                          double normalFontLineHeight, double floatingFontLineHeight,
+                          MDCTextControlGeometrySize *labelSizeNormal,
+                          MDCTextControlGeometrySize *labelSizeFloating) {
+  *labelSizeNormal =
+      MeasureLabel(measurer, MDCTextControlGeometryElementNormalLabel, textRectWidth);
+  *labelSizeFloating =
+      MeasureLabel(measurer, MDCTextControlGeometryElementFloatingLabel, textRectWidth);
+  bool normalLabelWillTruncate = labelSizeNormal->height > normalFontLineHeight;
+  bool floatingLabelWillTruncate = labelSizeFloating->height > floatingFontLineHeight;
+  if (normalLabelWillTruncate) {
+    labelSizeNormal->height = normalFontLineHeight;
+    labelSizeNormal->width = textRectWidth;
+  }
+  if (floatingLabelWillTruncate) {
+    labelSizeFloating->height = floatingFontLineHeight;
+    labelSizeFloating->width = textRectWidth;
+  }
+  return normalLabelWillTruncate || floatingLabelWillTruncate;
+}
+
+// Assistive labels
+
+static MDCTextControlGeometrySize AssistiveLabelSize(MDCTextControlGeometryMeasurer measurer,
+                                                     MDCTextControlGeometryElement element,
+                                                     double maxWidth) {
+  if (maxWidth <= 0) {
+    return kZeroSize;
+  }
+  MDCTextControlGeometrySize size = MeasureLabel(measurer, element, maxWidth);
+  if (size.width > maxWidth) {
+    size.width = maxWidth;
+  }
+  return size;
+}
+
+static bool IsLabelMultiline(double lineHeight, MDCTextControlGeometrySize size) {
+  return round(size.height / lineHeight) > 1;
+}
+
+void MDCTextControlAssistiveLabelGeometryCalculate(
+    const MDCTextControlAssistiveLabelGeometryInput *input, MDCTextControlGeometryMeasurer measurer,
+    MDCTextControlAssistiveLabelGeometry *geometry) {
+  bool isRTL = input->isRTL;
+  double leftEdgePadding = isRTL ? input->trailingEdgePadding : input->leadingEdgePadding;
+  double rightEdgePadding = isRTL ? input->leadingEdgePadding : input->trailingEdgePadding;
+  double combinedMinX = leftEdgePadding;
+  double combinedMaxX = input->width - rightEdgePadding;
+  double combinedMaxWidth = combinedMaxX - combinedMinX;
+  double combinedMinY = input->paddingAboveAssistiveLabels;
+
+  const MDCTextControlAssistiveLabelStyle *style = &input->style;
+  MDCTextControlGeometrySize leadingSize = kZeroSize;
+  MDCTextControlGeometrySize trailingSize = kZeroSize;
+  switch (style->drawPriority) {
+    case MDCTextControlGeometryAssistiveLabelDrawPriorityCustom: {
+      double leadingWidth = style->customDrawPriority * combinedMaxWidth;
+      double trailingWidth = combinedMaxWidth - leadingWidth;
+      leadingSize = AssistiveLabelSize(
+          measurer, MDCTextControlGeometryElementLeadingAssistiveLabel, leadingWidth);
+      trailingSize = AssistiveLabelSize(
+          measurer, MDCTextControlGeometryElementTrailingAssistiveLabel, trailingWidth);
+      break;
+    }
+    case MDCTextControlGeometryAssistiveLabelDrawPriorityLeading:
+      leadingSize = AssistiveLabelSize(
+          measurer, MDCTextControlGeometryElementLeadingAssistiveLabel, combinedMaxWidth);
+      if (!IsLabelMultiline(style->leadingLabelLineHeight, leadingSize)) {
+        trailingSize =
+            AssistiveLabelSize(measurer, MDCTextControlGeometryElementTrailingAssistiveLabel,
+                               combinedMaxWidth - leadingSize.width);
+      }
+      break;
+    case MDCTextControlGeometryAssistiveLabelDrawPriorityTrailing:
+      // Pass through (.trailing is the default priority)
+    default:
+      trailingSize = AssistiveLabelSize(
+          measurer, MDCTextControlGeometryElementTrailingAssistiveLabel, combinedMaxWidth);
+      if (!IsLabelMultiline(style->trailingLabelLineHeight, trailingSize)) {
+        leadingSize =
+            AssistiveLabelSize(measurer, MDCTextControlGeometryElementLeadingAssistiveLabel,
+                               combinedMaxWidth - trailingSize.width);
+      }
+      break;
+  }
+
+  if (SizeIsZero(leadingSize) && SizeIsZero(trailingSize)) {
+    geometry->leadingLabelFrame = kZeroRect;
+    geometry->trailingLabelFrame = kZeroRect;
+    geometry->calculatedHeight = 0;
+    return;
+  }
+
+  MDCTextControlGeometrySize leftSize = isRTL ? trailingSize : leadingSize;
+  MDCTextControlGeometrySize rightSize = isRTL ? leadingSize : trailingSize;
+  MDCTextControlGeometryRect leftFrame = kZeroRect;
+  MDCTextControlGeometryRect rightFrame = kZeroRect;
+  if (!SizeIsZero(leftSize)) {
+    leftFrame = RectMake(combinedMinX, combinedMinY, leftSize.width, leftSize.height);
+  }
+  if (!SizeIsZero(rightSize)) {
+    rightFrame = RectMake(combinedMaxX - rightSize.width, combinedMinY, rightSize.width,
+                          rightSize.height);
+  }
+
+  double maxLabelHeight = fmax(RectGetMaxY(leftFrame), RectGetMaxY(rightFrame));
+  geometry->leadingLabelFrame = isRTL ? rightFrame : leftFrame;
+  geometry->trailingLabelFrame = isRTL ? leftFrame : rightFrame;
+  geometry->calculatedHeight = maxLabelHeight + input->paddingBelowAssistiveLabels;
+}
+
+static void CalculateAssistiveLabels(double width, const MDCTextControlVerticalMetrics *metrics,
+                                     const MDCTextControlHorizontalMetrics *horizontalMetrics,
+                                     MDCTextControlAssistiveLabelStyle style, bool isRTL,
+                                     MDCTextControlGeometryMeasurer measurer,
+                                     MDCTextControlAssistiveLabelGeometry *geometry) {
+  MDCTextControlAssistiveLabelGeometryInput input = {
+      .width = width,
+      .leadingEdgePadding = horizontalMetrics->leadingEdgePadding,
+      .trailingEdgePadding = horizontalMetrics->trailingEdgePadding,
+      .paddingAboveAssistiveLabels = metrics->paddingAboveAssistiveLabels,
+      .paddingBelowAssistiveLabels = metrics->paddingBelowAssistiveLabels,
+      .style = style,
+      .isRTL = isRTL,
+  };
+  MDCTextControlAssistiveLabelGeometryCalculate(&input, measurer, geometry);
+}
+
+// Text fields
+
+static double MinYForSubview(double height, double centerY) {
+  return round(centerY - (0.5 * height));
+}
+
+static MDCTextControlGeometryRect TextFieldLabelFrame(
+    MDCTextControlGeometrySize size, MDCTextControlGeometryLabelPosition labelPosition,
+    double floatingLabelMinY, MDCTextControlGeometryRect textRect, bool isRTL) {
+  double originX = isRTL ? RectGetMaxX(textRect) - size.width : textRect.x;
+  switch (labelPosition) {
+    case MDCTextControlGeometryLabelPositionFloating:
+      return RectMake(originX, floatingLabelMinY, size.width, size.height);
+    case MDCTextControlGeometryLabelPositionNormal:
+      return RectMake(originX, RectGetMidY(textRect) - (0.5 * size.height), size.width,
+                      size.height);
+    case MDCTextControlGeometryLabelPositionNone:
+    default:
+      return kZeroRect;
+  }
+}
+
+void MDCTextFieldGeometryCalculate(const MDCTextFieldGeometryInput *input,
+                                   MDCTextControlGeometryMeasurer measurer,
+                                   MDCTextFieldGeometry *geometry) {
+  bool isRTL = input->isRTL;
+  bool isEditing = input->isEditing;
+  const MDCTextControlVerticalMetrics *metrics = &input->verticalMetrics;
+  const MDCTextControlGeometrySideView *leftView =
+      isRTL ? &input->trailingView : &input->leadingView;
+  const MDCTextControlGeometrySideView *rightView =
+      isRTL ? &input->leadingView : &input->trailingView;
+
+  bool displaysLeftView = MDCTextControlGeometryShouldDisplaySideView(
+      leftView->isPresent, leftView->viewMode, isEditing);
+  bool displaysRightView = MDCTextControlGeometryShouldDisplaySideView(
+      rightView->isPresent, rightView->viewMode, isEditing);
+  bool displaysClearButton =
+      ShouldDisplayClearButton(input->clearButtonMode, isEditing, input->hasText);
+
+  double leadingEdgePadding = input->horizontalMetrics.leadingEdgePadding;
+  double trailingEdgePadding = input->horizontalMetrics.trailingEdgePadding;
+  double leftEdgePadding = isRTL ? trailingEdgePadding : leadingEdgePadding;
+  double rightEdgePadding = isRTL ? leadingEdgePadding : trailingEdgePadding;
+  double interItemPadding = input->horizontalMetrics.horizontalInterItemSpacing;
+  double clearButtonSideLength = input->clearButtonSideLength;
+
+  double leftViewWidth = leftView->size.width;
+  double leftViewMinX = 0;
+  double leftViewMaxX = 0;
+  if (displaysLeftView) {
+    leftViewMinX = leftEdgePadding;
+    leftViewMaxX = leftViewMinX + leftViewWidth;
+  }
+
+  double textFieldWidth = input->width;
+  double rightViewMinX = 0;
+  if (displaysRightView) {
+    double rightViewMaxX = textFieldWidth - rightEdgePadding;
+    rightViewMinX = rightViewMaxX - rightView->size.width;
+  }
+
+  double clearButtonMinX = 0;
+  if (isRTL) {
+    clearButtonMinX = displaysLeftView ? leftViewMaxX + interItemPadding : leftEdgePadding;
+  } else {
+    double clearButtonMaxX = displaysRightView ? rightViewMinX - interItemPadding
+                                               : textFieldWidth - rightEdgePadding;
+    clearButtonMinX = clearButtonMaxX - clearButtonSideLength;
+  }
+
+  double textRectMinX = 0;
+  double textRectMaxX = 0;
+  if (isRTL) {
+    if (displaysClearButton) {
+      double clearButtonMaxX = clearButtonMinX + clearButtonSideLength;
+      textRectMinX = clearButtonMaxX + interItemPadding;
+    } else {
+      textRectMinX = displaysLeftView ? leftViewMaxX + interItemPadding : leftEdgePadding;
+    }
+    if (displaysRightView) {
+      textRectMaxX = rightViewMinX - interItemPadding;
+    } else {
+      textRectMaxX = textFieldWidth - rightEdgePadding;
+    }
+  } else {
+    textRectMinX = displaysLeftView ? leftViewMaxX + interItemPadding : leftEdgePadding;
+    if (displaysClearButton) {
+      textRectMaxX = clearButtonMinX - interItemPadding;
+    } else {
+      textRectMaxX = displaysRightView ? rightViewMinX - interItemPadding
+                                       : textFieldWidth - rightEdgePadding;
+    }
+  }
+
+  bool layoutsForFloatingLabel = input->layoutsForFloatingLabel;
+  double textRectMinYNormal = layoutsForFloatingLabel
+                                  ? metrics->paddingBetweenContainerTopAndNormalLabel
+                                  : metrics->paddingAroundTextWhenNoFloatingLabel;
+
+  double textRectWidth = textRectMaxX - textRectMinX;
+  double textRectHeight = MDCTextControlGeometryTextHeight(input->normalFontLineHeight);
+  MDCTextControlGeometryRect textRectNormal =
+      RectMake(textRectMinX, textRectMinYNormal, textRectWidth, textRectHeight);
+
+  double floatingLabelMinY = metrics->paddingBetweenContainerTopAndFloatingLabel;
+  double floatingLabelMaxY = floatingLabelMinY + input->floatingFontLineHeight;
+  double textRectMinYWithFloatingLabel =
+      floatingLabelMaxY + metrics->paddingBetweenFloatingLabelAndEditingText;
+  double textRectCenterYWithFloatingLabel = textRectMinYWithFloatingLabel + (0.5 * textRectHeight);
+  double textRectMinYFloatingLabel =
+      floor(textRectCenterYWithFloatingLabel - (textRectHeight * 0.5));
+  MDCTextControlGeometryRect textRectFloating =
+      RectMake(textRectMinX, textRectMinYFloatingLabel, textRectWidth, textRectHeight);
+
+  double containerHeight = layoutsForFloatingLabel ? metrics->containerHeightWithFloatingLabel
+                                                   : metrics->containerHeightWithoutFloatingLabel;
+  double containerMidY = 0.5 * containerHeight;
+  bool isFloatingLabel = input->labelPosition == MDCTextControlGeometryLabelPositionFloating;
+  double textRectMidY =
+      isFloatingLabel ? RectGetMidY(textRectFloating) : RectGetMidY(textRectNormal);
+  double sideViewMidY = input->alignsSideViewsWithText ? textRectMidY : containerMidY;
+
+  double leftViewHeight = leftView->size.height;
+  double rightViewHeight = rightView->size.height;
+  MDCTextControlGeometryRect leftViewFrame =
+      RectMake(leftViewMinX, MinYForSubview(leftViewHeight, sideViewMidY), leftViewWidth,
+               leftViewHeight);
+  MDCTextControlGeometryRect rightViewFrame =
+      RectMake(rightViewMinX, MinYForSubview(rightViewHeight, sideViewMidY),
+               rightView->size.width, rightViewHeight);
+  geometry->clearButtonFrame =
+      RectMake(clearButtonMinX, MinYForSubview(clearButtonSideLength, sideViewMidY),
+               clearButtonSideLength, clearButtonSideLength);
+
+  MDCTextControlGeometrySize labelSizeNormal;
+  MDCTextControlGeometrySize labelSizeFloating;
+  geometry->labelTruncationIsPresent =
+      MeasureLabels(measurer, textRectWidth, input->normalFontLineHeight,
+                    input->floatingFontLineHeight, &labelSizeNormal, &labelSizeFloating);
+  geometry->labelFrameNormal =
+      TextFieldLabelFrame(labelSizeNormal, MDCTextControlGeometryLabelPositionNormal,
+                          floatingLabelMinY, textRectNormal, isRTL);
+  geometry->labelFrameFloating =
+      TextFieldLabelFrame(labelSizeFloating, MDCTextControlGeometryLabelPositionFloating,
+                          floatingLabelMinY, textRectNormal, isRTL);
+
+  CalculateAssistiveLabels(textFieldWidth, metrics, &input->horizontalMetrics,
+                           input->assistiveLabelStyle, isRTL, measurer,
+                           &geometry->assistiveLabels);
+  geometry->assistiveLabelViewFrame = RectMake(0, containerHeight, textFieldWidth,
+                                               geometry->assistiveLabels.calculatedHeight);
+  geometry->leadingViewFrame = isRTL ? rightViewFrame : leftViewFrame;
+  geometry->trailingViewFrame = isRTL ? leftViewFrame : rightViewFrame;
+  geometry->displaysLeadingView = isRTL ? displaysRightView : displaysLeftView;
+  geometry->displaysTrailingView = isRTL ? displaysLeftView : displaysRightView;
+  geometry->textRectFloating = textRectFloating;
+  geometry->textRectNormal = textRectNormal;
+  geometry->containerHeight = containerHeight;
+  geometry->calculatedHeight =
+      ceil(fmax(containerHeight, RectGetMaxY(geometry->assistiveLabelViewFrame)));
+}
+
+// Text areas
+
+static void HorizontalGradientLocations(double leftFadeStart, double leftFadeEnd,
+                                        double rightFadeStart, double rightFadeEnd,
+                                        double viewWidth, double *locations) {
+  double leftFadeStartLocation = leftFadeStart / viewWidth;
+  if (leftFadeStartLocation < 0) {
+    leftFadeStartLocation = 0;
+  }
+  double leftFadeEndLocation = leftFadeEnd / viewWidth;
+  if (leftFadeEndLocation < 0) {
+    leftFadeEndLocation = 0;
+  }
+  double rightFadeStartLocation = rightFadeStart / viewWidth;
+  if (rightFadeStartLocation >= 1) {
+    rightFadeStartLocation = 1;
+  }
+  double rightFadeEndLocation = rightFadeEnd / viewWidth;
+  if (rightFadeEndLocation >= 1) {
+    rightFadeEndLocation = 1;
+  }
+  locations[0] = 0;
+  locations[1] = leftFadeStartLocation;
+  locations[2] = leftFadeEndLocation;
+  locations[3] = rightFadeStartLocation;
+  locations[4] = rightFadeEndLocation;
+  locations[5] = 1;
+}
+
+static void VerticalGradientLocations(double topFadeStart, double topFadeEnd,
+                                      double bottomFadeStart, double bottomFadeEnd,
+                                      double containerHeight, double *locations) {
+  double topFadeStartLocation = topFadeStart / containerHeight;
+  if (topFadeStartLocation <= 0) {
+    topFadeStartLocation = 0;
+  }
+  double topFadeEndLocation = topFadeEnd / containerHeight;
+  if (topFadeEndLocation <= 0) {
+    topFadeEndLocation = 0;
+  }
+  double bottomFadeStartLocation = bottomFadeStart / containerHeight;
+  if (bottomFadeStartLocation >= 1) {
+    bottomFadeStartLocation = 1;
+  }
+  double bottomFadeEndLocation = bottomFadeEnd / containerHeight;
+  if (bottomFadeEndLocation >= 1) {
+    bottomFadeEndLocation = 1;
+  }
+  locations[0] = 0;
+  locations[1] = topFadeStartLocation;
+  locations[2] = topFadeEndLocation;
+  locations[3] = bottomFadeStartLocation;
+  locations[4] = bottomFadeEndLocation;
+  locations[5] = 1;
+}
+
+static MDCTextControlGeometryRect TextAreaSideViewFrame(MDCTextControlGeometrySize size,
+                                                        double minX, double containerHeight) {
+  double minY = (0.5 * containerHeight) - (0.5 * size.height);
+  return RectMake(minX, minY, size.width, size.height);
+}
+
+void MDCTextAreaGeometryCalculate(const MDCTextAreaGeometryInput *input,
+                                  MDCTextControlGeometryMeasurer measurer,
+                                  MDCTextAreaGeometry *geometry) {
+  bool isRTL = input->isRTL;
+  bool isEditing = input->isEditing;
+  const MDCTextControlVerticalMetrics *metrics = &input->verticalMetrics;
+  const MDCTextControlGeometrySideView *leftView =
+      isRTL ? &input->trailingView : &input->leadingView;
+  const MDCTextControlGeometrySideView *rightView =
+      isRTL ? &input->leadingView : &input->trailingView;
+
+  bool displaysLeftView = MDCTextControlGeometryShouldDisplaySideView(
+      leftView->isPresent, leftView->viewMode, isEditing);
+  bool displaysRightView = MDCTextControlGeometryShouldDisplaySideView(
+      rightView->isPresent, rightView->viewMode, isEditing);
+
+  double leadingEdgePadding = input->horizontalMetrics.leadingEdgePadding;
+  double trailingEdgePadding = input->horizontalMetrics.trailingEdgePadding;
+  double leftEdgePadding = isRTL ? trailingEdgePadding : leadingEdgePadding;
+  double rightEdgePadding = isRTL ? leadingEdgePadding : trailingEdgePadding;
+  double interItemPadding = input->horizontalMetrics.horizontalInterItemSpacing;
+
+  double leftViewMinX = 0;
+  double leftViewMaxX = 0;
+  if (displaysLeftView) {
+    leftViewMinX = leftEdgePadding;
+    leftViewMaxX = leftViewMinX + leftView->size.width;
+  }
+
+  double textAreaWidth = input->width;
+  double rightViewMinX = 0;
+  if (displaysRightView) {
+    double rightViewMaxX = textAreaWidth - rightEdgePadding;
+    rightViewMinX = rightViewMaxX - rightView->size.width;
+  }
+
+  double textRectMinX = displaysLeftView ? leftViewMaxX + interItemPadding : leftEdgePadding;
+  double textRectMaxX = displaysRightView ? rightViewMinX - interItemPadding
+                                          : textAreaWidth - rightEdgePadding;
+  double textRectWidth = textRectMaxX - textRectMinX;
+
+  MDCTextControlGeometrySize labelSizeNormal;
+  MDCTextControlGeometrySize labelSizeFloating;
+  geometry->labelTruncationIsPresent =
+      MeasureLabels(measurer, textRectWidth, input->normalFontLineHeight,
+                    input->floatingFontLineHeight, &labelSizeNormal, &labelSizeFloating);
+
+  MDCTextControlGeometryRect floatingLabelFrame = RectMake(
+      isRTL ? textRectMaxX - labelSizeFloating.width : textRectMinX,
+      metrics->paddingBetweenContainerTopAndFloatingLabel, labelSizeFloating.width,
+      labelSizeFloating.height);
+  double floatingLabelMaxY = RectGetMaxY(floatingLabelFrame);
+  MDCTextControlGeometryRect normalLabelFrame =
+      RectMake(isRTL ? textRectMaxX - labelSizeNormal.width : textRectMinX,
+               metrics->paddingBetweenContainerTopAndNormalLabel, labelSizeNormal.width,
+               labelSizeNormal.height);
+
+  double textViewMinY = 0;
+  double bottomPadding = 0;
+  double containerHeight = 0;
+  bool layoutsForFloatingLabel = input->layoutsForFloatingLabel;
+  if (layoutsForFloatingLabel) {
+    if (input->labelPosition == MDCTextControlGeometryLabelPositionFloating) {
+      textViewMinY = floatingLabelMaxY + metrics->paddingBetweenFloatingLabelAndEditingText;
+    } else {
+      textViewMinY = RectGetMidY(normalLabelFrame) - (0.5 * input->normalFontLineHeight);
+    }
+    bottomPadding = metrics->paddingBetweenEditingTextAndContainerBottom;
+    containerHeight = metrics->containerHeightWithFloatingLabel;
+  } else {
+    textViewMinY = metrics->paddingAroundTextWhenNoFloatingLabel;
+    bottomPadding = metrics->paddingAroundTextWhenNoFloatingLabel;
+    containerHeight = metrics->containerHeightWithoutFloatingLabel;
+    normalLabelFrame.y = textViewMinY;
+  }
+  double textViewHeight = containerHeight - bottomPadding - textViewMinY;
+  MDCTextControlGeometryRect textViewFrame =
+      RectMake(textRectMinX, textViewMinY, textRectWidth, textViewHeight);
+
+  geometry->placeholderLabelHidden = !input->hasPlaceholder;
+  if (geometry->placeholderLabelHidden) {
+    geometry->placeholderLabelFrame = kZeroRect;
+  } else {
+    MDCTextControlGeometrySize placeholderSize =
+        Measure(measurer, MDCTextControlGeometryElementPlaceholder, textViewFrame.width,
+                textViewFrame.height);
+    double placeholderMinX = isRTL ? textRectWidth - placeholderSize.width : 0;
+    geometry->placeholderLabelFrame =
+        RectMake(placeholderMinX, 0, placeholderSize.width, placeholderSize.height);
+  }
+
+  MDCTextControlGeometryRect leftViewFrame =
+      displaysLeftView ? TextAreaSideViewFrame(leftView->size, leftViewMinX, containerHeight)
+                       : kZeroRect;
+  MDCTextControlGeometryRect rightViewFrame =
+      displaysRightView ? TextAreaSideViewFrame(rightView->size, rightViewMinX, containerHeight)
+                        : kZeroRect;
+  geometry->leadingViewFrame = isRTL ? rightViewFrame : leftViewFrame;
+  geometry->trailingViewFrame = isRTL ? leftViewFrame : rightViewFrame;
+  geometry->displaysLeadingView = isRTL ? displaysRightView : displaysLeftView;
+  geometry->displaysTrailingView = isRTL ? displaysLeftView : displaysRightView;
+
+  CalculateAssistiveLabels(textAreaWidth, metrics, &input->horizontalMetrics,
+                           input->assistiveLabelStyle, isRTL, measurer,
+                           &geometry->assistiveLabels);
+  geometry->assistiveLabelViewFrame = RectMake(0, containerHeight, textAreaWidth,
+                                               geometry->assistiveLabels.calculatedHeight);
+
+  geometry->containerHeight = containerHeight;
+  geometry->calculatedHeight =
+      fmax(containerHeight, RectGetMaxY(geometry->assistiveLabelViewFrame));
+  geometry->textViewFrame = textViewFrame;
+  geometry->labelFrameFloating = floatingLabelFrame;
+  geometry->labelFrameNormal = normalLabelFrame;
+
+  HorizontalGradientLocations(0, kGradientBlurLength, textAreaWidth - kGradientBlurLength,
+                              textAreaWidth, textAreaWidth, geometry->horizontalGradientLocations);
+  if (layoutsForFloatingLabel) {
+    double topFadeStart = floatingLabelMaxY;
+    double topFadeEnd = floatingLabelMaxY + kGradientBlurLength;
+    double bottomFadeStart = metrics->containerHeightWithFloatingLabel - bottomPadding;
+    double bottomFadeEnd = bottomFadeStart + kGradientBlurLength;
+    VerticalGradientLocations(topFadeStart, topFadeEnd, bottomFadeStart, bottomFadeEnd,
+                              metrics->containerHeightWithFloatingLabel,
+                              geometry->verticalGradientLocations);
+  } else {
+    double topFadeEnd = metrics->paddingAroundTextWhenNoFloatingLabel;
+    double topFadeStart = topFadeEnd - kGradientBlurLength;
+    double bottomFadeStart = metrics->containerHeightWithoutFloatingLabel -
+                             metrics->paddingAroundTextWhenNoFloatingLabel;
+    double bottomFadeEnd = bottomFadeStart + kGradientBlurLength;
+    VerticalGradientLocations(topFadeStart, topFadeEnd, bottomFadeStart, bottomFadeEnd,
+                              metrics->containerHeightWithoutFloatingLabel,
+                              geometry->verticalGradientLocations);
+  }
+}
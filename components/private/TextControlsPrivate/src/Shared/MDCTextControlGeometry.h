@@ -0,0 +1,255 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MDCTextControlGeometry_h
+#define MDCTextControlGeometry_h
+
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ The geometry engine behind MDCBaseTextFieldLayout, MDCBaseTextAreaLayout and
+ MDCTextControlAssistiveLabelViewLayout.
+
+ The engine has no UIKit dependency: text is measured by the caller through an
+ @c MDCTextControlGeometryMeasurer, so the engine itself never touches a font or a label.
+ */
+
+/** A rectangle with the same semantics as CGRect. */
+typedef struct MDCTextControlGeometryRect {
+  double x;
+  double y;
+  double width;
+  double height;
+} MDCTextControlGeometryRect;
+
+/** A size with the same semantics as CGSize. */
+typedef struct MDCTextControlGeometrySize {
+  double width;
+  double height;
+} MDCTextControlGeometrySize;
+
+/** Mirrors UITextFieldViewMode. */
+typedef enum MDCTextControlGeometryViewMode {
+  MDCTextControlGeometryViewModeNever = 0,
+  MDCTextControlGeometryViewModeWhileEditing = 1,
+  MDCTextControlGeometryViewModeUnlessEditing = 2,
+  MDCTextControlGeometryViewModeAlways = 3,
+} MDCTextControlGeometryViewMode;
+
+/** Mirrors MDCTextControlLabelPosition. */
+typedef enum MDCTextControlGeometryLabelPosition {
+  MDCTextControlGeometryLabelPositionNone = 0,
+  MDCTextControlGeometryLabelPositionFloating = 1,
+  MDCTextControlGeometryLabelPositionNormal = 2,
+} MDCTextControlGeometryLabelPosition;
+
+/** Mirrors MDCTextControlAssistiveLabelDrawPriority. */
+typedef enum MDCTextControlGeometryAssistiveLabelDrawPriority {
+  MDCTextControlGeometryAssistiveLabelDrawPriorityLeading = 0,
+  MDCTextControlGeometryAssistiveLabelDrawPriorityTrailing = 1,
+  MDCTextControlGeometryAssistiveLabelDrawPriorityCustom = 2,
+} MDCTextControlGeometryAssistiveLabelDrawPriority;
+
+/** The pieces of text the engine asks the caller to measure. */
+typedef enum MDCTextControlGeometryElement {
+  /** The label, drawn with the normal font. */
+  MDCTextControlGeometryElementNormalLabel,
+  /** The label, drawn with the floating font. */
+  MDCTextControlGeometryElementFloatingLabel,
+  /** A text area's placeholder label. */
+  MDCTextControlGeometryElementPlaceholder,
+  MDCTextControlGeometryElementLeadingAssistiveLabel,
+  MDCTextControlGeometryElementTrailingAssistiveLabel,
+} MDCTextControlGeometryElement;
+
+/**
+ Measures @c element within @c fittingSize. Labels are given a fitting height of @c DBL_MAX.
+ Elements with no text, or that are hidden, should measure as a zero size.
+ */
+typedef MDCTextControlGeometrySize (*MDCTextControlGeometryMeasureFunction)(
+    MDCTextControlGeometryElement element, MDCTextControlGeometrySize fittingSize, void *context);
+
+typedef struct MDCTextControlGeometryMeasurer {
+  MDCTextControlGeometryMeasureFunction measure;
+  void *context;
+} MDCTextControlGeometryMeasurer;
+
+/** The values vended by an MDCTextControlVerticalPositioningReference. */
+typedef struct MDCTextControlVerticalMetrics {
+  double paddingBetweenContainerTopAndFloatingLabel;
+  double paddingBetweenContainerTopAndNormalLabel;
+  double paddingBetweenFloatingLabelAndEditingText;
+  double paddingBetweenEditingTextAndContainerBottom;
+  double paddingAboveAssistiveLabels;
+  double paddingBelowAssistiveLabels;
+  double containerHeightWithFloatingLabel;
+  double containerHeightWithoutFloatingLabel;
+  double paddingAroundTextWhenNoFloatingLabel;
+} MDCTextControlVerticalMetrics;
+
+/** The values vended by an MDCTextControlHorizontalPositioning object. */
+typedef struct MDCTextControlHorizontalMetrics {
+  double leadingEdgePadding;
+  double trailingEdgePadding;
+  double horizontalInterItemSpacing;
+} MDCTextControlHorizontalMetrics;
+
+/** A leading or trailing view. */
+typedef struct MDCTextControlGeometrySideView {
+  /** Whether the view exists and has a non-zero frame size. */
+  bool isPresent;
+  /** The size the view is laid out at. */
+  MDCTextControlGeometrySize size;
+  MDCTextControlGeometryViewMode viewMode;
+} MDCTextControlGeometrySideView;
+
+/** How the two assistive labels share the space below the container. */
+typedef struct MDCTextControlAssistiveLabelStyle {
+  MDCTextControlGeometryAssistiveLabelDrawPriority drawPriority;
+  /** The leading label's share of the space when @c drawPriority is custom, in [0, 1]. */
+  double customDrawPriority;
+  double leadingLabelLineHeight;
+  double trailingLabelLineHeight;
+} MDCTextControlAssistiveLabelStyle;
+
+// Assistive labels
+
+typedef struct MDCTextControlAssistiveLabelGeometryInput {
+  double width;
+  double leadingEdgePadding;
+  double trailingEdgePadding;
+  double paddingAboveAssistiveLabels;
+  double paddingBelowAssistiveLabels;
+  MDCTextControlAssistiveLabelStyle style;
+  bool isRTL;
+} MDCTextControlAssistiveLabelGeometryInput;
+
+typedef struct MDCTextControlAssistiveLabelGeometry {
+  MDCTextControlGeometryRect leadingLabelFrame;
+  MDCTextControlGeometryRect trailingLabelFrame;
+  double calculatedHeight;
+} MDCTextControlAssistiveLabelGeometry;
+
+void MDCTextControlAssistiveLabelGeometryCalculate(
+    const MDCTextControlAssistiveLabelGeometryInput *input, MDCTextControlGeometryMeasurer measurer,
+    MDCTextControlAssistiveLabelGeometry *geometry);
+
+// Text fields
+
+typedef struct MDCTextFieldGeometryInput {
+  double width;
+  MDCTextControlVerticalMetrics verticalMetrics;
+  MDCTextControlHorizontalMetrics horizontalMetrics;
+  double normalFontLineHeight;
+  double floatingFontLineHeight;
+  MDCTextControlGeometryLabelPosition labelPosition;
+  /** Whether the container should leave room for a floating label. */
+  bool layoutsForFloatingLabel;
+  /** Whether side views share the text rect's mid Y instead of the container's. */
+  bool alignsSideViewsWithText;
+  MDCTextControlGeometrySideView leadingView;
+  MDCTextControlGeometrySideView trailingView;
+  double clearButtonSideLength;
+  MDCTextControlGeometryViewMode clearButtonMode;
+  bool hasText;
+  MDCTextControlAssistiveLabelStyle assistiveLabelStyle;
+  bool isRTL;
+  bool isEditing;
+} MDCTextFieldGeometryInput;
+
+typedef struct MDCTextFieldGeometry {
+  bool displaysLeadingView;
+  bool displaysTrailingView;
+  MDCTextControlGeometryRect leadingViewFrame;
+  MDCTextControlGeometryRect trailingViewFrame;
+  MDCTextControlGeometryRect clearButtonFrame;
+  MDCTextControlGeometryRect labelFrameNormal;
+  MDCTextControlGeometryRect labelFrameFloating;
+  MDCTextControlGeometryRect textRectNormal;
+  MDCTextControlGeometryRect textRectFloating;
+  MDCTextControlGeometryRect assistiveLabelViewFrame;
+  MDCTextControlAssistiveLabelGeometry assistiveLabels;
+  double containerHeight;
+  double calculatedHeight;
+  bool labelTruncationIsPresent;
+} MDCTextFieldGeometry;
+
+void MDCTextFieldGeometryCalculate(const MDCTextFieldGeometryInput *input,
+                                   MDCTextControlGeometryMeasurer measurer,
+                                   MDCTextFieldGeometry *geometry);
+
+// Text areas
+
+/** The number of stops in each of a text area's gradient fades. */
+#define MDCTextAreaGeometryGradientLocationCount 6
+
+typedef struct MDCTextAreaGeometryInput {
+  double width;
+  MDCTextControlVerticalMetrics verticalMetrics;
+  MDCTextControlHorizontalMetrics horizontalMetrics;
+  double normalFontLineHeight;
+  double floatingFontLineHeight;
+  MDCTextControlGeometryLabelPosition labelPosition;
+  /** Whether the container should leave room for a floating label. */
+  bool layoutsForFloatingLabel;
+  bool hasPlaceholder;
+  MDCTextControlGeometrySideView leadingView;
+  MDCTextControlGeometrySideView trailingView;
+  MDCTextControlAssistiveLabelStyle assistiveLabelStyle;
+  bool isRTL;
+  bool isEditing;
+} MDCTextAreaGeometryInput;
+
+typedef struct MDCTextAreaGeometry {
+  bool displaysLeadingView;
+  bool displaysTrailingView;
+  MDCTextControlGeometryRect leadingViewFrame;
+  MDCTextControlGeometryRect trailingViewFrame;
+  MDCTextControlGeometryRect labelFrameNormal;
+  MDCTextControlGeometryRect labelFrameFloating;
+  bool placeholderLabelHidden;
+  MDCTextControlGeometryRect placeholderLabelFrame;
+  MDCTextControlGeometryRect textViewFrame;
+  MDCTextControlGeometryRect assistiveLabelViewFrame;
+  MDCTextControlAssistiveLabelGeometry assistiveLabels;
+  double containerHeight;
+  double calculatedHeight;
+  double horizontalGradientLocations[MDCTextAreaGeometryGradientLocationCount];
+  double verticalGradientLocations[MDCTextAreaGeometryGradientLocationCount];
+  bool labelTruncationIsPresent;
+} MDCTextAreaGeometry;
+
+void MDCTextAreaGeometryCalculate(const MDCTextAreaGeometryInput *input,
+                                  MDCTextControlGeometryMeasurer measurer,
+                                  MDCTextAreaGeometry *geometry);
+
+// Helpers
+
+/** Whether a side view is shown for the given view mode and editing state. */
+bool MDCTextControlGeometryShouldDisplaySideView(bool isPresent,
+                                                 MDCTextControlGeometryViewMode viewMode,
+                                                 bool isEditing);
+
+/** The height of a single line of text, given the font's line height. */
+double MDCTextControlGeometryTextHeight(double lineHeight);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif  // MDCTextControlGeometry_h
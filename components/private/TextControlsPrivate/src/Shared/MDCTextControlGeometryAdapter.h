@@ -0,0 +1,64 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "MDCTextControlAssistiveLabelDrawPriority.h"
+#import "MDCTextControlGeometry.h"
+#import "MDCTextControlHorizontalPositioning.h"
+#import "MDCTextControlVerticalPositioningReference.h"
+
+/**
+ Conversions between UIKit objects and the plain structs consumed and produced by the text control
+ geometry engine in MDCTextControlGeometry.h.
+ */
+
+static inline CGRect MDCTextControlCGRectFromGeometryRect(MDCTextControlGeometryRect rect) {
+  return CGRectMake((CGFloat)rect.x, (CGFloat)rect.y, (CGFloat)rect.width, (CGFloat)rect.height);
+}
+
+MDCTextControlVerticalMetrics MDCTextControlVerticalMetricsWithPositioningReference(
+    id<MDCTextControlVerticalPositioningReference> _Nonnull positioningReference);
+
+MDCTextControlHorizontalMetrics MDCTextControlHorizontalMetricsWithPositioningReference(
+    id<MDCTextControlHorizontalPositioning> _Nonnull positioningReference);
+
+/**
+ Describes a side view to the geometry engine. @c size is the size the view should be laid out at,
+ while the view's frame size decides whether it is present at all.
+ */
+MDCTextControlGeometrySideView MDCTextControlGeometrySideViewWithSideView(
+    UIView *_Nullable sideView, CGSize size, UITextFieldViewMode viewMode);
+
+MDCTextControlAssistiveLabelStyle MDCTextControlAssistiveLabelStyleWith(
+    MDCTextControlAssistiveLabelDrawPriority drawPriority, CGFloat customDrawPriority,
+    UILabel *_Nonnull leadingAssistiveLabel, UILabel *_Nonnull trailingAssistiveLabel);
+
+/**
+ Measures a text control's labels on behalf of the geometry engine. The measurer it vends does not
+ retain the object, so a local holding it must be declared @c NS_VALID_UNTIL_END_OF_SCOPE to keep
+ it alive for as long as the measurer is in use.
+ */
+@interface MDCTextControlGeometryTextMeasurer : NSObject
+
+@property(nonatomic, strong, nullable) UILabel *label;
+@property(nonatomic, strong, nullable) UIFont *normalFont;
+@property(nonatomic, strong, nullable) UIFont *floatingFont;
+@property(nonatomic, strong, nullable) UILabel *placeholderLabel;
+@property(nonatomic, strong, nullable) UILabel *leadingAssistiveLabel;
+@property(nonatomic, strong, nullable) UILabel *trailingAssistiveLabel;
+
+@property(nonatomic, readonly) MDCTextControlGeometryMeasurer measurer;
+
+@end
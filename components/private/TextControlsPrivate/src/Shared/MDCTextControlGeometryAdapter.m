@@ -0,0 +1,147 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCTextControlGeometryAdapter.h"
+
+#import "MDCTextControlLabelSupport.h"
+
+// The engine's enums mirror their UIKit and MDCTextControl counterparts value for value so that
+// adapters can cast between them.
+_Static_assert(MDCTextControlGeometryViewModeNever == (int)UITextFieldViewModeNever, "");
+_Static_assert(MDCTextControlGeometryViewModeWhileEditing == (int)UITextFieldViewModeWhileEditing,
+               "");
+_Static_assert(MDCTextControlGeometryViewModeUnlessEditing == (int)UITextFieldViewModeUnlessEditing,
+               "");
+_Static_assert(MDCTextControlGeometryViewModeAlways == (int)UITextFieldViewModeAlways, "");
+_Static_assert(MDCTextControlGeometryLabelPositionNone == (int)MDCTextControlLabelPositionNone, "");
+_Static_assert(MDCTextControlGeometryLabelPositionFloating ==
+                   (int)MDCTextControlLabelPositionFloating,
+               "");
+_Static_assert(MDCTextControlGeometryLabelPositionNormal == (int)MDCTextControlLabelPositionNormal,
+               "");
+_Static_assert(MDCTextControlGeometryAssistiveLabelDrawPriorityLeading ==
+                   (int)MDCTextControlAssistiveLabelDrawPriorityLeading,
+               "");
+_Static_assert(MDCTextControlGeometryAssistiveLabelDrawPriorityTrailing ==
+                   (int)MDCTextControlAssistiveLabelDrawPriorityTrailing,
+               "");
+_Static_assert(MDCTextControlGeometryAssistiveLabelDrawPriorityCustom ==
+                   (int)MDCTextControlAssistiveLabelDrawPriorityCustom,
+               "");
+
+MDCTextControlVerticalMetrics MDCTextControlVerticalMetricsWithPositioningReference(
+    id<MDCTextControlVerticalPositioningReference> positioningReference) {
+  MDCTextControlVerticalMetrics metrics = {
+      .paddingBetweenContainerTopAndFloatingLabel =
+          positioningReference.paddingBetweenContainerTopAndFloatingLabel,
+      .paddingBetweenContainerTopAndNormalLabel =
+          positioningReference.paddingBetweenContainerTopAndNormalLabel,
+      .paddingBetweenFloatingLabelAndEditingText =
+          positioningReference.paddingBetweenFloatingLabelAndEditingText,
+      .paddingBetweenEditingTextAndContainerBottom =
+          positioningReference.paddingBetweenEditingTextAndContainerBottom,
+      .paddingAboveAssistiveLabels = positioningReference.paddingAboveAssistiveLabels,
+      .paddingBelowAssistiveLabels = positioningReference.paddingBelowAssistiveLabels,
+      .containerHeightWithFloatingLabel = positioningReference.containerHeightWithFloatingLabel,
+      .containerHeightWithoutFloatingLabel =
+          positioningReference.containerHeightWithoutFloatingLabel,
+      .paddingAroundTextWhenNoFloatingLabel =
+          positioningReference.paddingAroundTextWhenNoFloatingLabel,
+  };
+  return metrics;
+}
+
+MDCTextControlHorizontalMetrics MDCTextControlHorizontalMetricsWithPositioningReference(
+    id<MDCTextControlHorizontalPositioning> positioningReference) {
+  MDCTextControlHorizontalMetrics metrics = {
+      .leadingEdgePadding = positioningReference.leadingEdgePadding,
+      .trailingEdgePadding = positioningReference.trailingEdgePadding,
+      .horizontalInterItemSpacing = positioningReference.horizontalInterItemSpacing,
+  };
+  return metrics;
+}
+
+MDCTextControlGeometrySideView MDCTextControlGeometrySideViewWithSideView(
+    UIView *sideView, CGSize size, UITextFieldViewMode viewMode) {
+  MDCTextControlGeometrySideView geometrySideView = {
+      .isPresent = sideView != nil && !CGSizeEqualToSize(CGSizeZero, sideView.frame.size),
+      .size = {size.width, size.height},
+      .viewMode = (MDCTextControlGeometryViewMode)viewMode,
+  };
+  return geometrySideView;
+}
+
+MDCTextControlAssistiveLabelStyle MDCTextControlAssistiveLabelStyleWith(
+    MDCTextControlAssistiveLabelDrawPriority drawPriority, CGFloat customDrawPriority,
+    UILabel *leadingAssistiveLabel, UILabel *trailingAssistiveLabel) {
+  MDCTextControlAssistiveLabelStyle style = {
+      .drawPriority = (MDCTextControlGeometryAssistiveLabelDrawPriority)drawPriority,
+      .customDrawPriority = customDrawPriority,
+      .leadingLabelLineHeight = leadingAssistiveLabel.font.lineHeight,
+      .trailingLabelLineHeight = trailingAssistiveLabel.font.lineHeight,
+  };
+  return style;
+}
+
+static MDCTextControlGeometrySize MDCTextControlGeometrySizeFromCGSize(CGSize size) {
+  MDCTextControlGeometrySize geometrySize = {size.width, size.height};
+  return geometrySize;
+}
+
+static CGSize AssistiveLabelSize(UILabel *label, CGFloat maxWidth) {
+  if (label.text.length <= 0 || label.hidden) {
+    return CGSizeZero;
+  }
+  return [label sizeThatFits:CGSizeMake(maxWidth, CGFLOAT_MAX)];
+}
+
+static MDCTextControlGeometrySize MeasureElement(MDCTextControlGeometryElement element,
+                                                 MDCTextControlGeometrySize fittingSize,
+                                                 void *context) {
+  MDCTextControlGeometryTextMeasurer *textMeasurer =
+      (__bridge MDCTextControlGeometryTextMeasurer *)context;
+  CGFloat width = (CGFloat)fittingSize.width;
+  CGSize size = CGSizeZero;
+  switch (element) {
+    case MDCTextControlGeometryElementNormalLabel:
+      size = MDCTextControlLabelSizeWith(textMeasurer.label.text, width, textMeasurer.normalFont);
+      break;
+    case MDCTextControlGeometryElementFloatingLabel:
+      size = MDCTextControlLabelSizeWith(textMeasurer.label.text, width, textMeasurer.floatingFont);
+      break;
+    case MDCTextControlGeometryElementPlaceholder:
+      size = [textMeasurer.placeholderLabel
+          sizeThatFits:CGSizeMake(width, (CGFloat)fittingSize.height)];
+      break;
+    case MDCTextControlGeometryElementLeadingAssistiveLabel:
+      size = AssistiveLabelSize(textMeasurer.leadingAssistiveLabel, width);
+      break;
+    case MDCTextControlGeometryElementTrailingAssistiveLabel:
+      size = AssistiveLabelSize(textMeasurer.trailingAssistiveLabel, width);
+      break;
+  }
+  return MDCTextControlGeometrySizeFromCGSize(size);
+}
+
+@implementation MDCTextControlGeometryTextMeasurer
+
+- (MDCTextControlGeometryMeasurer)measurer {
+  MDCTextControlGeometryMeasurer measurer = {
+      .measure = MeasureElement,
+      .context = (__bridge void *)self,
+  };
+  return measurer;
+}
+
+@end
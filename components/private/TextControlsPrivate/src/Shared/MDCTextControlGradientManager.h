@@ -25,6 +25,29 @@
 @property(strong, nonatomic) CAGradientLayer *horizontalGradient;
 @property(strong, nonatomic) CAGradientLayer *verticalGradient;
 
+/**
+ Returns a layer whose contents are the horizontal gradient masked by the vertical gradient.
+
+ The mask image is computed directly from the gradients' sizes, colors and locations and shared by
+ every manager in the process, so only the first request for a given fade draws it. The same layer
+ is returned for as long as those inputs stay the same.
+ */
 - (CALayer *)combinedGradientMaskLayer;
 
 @end
+
+/**
+ The number of gradient mask images drawn since launch or the last call to
+ @c MDCTextControlGradientMaskImageResetDrawCount.
+ */
+FOUNDATION_EXTERN NSUInteger MDCTextControlGradientMaskImageDrawCount(void);
+
+/**
+ Resets the gradient mask image draw counter to zero.
+ */
+FOUNDATION_EXTERN void MDCTextControlGradientMaskImageResetDrawCount(void);
+
+/**
+ Empties the shared gradient mask image cache.
+ */
+FOUNDATION_EXTERN void MDCTextControlGradientMaskImageRemoveAllImages(void);
@@ -16,7 +16,196 @@
 
 #import <UIKit/UIKit.h>
 
+/**
+ The scale mask images are drawn at. The masks used to be rendered with
+ UIGraphicsBeginImageContext, which draws at a scale of 1, and a soft fade gains nothing from more
+ pixels.
+ */
+static const CGFloat kGradientMaskScale = 1;
+
+/** Masks of up to a few dozen distinct text area sizes are kept around at once. */
+static const NSUInteger kGradientMaskCacheCountLimit = 32;
+
+static NSUInteger gGradientMaskImageDrawCount = 0;
+
+/**
+ Returns the stops of @c gradient as the gradient's locations followed by the alpha of each of its
+ colors. Like CAGradientLayer, evenly spaced locations are used when the gradient has none.
+ */
+static NSData *MDCTextControlGradientStops(CAGradientLayer *gradient) {
+  NSArray *colors = gradient.colors;
+  NSArray<NSNumber *> *locations = gradient.locations;
+  NSUInteger count = colors.count;
+  BOOL hasLocations = locations.count == count;
+  NSMutableData *stops = [NSMutableData dataWithLength:2 * count * sizeof(double)];
+  double *values = stops.mutableBytes;
+  for (NSUInteger i = 0; i < count; i++) {
+    if (hasLocations) {
+      values[i] = locations[i].doubleValue;
+    } else {
+      values[i] = count > 1 ? (double)i / (double)(count - 1) : 0;
+    }
+    values[count + i] = CGColorGetAlpha((__bridge CGColorRef)colors[i]);
+  }
+  return stops;
+}
+
+/** Returns the alpha of a gradient with the given stops at @c location, which is in [0, 1]. */
+static double MDCTextControlGradientAlphaAtLocation(NSData *stops, double location) {
+  NSUInteger count = stops.length / (2 * sizeof(double));
+  if (count == 0) {
+    return 0;
+  }
+  const double *locations = stops.bytes;
+  const double *alphas = locations + count;
+  if (location <= locations[0]) {
+    return alphas[0];
+  }
+  for (NSUInteger i = 1; i < count; i++) {
+    if (location <= locations[i]) {
+      double span = locations[i] - locations[i - 1];
+      if (span <= 0) {
+        return alphas[i];
+      }
+      double fraction = (location - locations[i - 1]) / span;
+      return alphas[i - 1] + (alphas[i] - alphas[i - 1]) * fraction;
+    }
+  }
+  return alphas[count - 1];
+}
+
+/** The inputs that determine a gradient mask image. */
+@interface MDCTextControlGradientMaskKey : NSObject
+- (instancetype)initWithSize:(CGSize)size
+                       scale:(CGFloat)scale
+             horizontalStops:(NSData *)horizontalStops
+               verticalStops:(NSData *)verticalStops;
+@end
+
+@implementation MDCTextControlGradientMaskKey {
+ @public
+  CGSize _size;
+  CGFloat _scale;
+  NSData *_horizontalStops;
+  NSData *_verticalStops;
+}
+
+- (instancetype)initWithSize:(CGSize)size
+                       scale:(CGFloat)scale
+             horizontalStops:(NSData *)horizontalStops
+               verticalStops:(NSData *)verticalStops {
+  self = [super init];
+  if (self) {
+    _size = size;
+    _scale = scale;
+    _horizontalStops = horizontalStops;
+    _verticalStops = verticalStops;
+  }
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCTextControlGradientMaskKey class]]) {
+    return NO;
+  }
+  MDCTextControlGradientMaskKey *key = object;
+  return CGSizeEqualToSize(_size, key->_size) && _scale == key->_scale &&
+         [_horizontalStops isEqualToData:key->_horizontalStops] &&
+         [_verticalStops isEqualToData:key->_verticalStops];
+}
+
+- (NSUInteger)hash {
+  return (NSUInteger)_size.width ^ ((NSUInteger)_size.height << 16) ^ _horizontalStops.hash ^
+         (_verticalStops.hash << 1);
+}
+
+@end
+
+static NSCache<MDCTextControlGradientMaskKey *, UIImage *> *MDCTextControlGradientMaskCache(void) {
+  static NSCache *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [[NSCache alloc] init];
+    cache.countLimit = kGradientMaskCacheCountLimit;
+  });
+  return cache;
+}
+
+/**
+ Computes the alpha-only mask image for @c key. Both gradients are linear along a single axis, so
+ every pixel is the product of a column alpha and a row alpha; no layer is rendered.
+ */
+static UIImage *MDCTextControlDrawGradientMaskImage(MDCTextControlGradientMaskKey *key) {
+  CGFloat pixelWidth = key->_size.width * key->_scale;
+  CGFloat pixelHeight = key->_size.height * key->_scale;
+  size_t width = (size_t)ceil(pixelWidth);
+  size_t height = (size_t)ceil(pixelHeight);
+  if (width == 0 || height == 0) {
+    return nil;
+  }
+  CGContextRef context =
+      CGBitmapContextCreate(NULL, width, height, 8, 0, NULL, (CGBitmapInfo)kCGImageAlphaOnly);
+  if (!context) {
+    return nil;
+  }
+  gGradientMaskImageDrawCount++;
+
+  size_t bytesPerRow = CGBitmapContextGetBytesPerRow(context);
+  uint8_t *pixels = CGBitmapContextGetData(context);
+  double *columnAlphas = malloc(width * sizeof(double));
+  for (size_t x = 0; x < width; x++) {
+    columnAlphas[x] =
+        MDCTextControlGradientAlphaAtLocation(key->_horizontalStops, (x + 0.5) / pixelWidth);
+  }
+  for (size_t y = 0; y < height; y++) {
+    double rowAlpha =
+        MDCTextControlGradientAlphaAtLocation(key->_verticalStops, (y + 0.5) / pixelHeight);
+    uint8_t *row = pixels + y * bytesPerRow;
+    for (size_t x = 0; x < width; x++) {
+      row[x] = (uint8_t)lround(255 * columnAlphas[x] * rowAlpha);
+    }
+  }
+  free(columnAlphas);
+
+  CGImageRef imageRef = CGBitmapContextCreateImage(context);
+  CGContextRelease(context);
+  UIImage *image = [UIImage imageWithCGImage:imageRef
+                                       scale:key->_scale
+                                 orientation:UIImageOrientationUp];
+  CGImageRelease(imageRef);
+  return image;
+}
+
+static UIImage *MDCTextControlGradientMaskImage(MDCTextControlGradientMaskKey *key) {
+  NSCache<MDCTextControlGradientMaskKey *, UIImage *> *cache = MDCTextControlGradientMaskCache();
+  UIImage *image = [cache objectForKey:key];
+  if (!image) {
+    image = MDCTextControlDrawGradientMaskImage(key);
+    if (image) {
+      [cache setObject:image forKey:key];
+    }
+  }
+  return image;
+}
+
+NSUInteger MDCTextControlGradientMaskImageDrawCount(void) {
+  return gGradientMaskImageDrawCount;
+}
+
+void MDCTextControlGradientMaskImageResetDrawCount(void) {
+  gGradientMaskImageDrawCount = 0;
+}
+
+void MDCTextControlGradientMaskImageRemoveAllImages(void) {
+  [MDCTextControlGradientMaskCache() removeAllObjects];
+}
+
 @interface MDCTextControlGradientManager ()
+@property(nonatomic, strong) CALayer *maskLayer;
+@property(nonatomic, strong) MDCTextControlGradientMaskKey *maskKey;
 @end
 
 @implementation MDCTextControlGradientManager
@@ -45,24 +234,18 @@
 }
 
 - (CALayer *)combinedGradientMaskLayer {
-  return [self layerCombiningHorizontalGradient:self.horizontalGradient
-                           withVerticalGradient:self.verticalGradient];
-}
-
-- (CALayer *)layerCombiningHorizontalGradient:(CAGradientLayer *)horizontalGradient
-                         withVerticalGradient:(CAGradientLayer *)verticalGradient {
-  horizontalGradient.mask = verticalGradient;
-  UIImage *image = [self createImageWithLayer:horizontalGradient];
-  CALayer *layer = [self createLayerWithImage:image];
-  return layer;
-}
-
-- (UIImage *)createImageWithLayer:(CALayer *)layer {
-  UIGraphicsBeginImageContext(layer.frame.size);
-  [layer renderInContext:UIGraphicsGetCurrentContext()];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-  return image;
+  // The vertical gradient masks the horizontal one and is expected to share its frame.
+  MDCTextControlGradientMaskKey *key = [[MDCTextControlGradientMaskKey alloc]
+         initWithSize:self.horizontalGradient.bounds.size
+                scale:kGradientMaskScale
+      horizontalStops:MDCTextControlGradientStops(self.horizontalGradient)
+        verticalStops:MDCTextControlGradientStops(self.verticalGradient)];
+  if (self.maskLayer && [key isEqual:self.maskKey]) {
+    return self.maskLayer;
+  }
+  self.maskLayer = [self createLayerWithImage:MDCTextControlGradientMaskImage(key)];
+  self.maskKey = key;
+  return self.maskLayer;
 }
 
 - (CALayer *)createLayerWithImage:(UIImage *)image {
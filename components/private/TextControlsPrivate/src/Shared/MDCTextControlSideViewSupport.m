@@ -16,26 +16,11 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MDCTextControlGeometry.h"
+
 BOOL MDCTextControlShouldDisplaySideViewWithSideView(UIView *sideView, UITextFieldViewMode viewMode,
                                                      BOOL isEditing) {
-  BOOL displaysSideView = NO;
-  if (sideView && !CGSizeEqualToSize(CGSizeZero, sideView.frame.size)) {
-    switch (viewMode) {
-      case UITextFieldViewModeWhileEditing:
-        displaysSideView = isEditing;
-        break;
-      case UITextFieldViewModeUnlessEditing:
-        displaysSideView = !isEditing;
-        break;
-      case UITextFieldViewModeAlways:
-        displaysSideView = YES;
-        break;
-      case UITextFieldViewModeNever:
-        displaysSideView = NO;
-        break;
-      default:
-        break;
-    }
-  }
-  return displaysSideView;
+  BOOL isPresent = sideView && !CGSizeEqualToSize(CGSizeZero, sideView.frame.size);
+  return MDCTextControlGeometryShouldDisplaySideView(
+      isPresent, (MDCTextControlGeometryViewMode)viewMode, isEditing);
 }
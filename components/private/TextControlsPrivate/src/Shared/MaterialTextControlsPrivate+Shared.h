@@ -16,6 +16,8 @@
 #import "MDCTextControlAssistiveLabelView.h"  // IWYU pragma: keep
 #import "MDCTextControlAssistiveLabelViewLayout.h"  // IWYU pragma: keep
 #import "MDCTextControlColorViewModel.h"  // IWYU pragma: keep
+#import "MDCTextControlGeometry.h"  // IWYU pragma: keep
+#import "MDCTextControlGeometryAdapter.h"  // IWYU pragma: keep
 #import "MDCTextControlGradientManager.h"  // IWYU pragma: keep
 #import "MDCTextControlHorizontalPositioning.h"  // IWYU pragma: keep
 #import "MDCTextControlHorizontalPositioningReference.h"  // IWYU pragma: keep
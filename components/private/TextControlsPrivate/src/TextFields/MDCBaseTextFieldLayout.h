@@ -73,3 +73,26 @@
 - (CGRect)labelFrameWithLabelPosition:(MDCTextControlLabelPosition)labelPosition;
 
 @end
+
+/**
+ The number of @c MDCBaseTextFieldLayout objects calculated since launch or the last call to @c
+ MDCBaseTextFieldLayoutResetCalculationCounts.
+ */
+FOUNDATION_EXTERN NSUInteger MDCBaseTextFieldLayoutCalculationCount(void);
+
+/**
+ The number of @c MDCBaseTextFieldLayout objects calculated during the current turn of the main run
+ loop. The count starts over each time the main run loop is about to sleep.
+ */
+FOUNDATION_EXTERN NSUInteger MDCBaseTextFieldLayoutCalculationCountInCurrentRunLoopTurn(void);
+
+/**
+ The number of @c MDCBaseTextFieldLayout objects calculated during the most recent completed turn of
+ the main run loop.
+ */
+FOUNDATION_EXTERN NSUInteger MDCBaseTextFieldLayoutCalculationCountInLastRunLoopTurn(void);
+
+/**
+ Resets all of the text field layout calculation counters to zero.
+ */
+FOUNDATION_EXTERN void MDCBaseTextFieldLayoutResetCalculationCounts(void);
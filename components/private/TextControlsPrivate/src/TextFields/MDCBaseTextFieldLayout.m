@@ -17,7 +17,51 @@
 #import "MaterialTextControlsPrivate+Shared.h"
 #import "MDCTextControlTextFieldSideViewAlignment.h"
 
+static NSUInteger gLayoutCalculationCount = 0;
+static NSUInteger gLayoutCalculationCountInCurrentRunLoopTurn = 0;
+static NSUInteger gLayoutCalculationCountInLastRunLoopTurn = 0;
+
+NSUInteger MDCBaseTextFieldLayoutCalculationCount(void) {
+  return gLayoutCalculationCount;
+}
+
+NSUInteger MDCBaseTextFieldLayoutCalculationCountInCurrentRunLoopTurn(void) {
+  return gLayoutCalculationCountInCurrentRunLoopTurn;
+}
+
+NSUInteger MDCBaseTextFieldLayoutCalculationCountInLastRunLoopTurn(void) {
+  return gLayoutCalculationCountInLastRunLoopTurn;
+}
+
+void MDCBaseTextFieldLayoutResetCalculationCounts(void) {
+  gLayoutCalculationCount = 0;
+  gLayoutCalculationCountInCurrentRunLoopTurn = 0;
+  gLayoutCalculationCountInLastRunLoopTurn = 0;
+}
+
+/**
+ Records one layout calculation. The first call installs an observer that closes the per-turn count
+ when the main run loop is about to sleep. The observer is ordered after Core Animation's commit
+ observer so that layouts triggered by the commit count towards the turn that caused them.
+ */
+static void RecordLayoutCalculation(void) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    CFRunLoopObserverRef observer = CFRunLoopObserverCreateWithHandler(
+        kCFAllocatorDefault, kCFRunLoopBeforeWaiting | kCFRunLoopExit, true, INT_MAX,
+        ^(CFRunLoopObserverRef runLoopObserver, CFRunLoopActivity activity) {
+          gLayoutCalculationCountInLastRunLoopTurn = gLayoutCalculationCountInCurrentRunLoopTurn;
+          gLayoutCalculationCountInCurrentRunLoopTurn = 0;
+        });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), observer, kCFRunLoopCommonModes);
+    CFRelease(observer);
+  });
+  gLayoutCalculationCount++;
+  gLayoutCalculationCountInCurrentRunLoopTurn++;
+}
+
 @interface MDCBaseTextFieldLayout ()
+@property(nonatomic, assign) CGFloat calculatedHeight;
 @end
 
 @implementation MDCBaseTextFieldLayout
@@ -51,6 +95,7 @@
                             isEditing:(BOOL)isEditing {
   self = [super init];
   if (self) {
+    RecordLayoutCalculation();
     [self calculateLayoutWithTextFieldSize:textFieldSize
                       positioningReference:positioningReference
             horizontalPositioningReference:horizontalPositioningReference
@@ -105,271 +150,63 @@
         customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
                                    isRTL:(BOOL)isRTL
                                isEditing:(BOOL)isEditing {
-  UIView *leftView = isRTL ? trailingView : leadingView;
-  UIView *rightView = isRTL ? leadingView : trailingView;
-  UITextFieldViewMode leftViewMode = isRTL ? trailingViewMode : leadingViewMode;
-  UITextFieldViewMode rightViewMode = isRTL ? leadingViewMode : trailingViewMode;
-
-  BOOL displaysLeftView =
-      MDCTextControlShouldDisplaySideViewWithSideView(leftView, leftViewMode, isEditing);
-  BOOL displaysRightView =
-      MDCTextControlShouldDisplaySideViewWithSideView(rightView, rightViewMode, isEditing);
-  BOOL displaysClearButton = [self shouldDisplayClearButtonWithViewMode:clearButtonMode
-                                                              isEditing:isEditing
-                                                                   text:text];
-
-  CGFloat leadingEdgePadding = horizontalPositioningReference.leadingEdgePadding;
-  CGFloat trailingEdgePadding = horizontalPositioningReference.trailingEdgePadding;
-  CGFloat leftEdgePadding = isRTL ? trailingEdgePadding : leadingEdgePadding;
-  CGFloat rightEdgePadding = isRTL ? leadingEdgePadding : trailingEdgePadding;
-  CGFloat horizontalInterItemPadding = horizontalPositioningReference.horizontalInterItemSpacing;
-
-  CGFloat leftViewWidth = CGRectGetWidth(leftView.frame);
-  CGFloat leftViewMinX = 0;
-  CGFloat leftViewMaxX = 0;
-  if (displaysLeftView) {
-    leftViewMinX = leftEdgePadding;
-    leftViewMaxX = leftViewMinX + leftViewWidth;
-  }
-
-  CGFloat textFieldWidth = textFieldSize.width;
-  CGFloat rightViewMinX = 0;
-  if (displaysRightView) {
-    CGFloat rightViewMaxX = textFieldWidth - rightEdgePadding;
-    rightViewMinX = rightViewMaxX - CGRectGetWidth(rightView.frame);
-  }
-
-  CGFloat clearButtonMinX = 0;
-  if (isRTL) {
-    clearButtonMinX =
-        displaysLeftView ? leftViewMaxX + horizontalInterItemPadding : leftEdgePadding;
-  } else {
-    CGFloat clearButtonMaxX = displaysRightView ? rightViewMinX - horizontalInterItemPadding
-                                                : textFieldWidth - rightEdgePadding;
-    clearButtonMinX = clearButtonMaxX - clearButtonSideLength;
-  }
-
-  CGFloat textRectMinX = 0;
-  CGFloat textRectMaxX = 0;
-  CGFloat labelMinX = 0;
-  CGFloat floatingLabelMinX = 0;
-
-  if (isRTL) {
-    if (displaysClearButton) {
-      CGFloat clearButtonMaxX = clearButtonMinX + clearButtonSideLength;
-      textRectMinX = clearButtonMaxX + horizontalInterItemPadding;
-      labelMinX = textRectMinX;
-      floatingLabelMinX = clearButtonMinX;
-    } else {
-      textRectMinX = displaysLeftView ? leftViewMaxX + horizontalInterItemPadding : leftEdgePadding;
-      labelMinX = textRectMinX;
-      floatingLabelMinX = textRectMinX;
-    }
-    if (displaysRightView) {
-      textRectMaxX = rightViewMinX - horizontalInterItemPadding;
-    } else {
-      textRectMaxX = textFieldWidth - rightEdgePadding;
-    }
-  } else {
-    textRectMinX = displaysLeftView ? leftViewMaxX + horizontalInterItemPadding : leftEdgePadding;
-    labelMinX = textRectMinX;
-    floatingLabelMinX = labelMinX;
-    if (displaysClearButton) {
-      textRectMaxX = clearButtonMinX - horizontalInterItemPadding;
-    } else {
-      textRectMaxX = displaysRightView ? rightViewMinX - horizontalInterItemPadding
-                                       : textFieldWidth - rightEdgePadding;
-    }
-  }
-
-  BOOL shouldLayoutForFloatingLabel = MDCTextControlShouldLayoutForFloatingLabelWithLabelPosition(
-      labelPosition, labelBehavior, label.text);
-  CGFloat textRectMinYNormal = 0;
-  if (shouldLayoutForFloatingLabel) {
-    textRectMinYNormal = positioningReference.paddingBetweenContainerTopAndNormalLabel;
-  } else {
-    textRectMinYNormal = positioningReference.paddingAroundTextWhenNoFloatingLabel;
-  }
-
-  CGFloat textRectWidth = textRectMaxX - textRectMinX;
-  CGFloat textRectHeight = [self textHeightWithFont:font];
-  CGRect textRectNormal =
-      CGRectMake(textRectMinX, textRectMinYNormal, textRectWidth, textRectHeight);
-
-  CGFloat floatingLabelMinY = positioningReference.paddingBetweenContainerTopAndFloatingLabel;
-  CGFloat floatingLabelHeight = floatingFont.lineHeight;
-  CGFloat floatingLabelMaxY = floatingLabelMinY + floatingLabelHeight;
-  CGFloat textRectMinYWithFloatingLabel =
-      floatingLabelMaxY + positioningReference.paddingBetweenFloatingLabelAndEditingText;
-  CGFloat textRectCenterYWithFloatingLabel =
-      textRectMinYWithFloatingLabel + ((CGFloat)0.5 * textRectHeight);
-  CGFloat textRectMinYFloatingLabel =
-      (CGFloat)floor((double)(textRectCenterYWithFloatingLabel - (textRectHeight * (CGFloat)0.5)));
-  CGRect textRectFloating =
-      CGRectMake(textRectMinX, textRectMinYFloatingLabel, textRectWidth, textRectHeight);
-
-  CGFloat containerHeight = shouldLayoutForFloatingLabel
-                                ? positioningReference.containerHeightWithFloatingLabel
-                                : positioningReference.containerHeightWithoutFloatingLabel;
-  CGFloat containerMidY = (CGFloat)0.5 * containerHeight;
-  BOOL isFloatingLabel = labelPosition == MDCTextControlLabelPositionFloating;
-  CGFloat textRectMidY =
-      isFloatingLabel ? CGRectGetMidY(textRectFloating) : CGRectGetMidY(textRectNormal);
-  CGFloat sideViewMidY = [self sideViewMidYWithSideViewAlignment:sideViewAlignment
-                                                   containerMidY:containerMidY
-                                                    textRectMidY:textRectMidY];
-
-  CGFloat leftViewHeight = CGRectGetHeight(leftView.frame);
-  CGFloat rightViewHeight = CGRectGetHeight(rightView.frame);
-  CGFloat leftViewMinY = [self minYForSubviewWithHeight:leftViewHeight centerY:sideViewMidY];
-  CGFloat rightViewMinY = [self minYForSubviewWithHeight:rightViewHeight centerY:sideViewMidY];
-  CGRect leftViewFrame = CGRectMake(leftViewMinX, leftViewMinY, leftViewWidth, leftViewHeight);
-  CGRect rightViewFrame =
-      CGRectMake(rightViewMinX, rightViewMinY, CGRectGetWidth(rightView.frame), rightViewHeight);
-  CGFloat clearButtonMinY = [self minYForSubviewWithHeight:clearButtonSideLength
-                                                   centerY:sideViewMidY];
-  CGRect clearButtonFrame =
-      CGRectMake(clearButtonMinX, clearButtonMinY, clearButtonSideLength, clearButtonSideLength);
-
-  CGSize labelSizeNormal = MDCTextControlLabelSizeWith(label.text, textRectWidth, font);
-  CGSize labelSizeFloating = MDCTextControlLabelSizeWith(label.text, textRectWidth, floatingFont);
-  BOOL normalLabelWillTruncate = labelSizeNormal.height > font.lineHeight;
-  BOOL floatingLabelWillTruncate = labelSizeFloating.height > floatingFont.lineHeight;
-  if (normalLabelWillTruncate) {
-    labelSizeNormal.height = font.lineHeight;
-    labelSizeNormal.width = textRectWidth;
-  }
-  if (floatingLabelWillTruncate) {
-    labelSizeFloating.height = floatingFont.lineHeight;
-    labelSizeFloating.width = textRectWidth;
-  }
-  self.labelTruncationIsPresent = normalLabelWillTruncate || floatingLabelWillTruncate;
-
-  CGRect labelFrameNormal = [self labelFrameWithLabelSize:labelSizeNormal
-                                            labelPosition:MDCTextControlLabelPositionNormal
-                                        floatingLabelMinY:floatingLabelMinY
-                                                 textRect:textRectNormal
-                                                    isRTL:isRTL];
-
-  CGRect labelFrameFloating = [self labelFrameWithLabelSize:labelSizeFloating
-                                              labelPosition:MDCTextControlLabelPositionFloating
-                                          floatingLabelMinY:floatingLabelMinY
-                                                   textRect:textRectNormal
-                                                      isRTL:isRTL];
-
-  self.assistiveLabelViewLayout = [[MDCTextControlAssistiveLabelViewLayout alloc]
-                         initWithWidth:textFieldWidth
-                 leadingAssistiveLabel:leadingAssistiveLabel
-                trailingAssistiveLabel:trailingAssistiveLabel
-            assistiveLabelDrawPriority:assistiveLabelDrawPriority
-      customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
-                    leadingEdgePadding:leadingEdgePadding
-                   trailingEdgePadding:trailingEdgePadding
-           paddingAboveAssistiveLabels:positioningReference.paddingAboveAssistiveLabels
-           paddingBelowAssistiveLabels:positioningReference.paddingBelowAssistiveLabels
-                                 isRTL:isRTL];
-  self.assistiveLabelViewFrame = CGRectMake(0, containerHeight, textFieldWidth,
-                                            self.assistiveLabelViewLayout.calculatedHeight);
-  self.leadingViewFrame = isRTL ? rightViewFrame : leftViewFrame;
-  self.trailingViewFrame = isRTL ? leftViewFrame : rightViewFrame;
-  self.displaysLeadingView = isRTL ? displaysRightView : displaysLeftView;
-  self.displaysTrailingView = isRTL ? displaysLeftView : displaysRightView;
-  self.clearButtonFrame = clearButtonFrame;
-  self.textRectFloating = textRectFloating;
-  self.textRectNormal = textRectNormal;
-  self.labelFrameFloating = labelFrameFloating;
-  self.labelFrameNormal = labelFrameNormal;
-  self.containerHeight = containerHeight;
-}
-
-- (CGFloat)sideViewMidYWithSideViewAlignment:
-               (MDCTextControlTextFieldSideViewAlignment)sideViewAlignment
-                               containerMidY:(CGFloat)containerMidY
-                                textRectMidY:(CGFloat)textRectMidY {
-  CGFloat sideViewMidY = containerMidY;
-  switch (sideViewAlignment) {
-    case MDCTextControlTextFieldSideViewAlignmentCenteredInContainer:
-      break;
-    case MDCTextControlTextFieldSideViewAlignmentAlignedWithText:
-      sideViewMidY = textRectMidY;
-      break;
-    default:
-      break;
-  }
-  return sideViewMidY;
-}
-
-- (CGFloat)minYForSubviewWithHeight:(CGFloat)height centerY:(CGFloat)centerY {
-  return (CGFloat)round((double)(centerY - ((CGFloat)0.5 * height)));
-}
-
-- (BOOL)shouldDisplayClearButtonWithViewMode:(UITextFieldViewMode)viewMode
-                                   isEditing:(BOOL)isEditing
-                                        text:(NSString *)text {
-  BOOL hasText = text.length > 0;
-  switch (viewMode) {
-    case UITextFieldViewModeWhileEditing:
-      return isEditing && hasText;
-    case UITextFieldViewModeUnlessEditing:
-      return !isEditing;
-    case UITextFieldViewModeAlways:
-      return YES;
-    case UITextFieldViewModeNever:
-      return NO;
-    default:
-      return NO;
-  }
-}
-
-- (CGRect)labelFrameWithLabelSize:(CGSize)size
-                    labelPosition:(MDCTextControlLabelPosition)labelPosition
-                floatingLabelMinY:(CGFloat)floatingLabelMinY
-                         textRect:(CGRect)textRect
-                            isRTL:(BOOL)isRTL {
-  CGFloat labelMinX = CGRectGetMinX(textRect);
-  CGFloat labelMaxX = CGRectGetMaxX(textRect);
-  CGFloat textRectMidY = CGRectGetMidY(textRect);
-  CGRect rect = CGRectZero;
-  CGFloat originX = 0;
-  CGFloat originY = 0;
-  switch (labelPosition) {
-    case MDCTextControlLabelPositionNone:
-      break;
-    case MDCTextControlLabelPositionFloating:
-      originY = floatingLabelMinY;
-      if (isRTL) {
-        originX = labelMaxX - size.width;
-      } else {
-        originX = labelMinX;
-      }
-      rect = CGRectMake(originX, originY, size.width, size.height);
-      break;
-    case MDCTextControlLabelPositionNormal:
-      originY = textRectMidY - (0.5f * size.height);
-      if (isRTL) {
-        originX = labelMaxX - size.width;
-      } else {
-        originX = labelMinX;
-      }
-      rect = CGRectMake(originX, originY, size.width, size.height);
-      break;
-    default:
-      break;
-  }
-  return rect;
+  NS_VALID_UNTIL_END_OF_SCOPE MDCTextControlGeometryTextMeasurer *textMeasurer =
+      [[MDCTextControlGeometryTextMeasurer alloc] init];
+  textMeasurer.label = label;
+  textMeasurer.normalFont = font;
+  textMeasurer.floatingFont = floatingFont;
+  textMeasurer.leadingAssistiveLabel = leadingAssistiveLabel;
+  textMeasurer.trailingAssistiveLabel = trailingAssistiveLabel;
+
+  MDCTextFieldGeometryInput input = {
+      .width = textFieldSize.width,
+      .verticalMetrics =
+          MDCTextControlVerticalMetricsWithPositioningReference(positioningReference),
+      .horizontalMetrics =
+          MDCTextControlHorizontalMetricsWithPositioningReference(horizontalPositioningReference),
+      .normalFontLineHeight = font.lineHeight,
+      .floatingFontLineHeight = floatingFont.lineHeight,
+      .labelPosition = (MDCTextControlGeometryLabelPosition)labelPosition,
+      .layoutsForFloatingLabel = MDCTextControlShouldLayoutForFloatingLabelWithLabelPosition(
+          labelPosition, labelBehavior, label.text),
+      .alignsSideViewsWithText =
+          sideViewAlignment == MDCTextControlTextFieldSideViewAlignmentAlignedWithText,
+      .leadingView = MDCTextControlGeometrySideViewWithSideView(
+          leadingView, leadingView.frame.size, leadingViewMode),
+      .trailingView = MDCTextControlGeometrySideViewWithSideView(
+          trailingView, trailingView.frame.size, trailingViewMode),
+      .clearButtonSideLength = clearButtonSideLength,
+      .clearButtonMode = (MDCTextControlGeometryViewMode)clearButtonMode,
+      .hasText = text.length > 0,
+      .assistiveLabelStyle = MDCTextControlAssistiveLabelStyleWith(
+          assistiveLabelDrawPriority, customAssistiveLabelDrawPriority, leadingAssistiveLabel,
+          trailingAssistiveLabel),
+      .isRTL = isRTL,
+      .isEditing = isEditing,
+  };
+  MDCTextFieldGeometry geometry;
+  MDCTextFieldGeometryCalculate(&input, textMeasurer.measurer, &geometry);
+
+  self.assistiveLabelViewLayout =
+      [[MDCTextControlAssistiveLabelViewLayout alloc] initWithGeometry:geometry.assistiveLabels];
+  self.assistiveLabelViewFrame =
+      MDCTextControlCGRectFromGeometryRect(geometry.assistiveLabelViewFrame);
+  self.leadingViewFrame = MDCTextControlCGRectFromGeometryRect(geometry.leadingViewFrame);
+  self.trailingViewFrame = MDCTextControlCGRectFromGeometryRect(geometry.trailingViewFrame);
+  self.displaysLeadingView = geometry.displaysLeadingView;
+  self.displaysTrailingView = geometry.displaysTrailingView;
+  self.clearButtonFrame = MDCTextControlCGRectFromGeometryRect(geometry.clearButtonFrame);
+  self.textRectFloating = MDCTextControlCGRectFromGeometryRect(geometry.textRectFloating);
+  self.textRectNormal = MDCTextControlCGRectFromGeometryRect(geometry.textRectNormal);
+  self.labelFrameFloating = MDCTextControlCGRectFromGeometryRect(geometry.labelFrameFloating);
+  self.labelFrameNormal = MDCTextControlCGRectFromGeometryRect(geometry.labelFrameNormal);
+  self.labelTruncationIsPresent = geometry.labelTruncationIsPresent;
+  self.containerHeight = (CGFloat)geometry.containerHeight;
+  self.calculatedHeight = (CGFloat)geometry.calculatedHeight;
 }
 
 - (CGFloat)textHeightWithFont:(UIFont *)font {
-  return (CGFloat)ceil((double)font.lineHeight);
-}
-
-- (CGFloat)calculatedHeight {
-  CGFloat maxY = self.containerHeight;
-  CGFloat assistiveLabelViewMaxY = CGRectGetMaxY(self.assistiveLabelViewFrame);
-  if (assistiveLabelViewMaxY > maxY) {
-    maxY = assistiveLabelViewMaxY;
-  }
-  return ceil(maxY);
+  return (CGFloat)MDCTextControlGeometryTextHeight(font.lineHeight);
 }
 
 - (CGRect)labelFrameWithLabelPosition:(MDCTextControlLabelPosition)labelPosition {
@@ -0,0 +1,229 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Checks MDCTextControlGeometry.c against known layouts, then reports the cost of one text field,
+// text area and assistive label layout. Run with scripts/test_host.
+
+#include <float.h>
+
+#include "../../src/Shared/MDCTextControlGeometry.h"
+#include "MDCHostTest.h"
+
+#define BENCHMARK_LAYOUT_COUNT 1000000UL
+
+/** Label sizes as a 17.5pt body font and 12pt caption font would measure them. */
+static const MDCTextControlGeometrySize kElementSizes[] = {
+    [MDCTextControlGeometryElementNormalLabel] = {50, 17.5},
+    [MDCTextControlGeometryElementFloatingLabel] = {40, 12},
+    [MDCTextControlGeometryElementPlaceholder] = {80, 17.5},
+    [MDCTextControlGeometryElementLeadingAssistiveLabel] = {100, 14},
+    [MDCTextControlGeometryElementTrailingAssistiveLabel] = {60, 14},
+};
+
+static MDCTextControlGeometrySize MeasureElement(MDCTextControlGeometryElement element,
+                                                 MDCTextControlGeometrySize fittingSize,
+                                                 void *context) {
+  unsigned long *measureCount = context;
+  *measureCount += 1;
+  return kElementSizes[element];
+}
+
+/** The vertical metrics of a filled text control at normal density. */
+#define FILLED_VERTICAL_METRICS                       \
+  {                                                   \
+    .paddingBetweenContainerTopAndFloatingLabel = 10, \
+    .paddingBetweenContainerTopAndNormalLabel = 20,   \
+    .paddingBetweenFloatingLabelAndEditingText = 6,   \
+    .paddingBetweenEditingTextAndContainerBottom = 6, \
+    .paddingAboveAssistiveLabels = 0,                 \
+    .paddingBelowAssistiveLabels = 6,                 \
+    .containerHeightWithFloatingLabel = 56,           \
+    .containerHeightWithoutFloatingLabel = 48,        \
+    .paddingAroundTextWhenNoFloatingLabel = 10,       \
+  }
+
+#define ASSISTIVE_LABEL_STYLE \
+  { MDCTextControlGeometryAssistiveLabelDrawPriorityTrailing, 0, 14, 14 }
+
+/** A 300pt wide text field with a leading view, a trailing view and a clear button. */
+static const MDCTextFieldGeometryInput kTextFieldInput = {
+    .width = 300,
+    .verticalMetrics = FILLED_VERTICAL_METRICS,
+    .horizontalMetrics = {12, 12, 12},
+    .normalFontLineHeight = 17.5,
+    .floatingFontLineHeight = 12,
+    .labelPosition = MDCTextControlGeometryLabelPositionNormal,
+    .layoutsForFloatingLabel = true,
+    .leadingView = {true, {20, 20}, MDCTextControlGeometryViewModeAlways},
+    .trailingView = {true, {20, 20}, MDCTextControlGeometryViewModeAlways},
+    .clearButtonSideLength = 19,
+    .clearButtonMode = MDCTextControlGeometryViewModeAlways,
+    .assistiveLabelStyle = ASSISTIVE_LABEL_STYLE,
+};
+
+/** A 200pt wide text area with a floating label and a placeholder. */
+static const MDCTextAreaGeometryInput kTextAreaInput = {
+    .width = 200,
+    .verticalMetrics = FILLED_VERTICAL_METRICS,
+    .horizontalMetrics = {12, 12, 12},
+    .normalFontLineHeight = 17.5,
+    .floatingFontLineHeight = 12,
+    .labelPosition = MDCTextControlGeometryLabelPositionFloating,
+    .layoutsForFloatingLabel = true,
+    .hasPlaceholder = true,
+    .assistiveLabelStyle = ASSISTIVE_LABEL_STYLE,
+};
+
+static void ExpectRect(MDCTextControlGeometryRect rect, double x, double y, double width,
+                       double height) {
+  MDC_HOST_EXPECT_NEAR(rect.x, x, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(rect.y, y, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(rect.width, width, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(rect.height, height, DBL_EPSILON);
+}
+
+static void TestTextFieldLeftToRight(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextFieldGeometry geometry;
+
+  MDCTextFieldGeometryCalculate(&kTextFieldInput, measurer, &geometry);
+
+  MDC_HOST_EXPECT_TRUE(geometry.displaysLeadingView && geometry.displaysTrailingView);
+  ExpectRect(geometry.leadingViewFrame, 12, 18, 20, 20);
+  ExpectRect(geometry.trailingViewFrame, 268, 18, 20, 20);
+  ExpectRect(geometry.clearButtonFrame, 237, 19, 19, 19);
+  ExpectRect(geometry.textRectNormal, 44, 20, 181, 18);
+  ExpectRect(geometry.textRectFloating, 44, 28, 181, 18);
+  ExpectRect(geometry.labelFrameNormal, 44, 20.25, 50, 17.5);
+  ExpectRect(geometry.labelFrameFloating, 44, 10, 40, 12);
+  ExpectRect(geometry.assistiveLabelViewFrame, 0, 56, 300, 20);
+  MDC_HOST_EXPECT_NEAR(geometry.calculatedHeight, 76, DBL_EPSILON);
+  MDC_HOST_EXPECT_TRUE(!geometry.labelTruncationIsPresent);
+  MDC_HOST_EXPECT_TRUE(measureCount == 4);
+}
+
+static void TestTextFieldRightToLeftMirrorsFrames(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextFieldGeometryInput input = kTextFieldInput;
+  input.isRTL = true;
+  MDCTextFieldGeometry geometry;
+
+  MDCTextFieldGeometryCalculate(&input, measurer, &geometry);
+
+  ExpectRect(geometry.leadingViewFrame, 268, 18, 20, 20);
+  ExpectRect(geometry.clearButtonFrame, 44, 19, 19, 19);
+  ExpectRect(geometry.textRectNormal, 75, 20, 181, 18);
+  ExpectRect(geometry.labelFrameNormal, 206, 20.25, 50, 17.5);
+  ExpectRect(geometry.assistiveLabels.leadingLabelFrame, 188, 0, 100, 14);
+}
+
+static void TestTextAreaWithFloatingLabel(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextAreaGeometry geometry;
+
+  MDCTextAreaGeometryCalculate(&kTextAreaInput, measurer, &geometry);
+
+  ExpectRect(geometry.textViewFrame, 12, 28, 176, 22);
+  ExpectRect(geometry.labelFrameFloating, 12, 10, 40, 12);
+  MDC_HOST_EXPECT_TRUE(!geometry.placeholderLabelHidden);
+  MDC_HOST_EXPECT_NEAR(geometry.calculatedHeight, 76, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(geometry.verticalGradientLocations[1], 22.0 / 56, DBL_EPSILON);
+  MDC_HOST_EXPECT_NEAR(geometry.horizontalGradientLocations[3], 0.98, DBL_EPSILON);
+}
+
+static void TestAssistiveLabelsShareWidthByPriority(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextControlAssistiveLabelGeometryInput input = {300, 12, 12, 0, 6, ASSISTIVE_LABEL_STYLE,
+                                                     false};
+  MDCTextControlAssistiveLabelGeometry geometry;
+
+  MDCTextControlAssistiveLabelGeometryCalculate(&input, measurer, &geometry);
+
+  ExpectRect(geometry.leadingLabelFrame, 12, 0, 100, 14);
+  ExpectRect(geometry.trailingLabelFrame, 228, 0, 60, 14);
+  MDC_HOST_EXPECT_NEAR(geometry.calculatedHeight, 20, DBL_EPSILON);
+}
+
+// The benchmarks vary the width on every layout, as a rotation or a resizing container would, so
+// that no two consecutive layouts are identical.
+
+static void BenchmarkTextField(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextFieldGeometryInput input = kTextFieldInput;
+  MDCTextFieldGeometry geometry;
+  double heights = 0;
+
+  double start = MDCHostTestNanoseconds();
+  for (unsigned long i = 0; i < BENCHMARK_LAYOUT_COUNT; i++) {
+    input.width = 200 + (double)(i % 200);
+    MDCTextFieldGeometryCalculate(&input, measurer, &geometry);
+    heights += geometry.calculatedHeight;
+  }
+  MDCHostTestReportCost("MDCTextFieldGeometryCalculate", MDCHostTestNanoseconds() - start,
+                        BENCHMARK_LAYOUT_COUNT);
+  MDC_HOST_EXPECT_TRUE(heights > 0);
+}
+
+static void BenchmarkTextArea(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextAreaGeometryInput input = kTextAreaInput;
+  MDCTextAreaGeometry geometry;
+  double heights = 0;
+
+  double start = MDCHostTestNanoseconds();
+  for (unsigned long i = 0; i < BENCHMARK_LAYOUT_COUNT; i++) {
+    input.width = 200 + (double)(i % 200);
+    MDCTextAreaGeometryCalculate(&input, measurer, &geometry);
+    heights += geometry.calculatedHeight;
+  }
+  MDCHostTestReportCost("MDCTextAreaGeometryCalculate", MDCHostTestNanoseconds() - start,
+                        BENCHMARK_LAYOUT_COUNT);
+  MDC_HOST_EXPECT_TRUE(heights > 0);
+}
+
+static void BenchmarkAssistiveLabels(void) {
+  unsigned long measureCount = 0;
+  MDCTextControlGeometryMeasurer measurer = {MeasureElement, &measureCount};
+  MDCTextControlAssistiveLabelGeometryInput input = {300, 12, 12, 0, 6, ASSISTIVE_LABEL_STYLE,
+                                                     false};
+  MDCTextControlAssistiveLabelGeometry geometry;
+  double heights = 0;
+
+  double start = MDCHostTestNanoseconds();
+  for (unsigned long i = 0; i < BENCHMARK_LAYOUT_COUNT; i++) {
+    input.width = 200 + (double)(i % 200);
+    MDCTextControlAssistiveLabelGeometryCalculate(&input, measurer, &geometry);
+    heights += geometry.calculatedHeight;
+  }
+  MDCHostTestReportCost("MDCTextControlAssistiveLabelGeometryCalculate",
+                        MDCHostTestNanoseconds() - start, BENCHMARK_LAYOUT_COUNT);
+  MDC_HOST_EXPECT_TRUE(heights > 0);
+}
+
+int main(void) {
+  TestTextFieldLeftToRight();
+  TestTextFieldRightToLeftMirrorsFrames();
+  TestTextAreaWithFloatingLabel();
+  TestAssistiveLabelsShareWidthByPriority();
+  BenchmarkTextField();
+  BenchmarkTextArea();
+  BenchmarkAssistiveLabels();
+  return MDCHostTestExitStatus();
+}
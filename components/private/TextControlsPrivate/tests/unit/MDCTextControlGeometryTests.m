@@ -0,0 +1,316 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCTextControlGeometry.h"
+
+static const NSUInteger kBenchmarkLayoutCount = 100000;
+
+/** Measures every element at a fixed size, independent of the fitting size. */
+typedef struct FakeMeasurements {
+  MDCTextControlGeometrySize sizes[5];
+  NSUInteger measureCount;
+} FakeMeasurements;
+
+static MDCTextControlGeometrySize MeasureFakeElement(MDCTextControlGeometryElement element,
+                                                     MDCTextControlGeometrySize fittingSize,
+                                                     void *context) {
+  FakeMeasurements *measurements = context;
+  measurements->measureCount++;
+  return measurements->sizes[element];
+}
+
+static MDCTextControlVerticalMetrics FakeVerticalMetrics(void) {
+  MDCTextControlVerticalMetrics metrics = {
+      .paddingBetweenContainerTopAndFloatingLabel = 10,
+      .paddingBetweenContainerTopAndNormalLabel = 20,
+      .paddingBetweenFloatingLabelAndEditingText = 6,
+      .paddingBetweenEditingTextAndContainerBottom = 6,
+      .paddingAboveAssistiveLabels = 0,
+      .paddingBelowAssistiveLabels = 6,
+      .containerHeightWithFloatingLabel = 56,
+      .containerHeightWithoutFloatingLabel = 48,
+      .paddingAroundTextWhenNoFloatingLabel = 10,
+  };
+  return metrics;
+}
+
+static MDCTextControlHorizontalMetrics FakeHorizontalMetrics(void) {
+  MDCTextControlHorizontalMetrics metrics = {
+      .leadingEdgePadding = 12,
+      .trailingEdgePadding = 12,
+      .horizontalInterItemSpacing = 12,
+  };
+  return metrics;
+}
+
+static MDCTextControlAssistiveLabelStyle FakeAssistiveLabelStyle(void) {
+  MDCTextControlAssistiveLabelStyle style = {
+      .drawPriority = MDCTextControlGeometryAssistiveLabelDrawPriorityTrailing,
+      .customDrawPriority = 0,
+      .leadingLabelLineHeight = 14,
+      .trailingLabelLineHeight = 14,
+  };
+  return style;
+}
+
+static MDCTextFieldGeometryInput FakeTextFieldInput(void) {
+  MDCTextControlGeometrySideView sideView = {
+      .isPresent = true,
+      .size = {20, 20},
+      .viewMode = MDCTextControlGeometryViewModeAlways,
+  };
+  MDCTextFieldGeometryInput input = {
+      .width = 300,
+      .verticalMetrics = FakeVerticalMetrics(),
+      .horizontalMetrics = FakeHorizontalMetrics(),
+      .normalFontLineHeight = 17.5,
+      .floatingFontLineHeight = 12,
+      .labelPosition = MDCTextControlGeometryLabelPositionNormal,
+      .layoutsForFloatingLabel = true,
+      .alignsSideViewsWithText = false,
+      .leadingView = sideView,
+      .trailingView = sideView,
+      .clearButtonSideLength = 19,
+      .clearButtonMode = MDCTextControlGeometryViewModeAlways,
+      .hasText = false,
+      .assistiveLabelStyle = FakeAssistiveLabelStyle(),
+      .isRTL = false,
+      .isEditing = false,
+  };
+  return input;
+}
+
+static BOOL RectEqualsRect(MDCTextControlGeometryRect rect, double x, double y, double width,
+                           double height) {
+  return rect.x == x && rect.y == y && rect.width == width && rect.height == height;
+}
+
+@interface MDCTextControlGeometryTests : XCTestCase
+@property(nonatomic, assign) FakeMeasurements measurements;
+@end
+
+@implementation MDCTextControlGeometryTests
+
+- (void)setUp {
+  [super setUp];
+
+  FakeMeasurements measurements = {
+      .sizes =
+          {
+              [MDCTextControlGeometryElementNormalLabel] = {50, 17.5},
+              [MDCTextControlGeometryElementFloatingLabel] = {40, 12},
+              [MDCTextControlGeometryElementPlaceholder] = {80, 17.5},
+              [MDCTextControlGeometryElementLeadingAssistiveLabel] = {100, 14},
+              [MDCTextControlGeometryElementTrailingAssistiveLabel] = {60, 14},
+          },
+      .measureCount = 0,
+  };
+  self.measurements = measurements;
+}
+
+- (MDCTextControlGeometryMeasurer)measurerWithMeasurements:(FakeMeasurements *)measurements {
+  MDCTextControlGeometryMeasurer measurer = {
+      .measure = MeasureFakeElement,
+      .context = measurements,
+  };
+  return measurer;
+}
+
+#pragma mark - Text fields
+
+- (void)testTextFieldGeometryLeftToRight {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextFieldGeometryInput input = FakeTextFieldInput();
+
+  // When
+  MDCTextFieldGeometry geometry;
+  MDCTextFieldGeometryCalculate(&input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(geometry.displaysLeadingView);
+  XCTAssertTrue(geometry.displaysTrailingView);
+  XCTAssertTrue(RectEqualsRect(geometry.leadingViewFrame, 12, 18, 20, 20));
+  XCTAssertTrue(RectEqualsRect(geometry.trailingViewFrame, 268, 18, 20, 20));
+  XCTAssertTrue(RectEqualsRect(geometry.clearButtonFrame, 237, 19, 19, 19));
+  XCTAssertTrue(RectEqualsRect(geometry.textRectNormal, 44, 20, 181, 18));
+  XCTAssertTrue(RectEqualsRect(geometry.textRectFloating, 44, 28, 181, 18));
+  XCTAssertTrue(RectEqualsRect(geometry.labelFrameNormal, 44, 20.25, 50, 17.5));
+  XCTAssertTrue(RectEqualsRect(geometry.labelFrameFloating, 44, 10, 40, 12));
+  XCTAssertTrue(RectEqualsRect(geometry.assistiveLabelViewFrame, 0, 56, 300, 20));
+  XCTAssertEqual(geometry.containerHeight, 56);
+  XCTAssertEqual(geometry.calculatedHeight, 76);
+  XCTAssertFalse(geometry.labelTruncationIsPresent);
+  XCTAssertEqual(measurements.measureCount, 4U);
+}
+
+- (void)testTextFieldGeometryRightToLeft {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextFieldGeometryInput input = FakeTextFieldInput();
+  input.isRTL = true;
+
+  // When
+  MDCTextFieldGeometry geometry;
+  MDCTextFieldGeometryCalculate(&input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(RectEqualsRect(geometry.leadingViewFrame, 268, 18, 20, 20));
+  XCTAssertTrue(RectEqualsRect(geometry.clearButtonFrame, 44, 19, 19, 19));
+  XCTAssertTrue(RectEqualsRect(geometry.textRectNormal, 75, 20, 181, 18));
+  XCTAssertTrue(RectEqualsRect(geometry.labelFrameNormal, 206, 20.25, 50, 17.5));
+  XCTAssertTrue(RectEqualsRect(geometry.assistiveLabels.leadingLabelFrame, 188, 0, 100, 14));
+}
+
+- (void)testTextFieldGeometryHidesSideViewsAccordingToViewMode {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextFieldGeometryInput input = FakeTextFieldInput();
+  input.leadingView.viewMode = MDCTextControlGeometryViewModeWhileEditing;
+  input.trailingView.isPresent = false;
+
+  // When
+  MDCTextFieldGeometry geometry;
+  MDCTextFieldGeometryCalculate(&input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertFalse(geometry.displaysLeadingView);
+  XCTAssertFalse(geometry.displaysTrailingView);
+  XCTAssertEqual(geometry.textRectNormal.x, 12);
+}
+
+- (void)testTextFieldGeometryTruncatesTallLabel {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  measurements.sizes[MDCTextControlGeometryElementNormalLabel].height = 35;
+  MDCTextFieldGeometryInput input = FakeTextFieldInput();
+
+  // When
+  MDCTextFieldGeometry geometry;
+  MDCTextFieldGeometryCalculate(&input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(geometry.labelTruncationIsPresent);
+  XCTAssertEqual(geometry.labelFrameNormal.width, geometry.textRectNormal.width);
+  XCTAssertEqual(geometry.labelFrameNormal.height, 17.5);
+}
+
+#pragma mark - Assistive labels
+
+- (void)testAssistiveLabelsShareWidthByPriority {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextControlAssistiveLabelGeometryInput input = {
+      .width = 300,
+      .leadingEdgePadding = 12,
+      .trailingEdgePadding = 12,
+      .paddingAboveAssistiveLabels = 0,
+      .paddingBelowAssistiveLabels = 6,
+      .style = FakeAssistiveLabelStyle(),
+      .isRTL = false,
+  };
+
+  // When
+  MDCTextControlAssistiveLabelGeometry geometry;
+  MDCTextControlAssistiveLabelGeometryCalculate(
+      &input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(RectEqualsRect(geometry.leadingLabelFrame, 12, 0, 100, 14));
+  XCTAssertTrue(RectEqualsRect(geometry.trailingLabelFrame, 228, 0, 60, 14));
+  XCTAssertEqual(geometry.calculatedHeight, 20);
+}
+
+- (void)testMultilineTrailingAssistiveLabelHidesLeadingLabel {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  measurements.sizes[MDCTextControlGeometryElementTrailingAssistiveLabel].height = 28;
+  MDCTextControlAssistiveLabelGeometryInput input = {
+      .width = 300,
+      .paddingBelowAssistiveLabels = 6,
+      .style = FakeAssistiveLabelStyle(),
+  };
+
+  // When
+  MDCTextControlAssistiveLabelGeometry geometry;
+  MDCTextControlAssistiveLabelGeometryCalculate(
+      &input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(RectEqualsRect(geometry.leadingLabelFrame, 0, 0, 0, 0));
+  XCTAssertEqual(geometry.calculatedHeight, 34);
+}
+
+#pragma mark - Text areas
+
+- (void)testTextAreaGeometryWithFloatingLabel {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextAreaGeometryInput input = {
+      .width = 200,
+      .verticalMetrics = FakeVerticalMetrics(),
+      .horizontalMetrics = FakeHorizontalMetrics(),
+      .normalFontLineHeight = 17.5,
+      .floatingFontLineHeight = 12,
+      .labelPosition = MDCTextControlGeometryLabelPositionFloating,
+      .layoutsForFloatingLabel = true,
+      .hasPlaceholder = true,
+      .assistiveLabelStyle = FakeAssistiveLabelStyle(),
+  };
+
+  // When
+  MDCTextAreaGeometry geometry;
+  MDCTextAreaGeometryCalculate(&input, [self measurerWithMeasurements:&measurements], &geometry);
+
+  // Then
+  XCTAssertTrue(RectEqualsRect(geometry.textViewFrame, 12, 28, 176, 22));
+  XCTAssertTrue(RectEqualsRect(geometry.labelFrameFloating, 12, 10, 40, 12));
+  XCTAssertTrue(RectEqualsRect(geometry.placeholderLabelFrame, 0, 0, 80, 17.5));
+  XCTAssertFalse(geometry.placeholderLabelHidden);
+  XCTAssertEqual(geometry.calculatedHeight, 76);
+  double horizontalLocations[] = {0, 0, 0.02, 0.98, 1, 1};
+  double verticalLocations[] = {0, 22.0 / 56, 26.0 / 56, 50.0 / 56, 54.0 / 56, 1};
+  for (NSUInteger i = 0; i < MDCTextAreaGeometryGradientLocationCount; i++) {
+    XCTAssertEqualWithAccuracy(geometry.horizontalGradientLocations[i], horizontalLocations[i],
+                               DBL_EPSILON);
+    XCTAssertEqualWithAccuracy(geometry.verticalGradientLocations[i], verticalLocations[i],
+                               DBL_EPSILON);
+  }
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceTextFieldGeometry {
+  // Given
+  FakeMeasurements measurements = self.measurements;
+  MDCTextControlGeometryMeasurer measurer = [self measurerWithMeasurements:&measurements];
+  MDCTextFieldGeometryInput input = FakeTextFieldInput();
+  __block double checksum = 0;
+
+  // Then
+  [self measureBlock:^{
+    MDCTextFieldGeometryInput varyingInput = input;
+    MDCTextFieldGeometry geometry;
+    for (NSUInteger i = 0; i < kBenchmarkLayoutCount; i++) {
+      varyingInput.width = 200 + (double)(i % 200);
+      MDCTextFieldGeometryCalculate(&varyingInput, measurer, &geometry);
+      checksum += geometry.calculatedHeight;
+    }
+  }];
+  XCTAssertGreaterThan(checksum, 0);
+}
+
+@end
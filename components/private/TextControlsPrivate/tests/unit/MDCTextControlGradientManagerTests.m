@@ -0,0 +1,168 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCTextControlGradientManager.h"
+
+static const NSUInteger kBenchmarkLayoutCount = 1000;
+
+@interface MDCTextControlGradientManagerTests : XCTestCase
+@end
+
+@implementation MDCTextControlGradientManagerTests
+
+- (void)setUp {
+  [super setUp];
+
+  MDCTextControlGradientMaskImageRemoveAllImages();
+  MDCTextControlGradientMaskImageResetDrawCount();
+}
+
+- (void)tearDown {
+  MDCTextControlGradientMaskImageRemoveAllImages();
+  MDCTextControlGradientMaskImageResetDrawCount();
+
+  [super tearDown];
+}
+
+- (void)layoutGradientManager:(MDCTextControlGradientManager *)gradientManager
+                     withSize:(CGSize)size
+          horizontalLocations:(NSArray<NSNumber *> *)horizontalLocations {
+  CGRect frame = CGRectMake(0, 0, size.width, size.height);
+  gradientManager.horizontalGradient.frame = frame;
+  gradientManager.verticalGradient.frame = frame;
+  gradientManager.horizontalGradient.locations = horizontalLocations;
+  gradientManager.verticalGradient.locations = @[ @0, @0, @0.2, @0.8, @1, @1 ];
+}
+
+- (uint8_t)alphaOfMaskLayer:(CALayer *)layer atPixel:(CGPoint)pixel {
+  CGImageRef image = (__bridge CGImageRef)layer.contents;
+  NSData *data = CFBridgingRelease(CGDataProviderCopyData(CGImageGetDataProvider(image)));
+  size_t offset = (size_t)pixel.y * CGImageGetBytesPerRow(image) + (size_t)pixel.x;
+  return ((const uint8_t *)data.bytes)[offset];
+}
+
+- (void)testMaskImageCombinesBothGradients {
+  // Given
+  MDCTextControlGradientManager *gradientManager = [[MDCTextControlGradientManager alloc] init];
+  [self layoutGradientManager:gradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:@[ @0, @0, @0.1, @0.9, @1, @1 ]];
+
+  // When
+  CALayer *maskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(maskLayer.frame, CGRectMake(0, 0, 100, 50)));
+  XCTAssertEqual([self alphaOfMaskLayer:maskLayer atPixel:CGPointMake(0, 0)], 0);
+  XCTAssertEqual([self alphaOfMaskLayer:maskLayer atPixel:CGPointMake(50, 25)], 255);
+  XCTAssertEqual([self alphaOfMaskLayer:maskLayer atPixel:CGPointMake(5, 25)], 140);
+  XCTAssertEqual([self alphaOfMaskLayer:maskLayer atPixel:CGPointMake(99, 49)], 0);
+}
+
+- (void)testMaskLayerIsReusedWhileGradientsAreUnchanged {
+  // Given
+  MDCTextControlGradientManager *gradientManager = [[MDCTextControlGradientManager alloc] init];
+  NSArray<NSNumber *> *locations = @[ @0, @0, @0.1, @0.9, @1, @1 ];
+  [self layoutGradientManager:gradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:locations];
+  CALayer *firstMaskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // When
+  [self layoutGradientManager:gradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:[locations copy]];
+  CALayer *secondMaskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // Then
+  XCTAssertEqual(firstMaskLayer, secondMaskLayer);
+  XCTAssertEqual(MDCTextControlGradientMaskImageDrawCount(), 1U);
+}
+
+- (void)testMaskImageIsRedrawnWhenStopsMove {
+  // Given
+  MDCTextControlGradientManager *gradientManager = [[MDCTextControlGradientManager alloc] init];
+  [self layoutGradientManager:gradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:@[ @0, @0, @0.1, @0.9, @1, @1 ]];
+  CALayer *firstMaskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // When
+  [self layoutGradientManager:gradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:@[ @0, @0, @0.2, @0.8, @1, @1 ]];
+  CALayer *secondMaskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // Then
+  XCTAssertNotEqual(firstMaskLayer, secondMaskLayer);
+  XCTAssertNotEqual(firstMaskLayer.contents, secondMaskLayer.contents);
+  XCTAssertEqual(MDCTextControlGradientMaskImageDrawCount(), 2U);
+}
+
+- (void)testMaskImagesAreSharedAcrossManagers {
+  // Given
+  MDCTextControlGradientManager *firstGradientManager =
+      [[MDCTextControlGradientManager alloc] init];
+  MDCTextControlGradientManager *secondGradientManager =
+      [[MDCTextControlGradientManager alloc] init];
+  NSArray<NSNumber *> *locations = @[ @0, @0, @0.1, @0.9, @1, @1 ];
+  [self layoutGradientManager:firstGradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:locations];
+  [self layoutGradientManager:secondGradientManager
+                     withSize:CGSizeMake(100, 50)
+          horizontalLocations:locations];
+
+  // When
+  CALayer *firstMaskLayer = [firstGradientManager combinedGradientMaskLayer];
+  CALayer *secondMaskLayer = [secondGradientManager combinedGradientMaskLayer];
+
+  // Then
+  XCTAssertEqual(firstMaskLayer.contents, secondMaskLayer.contents);
+  XCTAssertEqual(MDCTextControlGradientMaskImageDrawCount(), 1U);
+}
+
+- (void)testZeroSizeMaskHasNoContents {
+  // Given
+  MDCTextControlGradientManager *gradientManager = [[MDCTextControlGradientManager alloc] init];
+
+  // When
+  CALayer *maskLayer = [gradientManager combinedGradientMaskLayer];
+
+  // Then
+  XCTAssertNil(maskLayer.contents);
+  XCTAssertTrue(CGRectEqualToRect(maskLayer.frame, CGRectZero));
+  XCTAssertEqual(MDCTextControlGradientMaskImageDrawCount(), 0U);
+}
+
+#pragma mark - Performance
+
+/** Simulates a text area whose height grows by one point per layout while the user types. */
+- (void)testPerformanceGrowingTextAreaMasks {
+  [self measureBlock:^{
+    MDCTextControlGradientMaskImageRemoveAllImages();
+    MDCTextControlGradientManager *gradientManager = [[MDCTextControlGradientManager alloc] init];
+    for (NSUInteger i = 0; i < kBenchmarkLayoutCount; i++) {
+      CGFloat height = 100 + (i % 20);
+      [self layoutGradientManager:gradientManager
+                         withSize:CGSizeMake(375, height)
+              horizontalLocations:@[ @0, @0, @0.03, @0.97, @1, @1 ]];
+      XCTAssertNotNil([gradientManager combinedGradientMaskLayer].contents);
+    }
+  }];
+}
+
+@end
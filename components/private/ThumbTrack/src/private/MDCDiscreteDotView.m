@@ -14,7 +14,48 @@
 
 #import "MDCDiscreteDotView.h"
 
-@implementation MDCDiscreteDotView
+#import "MaterialAvailability.h"
+
+/**
+ Returns the range of dots that lie within @c activeDotsSegment, which is relative to the width of
+ the track.
+ */
+static NSRange MDCDiscreteDotViewActiveDotRange(NSUInteger numDiscreteDots,
+                                                CGRect activeDotsSegment) {
+  if (numDiscreteDots < 2) {
+    return NSMakeRange(0, 0);
+  }
+  // Increment within 0..1
+  CGFloat relativeIncrement = (CGFloat)1.0 / (numDiscreteDots - 1);
+
+  // Allow an extra 10% of the increment to guard against rounding errors excluding dots that
+  // should genuinely be within the active segment.
+  CGFloat minActiveX = CGRectGetMinX(activeDotsSegment) - relativeIncrement * (CGFloat)0.1;
+  CGFloat maxActiveX = CGRectGetMaxX(activeDotsSegment) + relativeIncrement * (CGFloat)0.1;
+  NSInteger firstActiveDot = MAX(0, (NSInteger)ceil(minActiveX / relativeIncrement));
+  NSInteger lastActiveDot =
+      MIN((NSInteger)numDiscreteDots - 1, (NSInteger)floor(maxActiveX / relativeIncrement));
+  if (lastActiveDot < firstActiveDot) {
+    return NSMakeRange(0, 0);
+  }
+  return NSMakeRange((NSUInteger)firstActiveDot, (NSUInteger)(lastActiveDot - firstActiveDot + 1));
+}
+
+@implementation MDCDiscreteDotView {
+  // Dots are drawn by two shape layers rather than in drawRect:, so that moving the active segment
+  // while the thumb is dragged never redraws the view's backing store. Both layers share one path
+  // holding every dot, which is only rebuilt when the size or the number of dots changes. Masks
+  // split the dots between the layers, so a new range of active dots only moves the masks.
+  CAShapeLayer *_inactiveDotsLayer;
+  CAShapeLayer *_activeDotsLayer;
+  CALayer *_activeDotsMask;
+  CALayer *_leadingInactiveDotsMask;
+  CALayer *_trailingInactiveDotsMask;
+  NSRange _activeDotRange;
+  // The distance between the origins of neighboring dots, and the width of a dot.
+  CGFloat _dotSpacing;
+  CGFloat _dotWidth;
+}
 
 - (instancetype)init {
   self = [super init];
@@ -23,23 +64,61 @@
     _inactiveDotColor = UIColor.blackColor;
     _activeDotColor = UIColor.blackColor;
     _activeDotsSegment = CGRectMake(CGFLOAT_MIN, 0, 0, 0);
+    _inactiveDotsLayer = [CAShapeLayer layer];
+    _activeDotsLayer = [CAShapeLayer layer];
+    [self.layer addSublayer:_inactiveDotsLayer];
+    [self.layer addSublayer:_activeDotsLayer];
+    [self setUpDotMasks];
+    [self updateDotColors];
   }
   return self;
 }
 
-- (void)setFrame:(CGRect)frame {
-  [super setFrame:frame];
-  [self setNeedsDisplay];
+- (void)setUpDotMasks {
+  _activeDotsMask = [CALayer layer];
+  _leadingInactiveDotsMask = [CALayer layer];
+  _trailingInactiveDotsMask = [CALayer layer];
+  CGColorRef opaqueColor = UIColor.blackColor.CGColor;
+  _activeDotsMask.backgroundColor = opaqueColor;
+  _leadingInactiveDotsMask.backgroundColor = opaqueColor;
+  _trailingInactiveDotsMask.backgroundColor = opaqueColor;
+  // The inactive dots lie on either side of the active ones.
+  CALayer *inactiveDotsMask = [CALayer layer];
+  [inactiveDotsMask addSublayer:_leadingInactiveDotsMask];
+  [inactiveDotsMask addSublayer:_trailingInactiveDotsMask];
+  _activeDotsLayer.mask = _activeDotsMask;
+  _inactiveDotsLayer.mask = inactiveDotsMask;
+}
+
+- (void)layoutSubviews {
+  [super layoutSubviews];
+
+  if (!CGRectEqualToRect(_inactiveDotsLayer.frame, self.bounds)) {
+    [self updateDotPaths];
+  }
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+  [super traitCollectionDidChange:previousTraitCollection];
+
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    if ([self.traitCollection
+            hasDifferentColorAppearanceComparedToTraitCollection:previousTraitCollection]) {
+      [self updateDotColors];
+    }
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
 }
 
 - (void)setActiveDotColor:(UIColor *)activeDotColor {
   _activeDotColor = activeDotColor;
-  [self setNeedsDisplay];
+  [self updateDotColors];
 }
 
 - (void)setInactiveDotColor:(UIColor *)inactiveDotColor {
   _inactiveDotColor = inactiveDotColor;
-  [self setNeedsDisplay];
+  [self updateDotColors];
 }
 
 - (void)setActiveDotsSegment:(CGRect)activeDotsSegment {
@@ -47,15 +126,42 @@
   CGFloat newMaxX = MIN(1, MAX(0, CGRectGetMaxX(activeDotsSegment)));
 
   _activeDotsSegment = CGRectMake(newMinX, 0, (newMaxX - newMinX), 0);
-  [self setNeedsDisplay];
+  NSRange activeDotRange =
+      MDCDiscreteDotViewActiveDotRange(_numDiscreteDots, _activeDotsSegment);
+  if (!NSEqualRanges(activeDotRange, _activeDotRange)) {
+    _activeDotRange = activeDotRange;
+    [self updateDotMasks];
+  }
 }
 
-- (void)drawRect:(CGRect)rect {
-  [super drawRect:rect];
+- (void)setNumDiscreteDots:(NSUInteger)numDiscreteDots {
+  _numDiscreteDots = numDiscreteDots;
+  [self updateDotPaths];
+}
 
-  if (_numDiscreteDots >= 2) {
-    CGContextRef contextRef = UIGraphicsGetCurrentContext();
+- (void)updateDotColors {
+  UIColor *activeDotColor = self.activeDotColor;
+  UIColor *inactiveDotColor = self.inactiveDotColor;
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    activeDotColor = [activeDotColor resolvedColorWithTraitCollection:self.traitCollection];
+    inactiveDotColor = [inactiveDotColor resolvedColorWithTraitCollection:self.traitCollection];
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  _activeDotsLayer.fillColor = activeDotColor.CGColor;
+  _inactiveDotsLayer.fillColor = inactiveDotColor.CGColor;
+  [CATransaction commit];
+}
 
+- (void)updateDotPaths {
+  _activeDotRange = MDCDiscreteDotViewActiveDotRange(_numDiscreteDots, _activeDotsSegment);
+  CGMutablePathRef dotsPath = CGPathCreateMutable();
+  _dotSpacing = 0;
+  _dotWidth = 0;
+
+  if (_numDiscreteDots >= 2) {
     // The "dot" is a circle that gradually transforms into a rounded rectangle.
     // *   At 1- and 2-point track heights, use a circle filling the height.
     // *   At 3- and 4-point track heights, use a vertically-centered circle 2 points tall.
@@ -64,43 +170,60 @@
     CGFloat trackHeight = CGRectGetHeight(self.bounds);
     CGFloat dotHeight = MIN(2, trackHeight);
     CGFloat dotWidth = MIN(2, trackHeight);
-    CGFloat circleOriginY = (trackHeight - dotHeight) / 2;
     if (trackHeight > 4) {
       dotHeight = trackHeight / 2;
-      circleOriginY = (trackHeight - dotHeight) / 2;
     }
     CGRect dotRect = CGRectMake(0, (trackHeight - dotHeight) / 2, dotWidth, dotHeight);
     // Increment within the bounds
     CGFloat absoluteIncrement = (CGRectGetWidth(self.bounds) - dotWidth) / (_numDiscreteDots - 1);
-    // Increment within 0..1
-    CGFloat relativeIncrement = (CGFloat)1.0 / (_numDiscreteDots - 1);
 
-    // Allow an extra 10% of the increment to guard against rounding errors excluding dots that
-    // should genuinely be within the active segment.
-    CGFloat minActiveX = CGRectGetMinX(self.activeDotsSegment) - relativeIncrement * (CGFloat)0.1;
-    CGFloat maxActiveX = CGRectGetMaxX(self.activeDotsSegment) + relativeIncrement * (CGFloat)0.1;
     for (NSUInteger i = 0; i < _numDiscreteDots; i++) {
-      CGFloat relativePosition = i * relativeIncrement;
-      if (minActiveX <= relativePosition && maxActiveX >= relativePosition) {
-        [self.activeDotColor setFill];
-      } else {
-        [self.inactiveDotColor setFill];
-      }
       dotRect.origin.x = (i * absoluteIncrement);
-      // Clear any previous paths from the context
-      CGContextBeginPath(contextRef);
-      CGPathRef rectPathRef =
-          CGPathCreateWithRoundedRect(dotRect, dotWidth / 2, dotWidth / 2, NULL);
-      CGContextAddPath(contextRef, rectPathRef);
-      CGContextFillPath(contextRef);
-      CGPathRelease(rectPathRef);
+      CGPathAddRoundedRect(dotsPath, NULL, dotRect, dotWidth / 2, dotWidth / 2);
     }
+    _dotSpacing = absoluteIncrement;
+    _dotWidth = dotWidth;
   }
+
+  // Match drawRect:, which never animated its dots.
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  _inactiveDotsLayer.frame = self.bounds;
+  _activeDotsLayer.frame = self.bounds;
+  _inactiveDotsLayer.mask.frame = self.bounds;
+  _inactiveDotsLayer.path = dotsPath;
+  _activeDotsLayer.path = dotsPath;
+  [CATransaction commit];
+  CGPathRelease(dotsPath);
+  [self updateDotMasks];
 }
 
-- (void)setNumDiscreteDots:(NSUInteger)numDiscreteDots {
-  _numDiscreteDots = numDiscreteDots;
-  [self setNeedsDisplay];
+/**
+ Returns the x position of the boundary in front of the dot at @c index: midway between it and the
+ previous dot, or an edge of the bounds for the first dot and for an index past the last dot.
+ */
+- (CGFloat)dotBoundaryAtIndex:(NSUInteger)index {
+  if (index == 0) {
+    return 0;
+  }
+  if (index >= _numDiscreteDots) {
+    return CGRectGetWidth(self.bounds);
+  }
+  return index * _dotSpacing - (_dotSpacing - _dotWidth) / 2;
+}
+
+- (void)updateDotMasks {
+  CGFloat height = CGRectGetHeight(self.bounds);
+  CGFloat activeMinX = [self dotBoundaryAtIndex:_activeDotRange.location];
+  CGFloat activeMaxX = [self dotBoundaryAtIndex:NSMaxRange(_activeDotRange)];
+
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  _activeDotsMask.frame = CGRectMake(activeMinX, 0, activeMaxX - activeMinX, height);
+  _leadingInactiveDotsMask.frame = CGRectMake(0, 0, activeMinX, height);
+  _trailingInactiveDotsMask.frame =
+      CGRectMake(activeMaxX, 0, CGRectGetWidth(self.bounds) - activeMaxX, height);
+  [CATransaction commit];
 }
 
 @end
@@ -0,0 +1,154 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCDiscreteDotView.h"
+
+static const NSUInteger kBenchmarkDotCount = 201;
+static const NSUInteger kBenchmarkDragStepCount = 1000;
+
+@interface MDCDiscreteDotViewTests : XCTestCase
+@property(nonatomic, strong) MDCDiscreteDotView *dotView;
+@end
+
+@implementation MDCDiscreteDotViewTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.dotView = [[MDCDiscreteDotView alloc] init];
+  // Five 2-point dots spaced 25 points apart.
+  self.dotView.frame = CGRectMake(0, 0, 102, 2);
+  self.dotView.numDiscreteDots = 5;
+  [self.dotView layoutIfNeeded];
+}
+
+- (void)tearDown {
+  self.dotView = nil;
+
+  [super tearDown];
+}
+
+- (CAShapeLayer *)inactiveDotsLayer {
+  return (CAShapeLayer *)self.dotView.layer.sublayers[0];
+}
+
+- (CAShapeLayer *)activeDotsLayer {
+  return (CAShapeLayer *)self.dotView.layer.sublayers[1];
+}
+
+- (CALayer *)leadingInactiveDotsMask {
+  return self.inactiveDotsLayer.mask.sublayers[0];
+}
+
+- (CALayer *)trailingInactiveDotsMask {
+  return self.inactiveDotsLayer.mask.sublayers[1];
+}
+
+- (void)testDotsAreSplitBetweenActiveAndInactiveLayers {
+  // When
+  self.dotView.activeDotsSegment = CGRectMake(0, 0, (CGFloat)0.5, 0);
+
+  // Then
+  // The first three dots are active; the masks meet midway between the third and fourth dots.
+  XCTAssertTrue(CGRectEqualToRect(self.activeDotsLayer.mask.frame, CGRectMake(0, 0, 63.5, 2)));
+  XCTAssertEqual(CGRectGetWidth(self.leadingInactiveDotsMask.frame), 0);
+  XCTAssertTrue(
+      CGRectEqualToRect(self.trailingInactiveDotsMask.frame, CGRectMake(63.5, 0, 38.5, 2)));
+}
+
+- (void)testActiveAndInactiveLayersShareOnePathOfAllDots {
+  // Then
+  XCTAssertEqual(self.activeDotsLayer.path, self.inactiveDotsLayer.path);
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetPathBoundingBox(self.activeDotsLayer.path),
+                                  CGRectMake(0, 0, 102, 2)));
+}
+
+- (void)testActiveDotRangeChangesMoveMasksWithoutRebuildingPath {
+  // Given
+  self.dotView.activeDotsSegment = CGRectMake(0, 0, (CGFloat)0.5, 0);
+  CGPathRef path = self.activeDotsLayer.path;
+
+  // When
+  self.dotView.activeDotsSegment = CGRectMake((CGFloat)0.25, 0, (CGFloat)0.5, 0);
+
+  // Then
+  XCTAssertEqual(self.activeDotsLayer.path, path);
+  XCTAssertEqual(self.inactiveDotsLayer.path, path);
+  XCTAssertTrue(CGRectEqualToRect(self.activeDotsLayer.mask.frame, CGRectMake(13.5, 0, 75, 2)));
+  XCTAssertTrue(CGRectEqualToRect(self.leadingInactiveDotsMask.frame, CGRectMake(0, 0, 13.5, 2)));
+  XCTAssertTrue(
+      CGRectEqualToRect(self.trailingInactiveDotsMask.frame, CGRectMake(88.5, 0, 13.5, 2)));
+}
+
+- (void)testActiveSegmentChangesDoNotRedrawTheBackingStore {
+  // When
+  self.dotView.activeDotsSegment = CGRectMake((CGFloat)0.25, 0, (CGFloat)0.5, 0);
+
+  // Then
+  XCTAssertFalse(self.dotView.layer.needsDisplay);
+}
+
+- (void)testDotColorsAreAppliedToLayers {
+  // When
+  self.dotView.activeDotColor = UIColor.redColor;
+  self.dotView.inactiveDotColor = UIColor.blueColor;
+
+  // Then
+  XCTAssertTrue(CGColorEqualToColor(self.activeDotsLayer.fillColor, UIColor.redColor.CGColor));
+  XCTAssertTrue(CGColorEqualToColor(self.inactiveDotsLayer.fillColor, UIColor.blueColor.CGColor));
+}
+
+- (void)testFewerThanTwoDotsDrawsNothing {
+  // When
+  self.dotView.numDiscreteDots = 1;
+
+  // Then
+  XCTAssertTrue(CGPathIsEmpty(self.activeDotsLayer.path));
+  XCTAssertTrue(CGPathIsEmpty(self.inactiveDotsLayer.path));
+}
+
+- (void)testResizingRebuildsPaths {
+  // Given
+  self.dotView.activeDotsSegment = CGRectMake(0, 0, 1, 0);
+
+  // When
+  self.dotView.frame = CGRectMake(0, 0, 202, 2);
+  [self.dotView layoutIfNeeded];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetPathBoundingBox(self.activeDotsLayer.path),
+                                  CGRectMake(0, 0, 202, 2)));
+}
+
+#pragma mark - Performance
+
+/** Simulates dragging the thumb of a slider with many discrete values from end to end. */
+- (void)testPerformanceDraggingAcrossManyDots {
+  // Given
+  self.dotView.frame = CGRectMake(0, 0, 400, 2);
+  self.dotView.numDiscreteDots = kBenchmarkDotCount;
+  [self.dotView layoutIfNeeded];
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i <= kBenchmarkDragStepCount; i++) {
+      CGFloat value = (CGFloat)i / kBenchmarkDragStepCount;
+      self.dotView.activeDotsSegment = CGRectMake(0, 0, value, 0);
+    }
+  }];
+}
+
+@end
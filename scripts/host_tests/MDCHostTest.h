@@ -0,0 +1,64 @@
+// Copyright 2022-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Minimal assertions and timing for the plain-C tests in components/*/tests/host. Each test is a
+// single translation unit with a main() that returns MDCHostTestExitStatus(). See
+// scripts/test_host.
+
+#ifndef MDCHostTest_h
+#define MDCHostTest_h
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+static int MDCHostTestFailureCount = 0;
+
+#define MDC_HOST_EXPECT_TRUE(condition)                                                  \
+  do {                                                                                   \
+    if (!(condition)) {                                                                  \
+      fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #condition);           \
+      MDCHostTestFailureCount++;                                                         \
+    }                                                                                    \
+  } while (0)
+
+#define MDC_HOST_EXPECT_NEAR(actual, expected, accuracy)                                 \
+  do {                                                                                   \
+    double mdc_actual = (actual);                                                        \
+    double mdc_expected = (expected);                                                    \
+    if (!(fabs(mdc_actual - mdc_expected) <= (accuracy))) {                              \
+      fprintf(stderr, "%s:%d: %s is %g, expected %g\n", __FILE__, __LINE__, #actual,     \
+              mdc_actual, mdc_expected);                                                 \
+      MDCHostTestFailureCount++;                                                         \
+    }                                                                                    \
+  } while (0)
+
+/** Returns a monotonic timestamp in nanoseconds. */
+static inline double MDCHostTestNanoseconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+/** Prints the cost of one operation, given the time taken by @c operationCount of them. */
+static inline void MDCHostTestReportCost(const char *name, double nanoseconds,
+                                         unsigned long operationCount) {
+  printf("%-48s %10.2f ns/op\n", name, nanoseconds / (double)operationCount);
+}
+
+static inline int MDCHostTestExitStatus(void) {
+  return MDCHostTestFailureCount == 0 ? 0 : 1;
+}
+
+#endif  // MDCHostTest_h